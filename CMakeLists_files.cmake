@@ -9,17 +9,24 @@ set(SOURCE_DIR ${MAIN_DIR}/src)
 # Define headers files
 # -------------------------------------------------------------------------------------------------------------------- #
 set(HEADERS
+  ${INCLUDE_DIR}/accessresolver.h
   ${INCLUDE_DIR}/account.h
+  ${INCLUDE_DIR}/blobstream.h
+  ${INCLUDE_DIR}/changenotifier.h
   ${INCLUDE_DIR}/chipcard.h
   ${INCLUDE_DIR}/chipcarddoor.h
   ${INCLUDE_DIR}/chipcardprofile.h
   ${INCLUDE_DIR}/chipcardprofiledoor.h
   ${INCLUDE_DIR}/cityname.h
+  ${INCLUDE_DIR}/columnarsnapshot.h
   ${INCLUDE_DIR}/commondata.h
   ${INCLUDE_DIR}/company.h
   ${INCLUDE_DIR}/computer.h
   ${INCLUDE_DIR}/computersoftware.h
+  ${INCLUDE_DIR}/connectionpool.h
+  ${INCLUDE_DIR}/cursor.h
   ${INCLUDE_DIR}/datacontext.h
+  ${INCLUDE_DIR}/datagenerator.h
   ${INCLUDE_DIR}/department.h
   ${INCLUDE_DIR}/devicename.h
   ${INCLUDE_DIR}/devicetype.h
@@ -30,17 +37,31 @@ set(HEADERS
   ${INCLUDE_DIR}/fax.h
   ${INCLUDE_DIR}/function.h
   ${INCLUDE_DIR}/inventory.h
+  ${INCLUDE_DIR}/lazyblobtablemodel.h
   ${INCLUDE_DIR}/manufacturer.h
+  ${INCLUDE_DIR}/migrator.h
   ${INCLUDE_DIR}/mobile.h
   ${INCLUDE_DIR}/os.h
   ${INCLUDE_DIR}/phone.h
   ${INCLUDE_DIR}/place.h
+  ${INCLUDE_DIR}/pragmaprofile.h
   ${INCLUDE_DIR}/printer.h
   ${INCLUDE_DIR}/processor.h
+  ${INCLUDE_DIR}/reportwriter.h
+  ${INCLUDE_DIR}/resultset.h
+  ${INCLUDE_DIR}/rowmapper.h
+  ${INCLUDE_DIR}/rows.h
+  ${INCLUDE_DIR}/schema.h
+  ${INCLUDE_DIR}/searchindex.h
   ${INCLUDE_DIR}/software.h
+  ${INCLUDE_DIR}/sqlitestatement.h
+  ${INCLUDE_DIR}/statementcache.h
   ${INCLUDE_DIR}/systemdata.h
+  ${INCLUDE_DIR}/tabledescriptor.h
   ${INCLUDE_DIR}/title.h
+  ${INCLUDE_DIR}/transaction.h
   ${INCLUDE_DIR}/zipcity.h
+  ${INCLUDE_DIR}/zipcitylookup.h
   ${INCLUDE_DIR}/zipcode.h
 )
 
@@ -51,17 +72,24 @@ source_group("include/${TARGET_ID_LOWER}" FILES ${HEADERS})
 # Define sources files
 # -------------------------------------------------------------------------------------------------------------------- #
 set(SOURCES 
+    ${SOURCE_DIR}/accessresolver.cpp
     ${SOURCE_DIR}/account.cpp
+    ${SOURCE_DIR}/blobstream.cpp
+    ${SOURCE_DIR}/changenotifier.cpp
     ${SOURCE_DIR}/chipcard.cpp
     ${SOURCE_DIR}/chipcarddoor.cpp
     ${SOURCE_DIR}/chipcardprofile.cpp
     ${SOURCE_DIR}/chipcardprofiledoor.cpp
     ${SOURCE_DIR}/cityname.cpp
+    ${SOURCE_DIR}/columnarsnapshot.cpp
     ${SOURCE_DIR}/commondata.cpp
     ${SOURCE_DIR}/company.cpp
     ${SOURCE_DIR}/computer.cpp
     ${SOURCE_DIR}/computersoftware.cpp
+    ${SOURCE_DIR}/connectionpool.cpp
+    ${SOURCE_DIR}/cursor.cpp
     ${SOURCE_DIR}/datacontext.cpp
+    ${SOURCE_DIR}/datagenerator.cpp
     ${SOURCE_DIR}/department.cpp
     ${SOURCE_DIR}/devicename.cpp
     ${SOURCE_DIR}/devicetype.cpp
@@ -72,17 +100,26 @@ set(SOURCES
     ${SOURCE_DIR}/fax.cpp
     ${SOURCE_DIR}/function.cpp
     ${SOURCE_DIR}/inventory.cpp
+    ${SOURCE_DIR}/lazyblobtablemodel.cpp
     ${SOURCE_DIR}/manufacturer.cpp
+    ${SOURCE_DIR}/migrator.cpp
     ${SOURCE_DIR}/mobile.cpp
     ${SOURCE_DIR}/os.cpp
     ${SOURCE_DIR}/phone.cpp
     ${SOURCE_DIR}/place.cpp
+    ${SOURCE_DIR}/pragmaprofile.cpp
     ${SOURCE_DIR}/printer.cpp
     ${SOURCE_DIR}/processor.cpp
+    ${SOURCE_DIR}/reportwriter.cpp
+    ${SOURCE_DIR}/searchindex.cpp
     ${SOURCE_DIR}/software.cpp
+    ${SOURCE_DIR}/sqlitestatement.cpp
+    ${SOURCE_DIR}/statementcache.cpp
     ${SOURCE_DIR}/systemdata.cpp
     ${SOURCE_DIR}/title.cpp
+    ${SOURCE_DIR}/transaction.cpp
     ${SOURCE_DIR}/zipcity.cpp
+    ${SOURCE_DIR}/zipcitylookup.cpp
     ${SOURCE_DIR}/zipcode.cpp
     ${SOURCE_DIR}/res.qrc)
   
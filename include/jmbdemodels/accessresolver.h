@@ -0,0 +1,194 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QHash>
+#include <QPair>
+#include <QReadWriteLock>
+#include <QSet>
+#include <QSqlDatabase>
+#include <QString>
+#include <QVector>
+
+#include <vector>
+
+#include "columnarsnapshot.h"
+#include "rows.h"
+
+#include "jmbdemodels_export.h"
+
+namespace Model {
+/*!
+    \class AccessResolver
+    \brief Which doors a chip card opens and who opens a door, in memory
+    \details A card opens the doors of its profile, from
+             chip_card_profile_door and the door of the profile itself, and
+             the door assigned to the card directly.
+
+             Every door and every profile gets a slot. The resolver keeps
+             a profile x door bit matrix, also transposed, the profile of
+             every card and the cards of every profile, so canOpen() is one
+             bit test and the other queries only walk their result.
+
+             load() reads the four tables once; the set and remove
+             functions apply the change of one row, e.g. after a form was
+             saved. All functions are thread safe.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+class AccessResolver {
+public:
+  AccessResolver() = default;
+
+  /*!
+      \fn auto load(const QSqlDatabase &db) -> bool
+
+      \brief Read the doors, profiles, profile doors and cards
+      \details Replaces everything known so far.
+
+      \return false on an error, see lastError()
+   */
+  JMBDEMODELS_EXPORT auto load(const QSqlDatabase &db) -> bool;
+
+  /*!
+      \fn auto lastError() const -> QString
+
+      \brief The error of the last load(), empty if it succeeded
+   */
+  JMBDEMODELS_EXPORT auto lastError() const -> QString;
+
+  /*!
+      \fn auto canOpen(qint64 cardId, qint64 doorId) const -> bool
+
+      \brief true if the card opens the door
+   */
+  JMBDEMODELS_EXPORT auto canOpen(qint64 cardId, qint64 doorId) const -> bool;
+
+  /*!
+      \fn auto doorsOf(qint64 cardId) const -> QVector<qint64>
+
+      \brief The ids of all doors the card opens, in the order of the slots
+   */
+  JMBDEMODELS_EXPORT auto doorsOf(qint64 cardId) const -> QVector<qint64>;
+
+  /*!
+      \fn auto profilesFor(qint64 doorId) const -> QVector<qint64>
+
+      \brief The ids of all profiles that include the door
+   */
+  JMBDEMODELS_EXPORT auto profilesFor(qint64 doorId) const -> QVector<qint64>;
+
+  /*!
+      \fn auto cardsFor(qint64 doorId) const -> QVector<qint64>
+
+      \brief The ids of all cards that open the door, sorted
+   */
+  JMBDEMODELS_EXPORT auto cardsFor(qint64 doorId) const -> QVector<qint64>;
+
+  /*!
+      \fn void setDoor(const ChipCardDoorRow &door)
+
+      \brief Add a door; doors of links are added on their own as well
+   */
+  JMBDEMODELS_EXPORT void setDoor(const ChipCardDoorRow &door);
+
+  /*!
+      \fn void removeDoor(qint64 doorId)
+
+      \brief Remove a door and every link to it
+   */
+  JMBDEMODELS_EXPORT void removeDoor(qint64 doorId);
+
+  /*!
+      \fn void setProfile(const ChipCardProfileRow &profile)
+
+      \brief Add a profile or change the door of the profile itself
+   */
+  JMBDEMODELS_EXPORT void setProfile(const ChipCardProfileRow &profile);
+
+  /*!
+      \fn void removeProfile(qint64 profileId)
+
+      \brief Remove a profile; its cards open only their own door then
+   */
+  JMBDEMODELS_EXPORT void removeProfile(qint64 profileId);
+
+  /*!
+      \fn void setProfileDoor(const ChipCardProfileDoorRow &link)
+
+      \brief Add or change a row of chip_card_profile_door
+   */
+  JMBDEMODELS_EXPORT void setProfileDoor(const ChipCardProfileDoorRow &link);
+
+  /*!
+      \fn void removeProfileDoor(qint64 linkId)
+
+      \brief Remove a row of chip_card_profile_door
+   */
+  JMBDEMODELS_EXPORT void removeProfileDoor(qint64 linkId);
+
+  /*!
+      \fn void setCard(const ChipCardRow &card)
+
+      \brief Add a card or change its profile or door
+   */
+  JMBDEMODELS_EXPORT void setCard(const ChipCardRow &card);
+
+  /*!
+      \fn void removeCard(qint64 cardId)
+
+      \brief Remove a card
+   */
+  JMBDEMODELS_EXPORT void removeCard(qint64 cardId);
+
+private:
+  /*!
+      \brief The profile and door slot of a card, -1 for none
+   */
+  struct Card {
+    int profile{-1};
+    int door{-1};
+  };
+
+  void clear();
+
+  auto doorSlot(qint64 doorId) -> int;
+  auto profileSlot(qint64 profileId) -> int;
+
+  void link(qint64 profileId, qint64 doorId);
+  void unlink(qint64 profileId, qint64 doorId);
+
+  void setCardLocked(const ChipCardRow &card);
+  void removeCardLocked(qint64 cardId);
+
+  mutable QReadWriteLock m_lock;
+  QString m_error;
+
+  // Slots of the doors and profiles; the id of a removed one is 0
+  QHash<qint64, int> m_doorSlots;
+  std::vector<qint64> m_doorIds;
+  QHash<qint64, int> m_profileSlots;
+  std::vector<qint64> m_profileIds;
+
+  // The bit matrix, by profile and by door
+  std::vector<Bitmap> m_profileDoors;
+  std::vector<Bitmap> m_doorProfiles;
+
+  // How often a profile is linked to a door, by profile << 32 | door slot
+  QHash<quint64, int> m_links;
+  QHash<qint64, QPair<qint64, qint64>> m_profileDoorRows;
+  QHash<qint64, qint64> m_profileOwnDoors;
+
+  QHash<qint64, Card> m_cards;
+  std::vector<QSet<qint64>> m_profileCards;
+  std::vector<QSet<qint64>> m_doorCards;
+};
+} // namespace Model
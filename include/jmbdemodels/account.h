@@ -38,11 +38,13 @@ class Account : public CommonData {
 
 public:
   /*!
-      \fn Account()
+      \fn Account(const QSharedPointer<Model::DataContext> &dataContext = {})
 
       \brief Constructor for the Account
+      \param dataContext - The DataContext to use, the shared one if null
    */
-  explicit JMBDEMODELS_EXPORT Account();
+  explicit JMBDEMODELS_EXPORT
+  Account(const QSharedPointer<Model::DataContext> &dataContext = {});
   /*!
       \fn  ~Account();
 
@@ -50,78 +52,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~Account() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int getAccountIdIndex() const
 
@@ -130,7 +61,7 @@ public:
       \return the value of the index
    */
   JMBDEMODELS_EXPORT auto getAccountIdIndex() const -> int {
-    return m_AccountIdIndex;
+    return this->getFieldIndex(Schema::Account::AccountId);
   }
 
   /*!
@@ -141,7 +72,7 @@ public:
       \return the value of the index
    */
   JMBDEMODELS_EXPORT auto getUserNameIndex() const -> int {
-    return m_UserNameIndex;
+    return this->getFieldIndex(Schema::Account::UserName);
   }
 
   /*!
@@ -152,7 +83,7 @@ public:
       \return the value of the index
    */
   JMBDEMODELS_EXPORT auto getPasswordIndex() const -> int {
-    return m_PasswordIndex;
+    return this->getFieldIndex(Schema::Account::Password);
   }
 
   /*!
@@ -163,7 +94,7 @@ public:
       \return the value of the index
    */
   JMBDEMODELS_EXPORT auto getSystemDataIndex() const -> int {
-    return m_SystemDataIdIndex;
+    return this->getFieldIndex(Schema::Account::SystemDataId);
   }
 
   /*!
@@ -174,53 +105,7 @@ public:
       \return the value of the index
    */
   JMBDEMODELS_EXPORT auto getLastUpdateIndex() const -> int {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::Account::LastUpdate);
   }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("account");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-      \var int m_AccountIdIndex
-      \brief The value of the AccountIdIndex
-   */
-  int m_AccountIdIndex{0};
-
-  /*!
-      \var int m_UserNameIndex
-      \brief The value of the UserNameIndex
-  */
-  int m_UserNameIndex{0};
-
-  /*!
-       \var int m_PasswordIndex;
-       \brief The value of the PasswordIndex
-   */
-  int m_PasswordIndex{0};
-
-  /*!
-      \var int m_SystemDataIdIndex
-      \brief The value of the SystemDataIdIndex
-  */
-  int m_SystemDataIdIndex{0};
-
-  /*!
-      \var int m_LastUpdateIndex
-      \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
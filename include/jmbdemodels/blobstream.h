@@ -0,0 +1,104 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QCoreApplication>
+#include <QIODevice>
+#include <QSqlDatabase>
+#include <QString>
+
+#include "tabledescriptor.h"
+
+#include "jmbdemodels_export.h"
+
+namespace Model {
+/*!
+    \class BlobStream
+    \brief Copies one BLOB value, e.g. a document or a photo, in chunks
+    \details The value is read and written getChunkSize() bytes at a time,
+             so a large document never has to fit into memory:
+             - SQLite with WITH_SQLITE3: incremental blob I/O on the rowid
+             - else: SELECT substr() (substring() on PostgreSQL) per chunk
+
+             Writing without WITH_SQLITE3 binds the whole value once.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+class BlobStream {
+  Q_DECLARE_TR_FUNCTIONS(BlobStream)
+
+public:
+  /*!
+      \fn BlobStream(const QSqlDatabase &db, const TableDescriptor &table,
+                     int column)
+
+      \brief Constructor for the BlobStream
+      \param db - The connection, used from its thread
+      \param table - The table of the value
+      \param column - The position of the BLOB column in the descriptor
+   */
+  JMBDEMODELS_EXPORT BlobStream(const QSqlDatabase &db,
+                                const TableDescriptor &table, int column);
+
+  /*!
+      \fn void setChunkSize(int bytes)
+
+      \brief Set the bytes per read or write, 64 KiB by default
+   */
+  JMBDEMODELS_EXPORT void setChunkSize(int bytes) {
+    m_chunkSize = qMax(1, bytes);
+  }
+
+  JMBDEMODELS_EXPORT auto getChunkSize() const -> int { return m_chunkSize; }
+
+  /*!
+      \fn auto size(qint64 id) -> qint64
+
+      \brief The size of the value of the row in bytes
+      \return the size, 0 for NULL, -1 if there is no such row
+   */
+  JMBDEMODELS_EXPORT auto size(qint64 id) -> qint64;
+
+  /*!
+      \fn auto read(qint64 id, QIODevice *device) -> qint64
+
+      \brief Write the value of the row to the open device
+      \return the number of bytes written, -1 on an error
+   */
+  JMBDEMODELS_EXPORT auto read(qint64 id, QIODevice *device) -> qint64;
+
+  /*!
+      \fn auto write(qint64 id, QIODevice *device, qint64 size = -1) -> bool
+
+      \brief Replace the value of the row with size bytes of the device
+      \param size - The bytes to copy; -1 for the rest of the device
+   */
+  JMBDEMODELS_EXPORT auto write(qint64 id, QIODevice *device,
+                                qint64 size = -1) -> bool;
+
+  /*!
+      \fn auto lastError() const -> QString
+
+      \brief The error of the last call, empty if it succeeded
+   */
+  JMBDEMODELS_EXPORT auto lastError() const -> QString { return m_error; }
+
+private:
+  auto isPostgres() const -> bool;
+
+  QSqlDatabase m_db;
+  const TableDescriptor *m_table;
+  QString m_column;
+  QString m_key;
+  QString m_error;
+  int m_chunkSize{64 * 1024};
+};
+} // namespace Model
@@ -0,0 +1,187 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QDateTime>
+#include <QFileSystemWatcher>
+#include <QHash>
+#include <QObject>
+#include <QPair>
+#include <QSqlDriver>
+#include <QString>
+#include <QTimer>
+#include <QVariant>
+
+#include <memory>
+
+#include "resultset.h"
+#include "sqlitestatement.h"
+
+#include "jmbdemodels_export.h"
+
+namespace Model {
+class DataContext;
+
+/*!
+    \class ChangeNotifier
+    \brief Tells the models which rows of the database were written
+    \details On SQLite the own writes of the connection are reported right
+             after their commit. start() adds the writes of other processes:
+             - SQLite: the database file and its WAL are watched. When
+               PRAGMA data_version says another connection committed, the
+               rows are read with DataContext::changesSince().
+             - PostgreSQL: LISTEN jmbde_change, the NOTIFY comes from the
+               triggers of DataContext::createChangeTracking(). The own
+               writes come the same way.
+
+             On SQLite the own writes need WITH_SQLITE3. The writes of
+             another SQLite process are found by their last_update and by
+             the keys in deleted_row. A commit that shows neither, e.g. rows
+             written with an old last_update of their own, falls back to
+             tableChanged() for every table, at most once per
+             getFullRefreshInterval().
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+class ChangeNotifier : public QObject {
+  Q_OBJECT
+
+public:
+  /*!
+      \fn ChangeNotifier(DataContext *context)
+
+      \brief Constructor for the ChangeNotifier
+      \param context - The database to watch, also the parent
+   */
+  explicit JMBDEMODELS_EXPORT ChangeNotifier(DataContext *context);
+
+  /*!
+      \fn ~ChangeNotifier()
+
+      \brief Stop watching
+   */
+  JMBDEMODELS_EXPORT ~ChangeNotifier() override;
+
+  /*!
+      \fn auto start() -> bool
+
+      \brief Watch for the writes of other processes too
+      \return false if the database can't be watched
+   */
+  JMBDEMODELS_EXPORT auto start() -> bool;
+
+  /*!
+      \fn void stop()
+
+      \brief Report only the own writes again
+   */
+  JMBDEMODELS_EXPORT void stop();
+
+  JMBDEMODELS_EXPORT auto isActive() const -> bool { return m_active; }
+
+  /*!
+      \fn void attach()
+
+      \brief Hook into the current connection of the DataContext
+      \details Called after the DataContext opened its database.
+   */
+  JMBDEMODELS_EXPORT void attach();
+
+  /*!
+      \fn void detach()
+
+      \brief Stop and let go of the connection before it is closed
+   */
+  JMBDEMODELS_EXPORT void detach();
+
+  /*!
+      \fn void setDelay(int msec)
+
+      \brief Wait msec after a change of the file before reading, 100 by
+             default; a burst of writes is read once
+   */
+  JMBDEMODELS_EXPORT void setDelay(int msec) { m_delay.setInterval(msec); }
+
+  JMBDEMODELS_EXPORT auto getDelay() const -> int {
+    return m_delay.interval();
+  }
+
+  /*!
+      \fn void setRowLimit(int rows)
+
+      \brief Report at most rows changed rows of a table per commit, 256 by
+             default; above it tableChanged() is emitted once instead
+   */
+  JMBDEMODELS_EXPORT void setRowLimit(int rows);
+
+  JMBDEMODELS_EXPORT auto getRowLimit() const -> int { return m_rowLimit; }
+
+  /*!
+      \fn void setFullRefreshInterval(int msec)
+
+      \brief The pause between two refreshes of every table, 5000 by
+             default; a commit of another process that shows no changed row
+             in the pause is refreshed at its end
+   */
+  JMBDEMODELS_EXPORT void setFullRefreshInterval(int msec) {
+    m_fullRefresh.setInterval(msec);
+  }
+
+  JMBDEMODELS_EXPORT auto getFullRefreshInterval() const -> int {
+    return m_fullRefresh.interval();
+  }
+
+signals:
+  /*!
+      \fn void rowChanged(const QString &table, qint64 rowId,
+                          Model::RowOperation operation)
+      \brief A row was inserted, updated or deleted
+      \details A row written by another SQLite process is always reported
+               as an Update.
+   */
+  JMBDEMODELS_EXPORT void rowChanged(const QString &table, qint64 rowId,
+                                     Model::RowOperation operation);
+
+  /*!
+      \fn void tableChanged(const QString &table)
+      \brief Rows of the table changed, which ones is not known
+   */
+  JMBDEMODELS_EXPORT void tableChanged(const QString &table);
+
+public slots:
+  /*!
+      \fn void refresh()
+      \brief Read the writes of other SQLite processes now
+   */
+  JMBDEMODELS_EXPORT void refresh();
+
+private:
+  void emitCommitted();
+  void refreshAll();
+  auto stampedSince(const QString &table, const QDateTime &since) const
+      -> QPair<qint64, QDateTime>;
+  void watchFiles();
+  void notification(const QString &name, QSqlDriver::NotificationSource source,
+                    const QVariant &payload);
+  auto dataVersion() const -> qint64;
+
+  DataContext *m_context;
+  std::unique_ptr<SqliteUpdateHook> m_hook;
+  QFileSystemWatcher m_watcher;
+  QTimer m_delay;
+  QTimer m_fullRefresh;
+  QHash<QString, QDateTime> m_watermarks;
+  qint64 m_dataVersion{-1};
+  int m_rowLimit{256};
+  bool m_active{false};
+  bool m_fullRefreshPending{false};
+};
+} // namespace Model
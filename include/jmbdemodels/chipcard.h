@@ -37,11 +37,13 @@ class ChipCard : public CommonData {
 
 public:
   /*!
-      \fn ChipCard()
+      \fn ChipCard(const QSharedPointer<Model::DataContext> &dataContext = {})
 
       \brief Constructor forChipCard
+      \param dataContext - The DataContext to use, the shared one if null
   */
-  explicit JMBDEMODELS_EXPORT ChipCard();
+  explicit JMBDEMODELS_EXPORT
+  ChipCard(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn ~ChipCard() override
@@ -50,78 +52,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~ChipCard() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int ChipCardIdIndex()
 
@@ -130,7 +61,7 @@ public:
       \return the value of the index
    */
   JMBDEMODELS_EXPORT auto getChipCardIdIndex() const -> int {
-    return m_ChipCardIdIndex;
+    return this->getFieldIndex(Schema::ChipCard::ChipCardId);
   }
 
   /*!
@@ -141,7 +72,7 @@ public:
       \return the value of the index
    */
   JMBDEMODELS_EXPORT auto getNumberIndex() const -> int {
-    return m_NumberIndex;
+    return this->getFieldIndex(Schema::ChipCard::Number);
   }
 
   /*!
@@ -152,7 +83,7 @@ public:
       \return the value of the index
    */
   JMBDEMODELS_EXPORT auto getChipCardDoorIdIndex() const -> int {
-    return m_ChipCardDoorIdIndex;
+    return this->getFieldIndex(Schema::ChipCard::ChipCardDoorId);
   }
 
   /*!
@@ -164,7 +95,7 @@ public:
       \return the value of the index
    */
   JMBDEMODELS_EXPORT auto getChipCardProfileIdIndex() const -> int {
-    return m_ChipCardProfileIdIndex;
+    return this->getFieldIndex(Schema::ChipCard::ChipCardProfileId);
   }
 
   /*!
@@ -175,7 +106,7 @@ public:
       \return the value of the index
    */
   JMBDEMODELS_EXPORT auto getEmployeeIdIndex() const -> int {
-    return m_EmployeeIdIndex;
+    return this->getFieldIndex(Schema::ChipCard::EmployeeId);
   }
 
   /*!
@@ -186,54 +117,8 @@ public:
       \return the value of the index
    */
   JMBDEMODELS_EXPORT auto getLastUpdateIndex() const -> int {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::ChipCard::LastUpdate);
   }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("chip_card");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-      \brief The value of the ChipCardIdIndex
-   */
-  int m_ChipCardIdIndex{0};
-
-  /*!
-      \brief The value of the NumberIndex
-   */
-  int m_NumberIndex{0};
-
-  /*!
-      \brief The value of the ChipCardDoorIdIndex
-   */
-  int m_ChipCardDoorIdIndex{0};
-
-  /*!
-      \brief The value of the hipCardProfileIdIndex
-   */
-  int m_ChipCardProfileIdIndex{0};
-
-  /*!
-      \brief The value of the EmployeeIdIndex
-   */
-  int m_EmployeeIdIndex{0};
-
-  /*!
-        \brief The value of the LastUpdateIndex
-    */
-  int m_LastUpdateIndex{0};
 };
 
 } // namespace Model
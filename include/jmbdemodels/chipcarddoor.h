@@ -37,12 +37,14 @@ class ChipCardDoor : public CommonData {
 
 public:
   /*!
-      \fn ChipCardDoor()
+      \fn ChipCardDoor(const QSharedPointer<Model::DataContext> &dataContext = {})
 
       \brief Constructor for the ChipCardDoor
       \param parent The pointer to the parent Object
+      \param dataContext - The DataContext to use, the shared one if null
    */
-  explicit JMBDEMODELS_EXPORT ChipCardDoor();
+  explicit JMBDEMODELS_EXPORT
+  ChipCardDoor(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
    * \fn  ~ChipCardDoor() override;
@@ -51,78 +53,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~ChipCardDoor() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn  int ChipCardDoorIdIndex()
 
@@ -131,7 +62,7 @@ public:
       \return  the value of the index
    */
   JMBDEMODELS_EXPORT auto getChipCardDoorIdIndex() const -> int {
-    return m_ChipCardDoorIdIndex;
+    return this->getFieldIndex(Schema::ChipCardDoor::ChipCardDoorId);
   }
 
   /*!
@@ -142,7 +73,7 @@ public:
       \return  the value of the index
    */
   JMBDEMODELS_EXPORT auto getNumberIndex() const -> int {
-    return m_NumberIndex;
+    return this->getFieldIndex(Schema::ChipCardDoor::Number);
   }
 
   /*!
@@ -153,7 +84,7 @@ public:
       \return  the value of the index
    */
   JMBDEMODELS_EXPORT auto getPlaceIdIndex() const -> int {
-    return m_PlaceIdIndex;
+    return this->getFieldIndex(Schema::ChipCardDoor::PlaceId);
   }
 
   /*!
@@ -164,7 +95,7 @@ public:
       \return  the value of the index
    */
   JMBDEMODELS_EXPORT auto getDepartmentIdIndex() const -> int {
-    return m_DepartmetIdIndex;
+    return this->getFieldIndex(Schema::ChipCardDoor::DepartmentId);
   }
 
   /*!
@@ -175,7 +106,7 @@ public:
      \return  the value of the index
   */
   JMBDEMODELS_EXPORT auto getEmployeeIdIndex() const -> int {
-    return m_EmployeeIdIndex;
+    return this->getFieldIndex(Schema::ChipCardDoor::EmployeeId);
   }
 
   /*!
@@ -186,53 +117,7 @@ public:
       \return  the value of the index
    */
   JMBDEMODELS_EXPORT auto getLastUpdateIndex() const -> int {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::ChipCardDoor::LastUpdate);
   }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("chip_card_door");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-      \brief The value of the ChipCardDoorIdIndex
-  */
-  int m_ChipCardDoorIdIndex{0};
-
-  /*!
-      \brief The value of the NumberIndex
-  */
-  int m_NumberIndex{0};
-
-  /*!
-      \brief The value of the PlaceIdIndex
-  */
-  int m_PlaceIdIndex{0};
-
-  /*!
-      \brief The value of the DepartmetIdIndex
-  */
-  int m_DepartmetIdIndex{0};
-
-  /*!
-    \brief The value of the EmployeeIdIndex
-*/
-  int m_EmployeeIdIndex{0};
-
-  /*!
-      \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
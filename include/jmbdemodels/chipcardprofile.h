@@ -37,11 +37,13 @@ class ChipCardProfile : public CommonData {
 
 public:
   /*!
-      \fn ChipCardProfile()
+      \fn ChipCardProfile(const QSharedPointer<Model::DataContext> &dataContext = {})
 
       \brief The Constructor for the ChipCardProfile
+      \param dataContext - The DataContext to use, the shared one if null
    */
-  explicit JMBDEMODELS_EXPORT ChipCardProfile();
+  explicit JMBDEMODELS_EXPORT
+  ChipCardProfile(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn ~ChipCardProfile()
@@ -50,78 +52,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~ChipCardProfile() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int ChipCardProfileIdIndex()
 
@@ -131,7 +62,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getChipCardProfileIdIndex() const {
-    return m_ChipCardProfileIdIndex;
+    return this->getFieldIndex(Schema::ChipCardProfile::ChipCardProfileId);
   }
 
   /*!
@@ -141,7 +72,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getNumberIndex() const { return m_NumberIndex; }
+  JMBDEMODELS_EXPORT int getNumberIndex() const {
+    return this->getFieldIndex(Schema::ChipCardProfile::Number);
+  }
 
   /*!
       \fn int ChipCardDoorIdIndex()
@@ -151,7 +84,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getChipCardDoorIdIndex() const {
-    return m_ChipCardDoorIdIndex;
+    return this->getFieldIndex(Schema::ChipCardProfile::ChipCardDoorId);
   }
 
   /*!
@@ -163,7 +96,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getEmployeeIdIndex() const {
-    return m_EmployeeIdIndex;
+    return this->getFieldIndex(Schema::ChipCardProfile::EmployeeId);
   }
 
   /*!
@@ -174,53 +107,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::ChipCardProfile::LastUpdate);
   }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("chip_card_profile");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-     \var int m_ChipCardProfileIdIndex
-     \brief The value of the ChipCardProfileIdIndex
-  */
-  int m_ChipCardProfileIdIndex{0}; ///< int m_ChipCardProfileIdIndex
-
-  /*!
-     \var int m_NumberIndex
-     \brief The value of the NumberIndex
-  */
-  int m_NumberIndex{0}; ///< int m_NumberIndex
-
-  /*!
-     \var int m_ChipCardDoorIdIndex
-     \brief The value of the ChipCardDoorIdIndex
-  */
-  int m_ChipCardDoorIdIndex{0}; ///< int m_ChipCardDoorIdIndex
-
-  /*!
-     \var int m_EmployeeIdIndex
-     \brief The value of the EmployeeIdIndex
-  */
-  int m_EmployeeIdIndex{0}; ///< int m_EmployeeIdIndex
-
-  /*!
-     \var int  m_LastUpdateIndex
-     \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0}; ///< int m_LastUpdateIndex
 };
 } // namespace Model
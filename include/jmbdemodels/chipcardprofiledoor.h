@@ -38,11 +38,13 @@ class ChipCardProfileDoor : public CommonData {
 
 public:
   /*!
-      \fn ChipCardProfileDoor()
+      \fn ChipCardProfileDoor(const QSharedPointer<Model::DataContext> &dataContext = {})
 
       \brief Constructor for the ChipCardProfileDoor
+      \param dataContext - The DataContext to use, the shared one if null
    */
-  explicit JMBDEMODELS_EXPORT ChipCardProfileDoor();
+  explicit JMBDEMODELS_EXPORT
+  ChipCardProfileDoor(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
    * \fn ~ChipCardProfileDoor() override;
@@ -51,78 +53,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~ChipCardProfileDoor() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int ChipCardProfileDoorIdIndex()
 
@@ -132,7 +63,8 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getChipCardProfileDoorIdIndex() const {
-    return m_ChipCardProfileDoorIdIndex;
+    return this->getFieldIndex(
+        Schema::ChipCardProfileDoor::ChipCardProfileDoorId);
   }
 
   /*!
@@ -144,7 +76,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getChipCardProfileIdIndex() const {
-    return m_ChipCardProfileIdIndex;
+    return this->getFieldIndex(Schema::ChipCardProfileDoor::ChipCardProfileId);
   }
 
   /*!
@@ -155,7 +87,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getChipCardDoorsIdIndex() const {
-    return m_ChipCardDoorsIdIndex;
+    return this->getFieldIndex(Schema::ChipCardProfileDoor::ChipCardDoorId);
   }
 
   /*!
@@ -166,43 +98,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::ChipCardProfileDoor::LastUpdate);
   }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("chip_card_profile_door");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-      \brief The value of the ChipCardProfileDoorIdIndex
-   */
-  int m_ChipCardProfileDoorIdIndex{0};
-
-  /*!
-      \brief The value of the ChipCardProfileIdIndex
-   */
-  int m_ChipCardProfileIdIndex{0};
-
-  /*!
-      \brief The value of the ChipCardDoorsIdIndex
-   */
-  int m_ChipCardDoorsIdIndex{0};
-
-  /*!
-       \brief The value of the LastUpdateIndex
-   */
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
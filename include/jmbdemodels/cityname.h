@@ -37,11 +37,13 @@ class CityName : public CommonData {
 
 public:
   /*!
-      \fn CityName()
+      \fn CityName(const QSharedPointer<Model::DataContext> &dataContext = {})
 
       \brief The Constructor of the CityName
+      \param dataContext - The DataContext to use, the shared one if null
    */
-  explicit JMBDEMODELS_EXPORT CityName();
+  explicit JMBDEMODELS_EXPORT
+  CityName(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
    * \fn ~CityName() override
@@ -50,78 +52,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~CityName() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int CityNameIdIndex()
 
@@ -130,7 +61,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getCityNameIdIndex() const {
-    return m_CityNameIdIndex;
+    return this->getFieldIndex(Schema::CityName::CityNameId);
   }
 
   /*!
@@ -140,7 +71,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getNameIndex() const { return m_NameIndex; }
+  JMBDEMODELS_EXPORT int getNameIndex() const {
+    return this->getFieldIndex(Schema::CityName::Name);
+  }
 
   /*!
       \fn  int LastUpdateIndex()
@@ -150,38 +83,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::CityName::LastUpdate);
   }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("city_name");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-       \brief The value of the CityNameIdIndex
-   */
-  int m_CityNameIdIndex{0};
-
-  /*!
-      \brief The value of the NameIndex
-  */
-  int m_NameIndex{0};
-
-  /*!
-       \brief The value of the LastUpdateIndex
-   */
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
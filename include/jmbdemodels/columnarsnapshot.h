@@ -0,0 +1,281 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QDate>
+#include <QDateTime>
+#include <QPair>
+#include <QSqlDatabase>
+#include <QString>
+#include <QStringList>
+#include <QVariant>
+#include <QVariantList>
+#include <QVector>
+
+#include <cstddef>
+#include <vector>
+
+#include "tabledescriptor.h"
+
+#include "jmbdemodels_export.h"
+
+namespace Model {
+/*!
+    \class Bitmap
+    \brief One bit per row, e.g. a boolean column or the rows of a filter
+    \details The bits are packed into 64 bit words, so the set operations
+             and count() work on 64 rows per step.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+class Bitmap {
+public:
+  Bitmap() = default;
+
+  /*!
+      \fn Bitmap(std::size_t size, bool value = false)
+
+      \brief Create a bitmap of size bits, all set to value
+   */
+  explicit JMBDEMODELS_EXPORT Bitmap(std::size_t size, bool value = false);
+
+  JMBDEMODELS_EXPORT auto size() const -> std::size_t { return m_size; }
+
+  JMBDEMODELS_EXPORT auto isEmpty() const -> bool { return m_size == 0; }
+
+  JMBDEMODELS_EXPORT auto test(std::size_t index) const -> bool {
+    return ((m_words[index >> 6] >> (index & 63)) & 1U) != 0;
+  }
+
+  JMBDEMODELS_EXPORT void set(std::size_t index, bool value = true) {
+    const quint64 mask = quint64(1) << (index & 63);
+    if (value) {
+      m_words[index >> 6] |= mask;
+    } else {
+      m_words[index >> 6] &= ~mask;
+    }
+  }
+
+  /*!
+      \fn void append(bool value)
+
+      \brief Add one bit at the end
+   */
+  JMBDEMODELS_EXPORT void append(bool value);
+
+  /*!
+      \fn auto count() const -> std::size_t
+
+      \brief The number of set bits
+   */
+  JMBDEMODELS_EXPORT auto count() const -> std::size_t;
+
+  JMBDEMODELS_EXPORT auto operator&=(const Bitmap &other) -> Bitmap &;
+  JMBDEMODELS_EXPORT auto operator|=(const Bitmap &other) -> Bitmap &;
+  JMBDEMODELS_EXPORT auto operator~() const -> Bitmap;
+
+  JMBDEMODELS_EXPORT auto words() const -> const std::vector<quint64> & {
+    return m_words;
+  }
+
+  /*!
+      \fn void setWord(std::size_t index, quint64 word)
+
+      \brief Set the bits index * 64 to index * 64 + 63 at once
+   */
+  JMBDEMODELS_EXPORT void setWord(std::size_t index, quint64 word) {
+    m_words[index] = word;
+  }
+
+private:
+  std::vector<quint64> m_words;
+  std::size_t m_size{0};
+};
+
+JMBDEMODELS_EXPORT auto operator&(Bitmap left, const Bitmap &right) -> Bitmap;
+JMBDEMODELS_EXPORT auto operator|(Bitmap left, const Bitmap &right) -> Bitmap;
+
+/*!
+    \class ColumnarSnapshot
+    \brief A read only copy of a table, stored column by column
+    \details Every column of the descriptor is loaded into one contiguous
+             vector:
+             - integers, dates (julian day) and timestamps (msecs since
+               epoch) into qint64 values
+             - reals into doubles
+             - booleans into a Bitmap
+             - strings and foreign keys into dictionary codes; code 0 is NULL
+             Blobs are not loaded. NULL values are marked in a Bitmap per
+             column.
+
+             The filters return a Bitmap of the matching rows; combine them
+             with & and |. The aggregates take such a Bitmap as selection,
+             an empty one selects all rows.
+             All of them are plain loops over the vectors that the compiler
+             can vectorize.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+class ColumnarSnapshot {
+public:
+  /*!
+      \brief One column of the snapshot
+   */
+  struct Column {
+    QString name;
+    ColumnType type{ColumnType::Integer};
+    bool foreignKey{false};
+    bool loaded{true};
+
+    std::vector<qint64> integers;
+    std::vector<double> reals;
+    Bitmap booleans;
+
+    // Dictionary encoded values: strings or foreign keys
+    std::vector<quint32> codes;
+    QStringList strings;
+    std::vector<qint64> keys;
+
+    Bitmap nulls;
+
+    auto isDictionary() const -> bool {
+      return type == ColumnType::Text || foreignKey;
+    }
+  };
+
+  ColumnarSnapshot() = default;
+
+  /*!
+      \fn static auto fromTable(const QSqlDatabase &db,
+                                const TableDescriptor &table,
+                                const QString &where = {},
+                                const QVariantList &binds = {})
+                -> ColumnarSnapshot
+
+      \brief Read the table into a snapshot
+      \param where - An optional condition with ? placeholders
+      \param binds - The values for the placeholders
+   */
+  static JMBDEMODELS_EXPORT auto fromTable(const QSqlDatabase &db,
+                                           const TableDescriptor &table,
+                                           const QString &where = {},
+                                           const QVariantList &binds = {})
+      -> ColumnarSnapshot;
+
+  JMBDEMODELS_EXPORT auto isValid() const -> bool { return m_error.isEmpty(); }
+  JMBDEMODELS_EXPORT auto lastError() const -> QString { return m_error; }
+
+  JMBDEMODELS_EXPORT auto rowCount() const -> std::size_t { return m_rows; }
+  JMBDEMODELS_EXPORT auto columnCount() const -> int {
+    return static_cast<int>(m_columns.size());
+  }
+
+  /*!
+      \fn auto column(int column) const -> const Column &
+
+      \brief The column at the position of the descriptor
+   */
+  JMBDEMODELS_EXPORT auto column(int column) const -> const Column & {
+    return m_columns.at(static_cast<std::size_t>(column));
+  }
+
+  /*!
+      \fn auto value(int column, std::size_t row) const -> QVariant
+
+      \brief One value, decoded; for display, not for the kernels
+   */
+  JMBDEMODELS_EXPORT auto value(int column, std::size_t row) const
+      -> QVariant;
+
+  /*!
+      \fn auto all() const -> Bitmap
+
+      \brief A selection of all rows
+   */
+  JMBDEMODELS_EXPORT auto all() const -> Bitmap { return Bitmap(m_rows, true); }
+
+  /*!
+      \fn auto isNull(int column) const -> Bitmap
+
+      \brief The rows where the column is NULL
+   */
+  JMBDEMODELS_EXPORT auto isNull(int column) const -> Bitmap;
+
+  /*!
+      \fn auto isTrue(int column) const -> Bitmap
+
+      \brief The rows where the boolean column is true
+   */
+  JMBDEMODELS_EXPORT auto isTrue(int column) const -> Bitmap;
+
+  /*!
+      \fn auto equals(int column, qint64 value) const -> Bitmap
+
+      \brief The rows where the integer or foreign key column is value
+   */
+  JMBDEMODELS_EXPORT auto equals(int column, qint64 value) const -> Bitmap;
+
+  /*!
+      \fn auto equals(int column, const QString &value) const -> Bitmap
+
+      \brief The rows where the string column is value
+   */
+  JMBDEMODELS_EXPORT auto equals(int column, const QString &value) const
+      -> Bitmap;
+
+  /*!
+      \fn auto between(int column, qint64 low, qint64 high) const -> Bitmap
+
+      \brief The rows where the integer column is in [low, high]
+   */
+  JMBDEMODELS_EXPORT auto between(int column, qint64 low, qint64 high) const
+      -> Bitmap;
+
+  /*!
+      \fn auto between(int column, const QDate &low, const QDate &high) const
+                -> Bitmap
+
+      \brief The rows where the date or timestamp column is in [low, high]
+   */
+  JMBDEMODELS_EXPORT auto between(int column, const QDate &low,
+                                  const QDate &high) const -> Bitmap;
+
+  /*!
+      \fn auto countBy(int column, const Bitmap &selection = Bitmap()) const
+                -> QVector<QPair<QVariant, qint64>>
+
+      \brief Count the selected rows per value of a dictionary column
+      \details The groups with no selected row are left out; the NULL group
+               has an invalid QVariant as key.
+   */
+  JMBDEMODELS_EXPORT auto countBy(int column,
+                                  const Bitmap &selection = Bitmap()) const
+      -> QVector<QPair<QVariant, qint64>>;
+
+  /*!
+      \fn auto sum(int column, const Bitmap &selection = Bitmap()) const
+                -> double
+
+      \brief The sum of the selected non NULL values of a number column
+   */
+  JMBDEMODELS_EXPORT auto sum(int column,
+                              const Bitmap &selection = Bitmap()) const
+      -> double;
+
+private:
+  std::vector<Column> m_columns;
+  std::size_t m_rows{0};
+  QString m_error;
+};
+} // namespace Model
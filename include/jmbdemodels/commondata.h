@@ -7,8 +7,11 @@
 
 #pragma once
 
+#include <QFuture>
+#include <QFutureWatcher>
 #include <QLoggingCategory>
 #include <QObject>
+#include <QSharedPointer>
 #include <QSqlDatabase>
 #include <QSqlError>
 #include <QSqlQuery>
@@ -16,8 +19,13 @@
 #include <QTextDocument>
 #include <QtSql>
 
-#include "commondata.h"
+#include "blobstream.h"
+#include "columnarsnapshot.h"
 #include "datacontext.h"
+#include "lazyblobtablemodel.h"
+#include "reportwriter.h"
+#include "resultset.h"
+#include "schema.h"
 
 #include "jmbdemodels_export.h"
 
@@ -39,11 +47,16 @@ class CommonData : public QAbstractTableModel {
 
 public:
   /*!
-      \fn  CommonData()
+      \fn CommonData(const TableDescriptor &table,
+                     const QSharedPointer<Model::DataContext> &dataContext)
       \brief The Constructor for the CommonData
+      \details Creates the model for the table and resolves its field indexes.
+      \param table - The descriptor of the table, one of Model::Schema
+      \param dataContext - The DataContext to use, the shared one if null
    */
-  explicit JMBDEMODELS_EXPORT CommonData()
-      : m_model(nullptr), m_selectionModel(nullptr) {}
+  explicit JMBDEMODELS_EXPORT
+  CommonData(const TableDescriptor &table,
+             const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn ~CommonData()
@@ -55,16 +68,22 @@ public:
   /*!
       \fn virtual void setIndexes()
       \brief Set the fieldindexes from the datafieldnames of the db.
+      \details The indexes are looked up once per database and table and
+               shared by all instances.
    */
-  virtual JMBDEMODELS_EXPORT void setIndexes() = 0;
+  virtual JMBDEMODELS_EXPORT void setIndexes();
 
   /*!
       \fn virtual QSqlRelationalTableModel *initializeRelationalModel() final
       \brief set the QSqlRelationalTableModel for the DataModel
+      \details Every foreign key of the table descriptor gets a QSqlRelation
+               to the referenced table. It shows the name column of that
+               table, its first text column or its primary key. Rows without
+               a referenced row are kept.
       \return The QSqlRelationalTableModel
    */
   virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * = 0;
+      -> QSqlRelationalTableModel *;
 
   /*!
       \fn virtual QSqlRelationalTableModel *initializeInputDataModel() final
@@ -73,7 +92,7 @@ public:
        \return The QSqlRelationalTableModel
    */
   virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * = 0;
+      -> QSqlRelationalTableModel *;
 
   /*!
       \fn virtual QSqlTableModel *initializeViewModel() final
@@ -81,33 +100,163 @@ public:
 
       \return QSqlTableModel
    */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel() -> QSqlTableModel * = 0;
+  virtual JMBDEMODELS_EXPORT auto initializeViewModel() -> QSqlTableModel *;
 
   /*!
       \fn QSqlTableModel *initializeListModel();
       \brief Initiallize the list Model for select one dataset
   */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel() -> QSqlTableModel * = 0;
+  virtual JMBDEMODELS_EXPORT auto initializeListModel() -> QSqlTableModel *;
 
   /*!
-   * \fn virtual auto generateTableString(
-                              const QString &header) final
-      \brief generateTableString
+      \fn virtual auto generateTableString(const QString &header) -> QString
+      \brief Generate the HTML table of all rows for the printer
+      \details Builds the whole table in memory; use writeReport() to stream
+               large tables to a file.
 
       \return a QString with the generated Table for Output
    */
   virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString = 0;
+      -> QString;
 
   /*!
-      \fn virtual auto generateFormularString(
-                                 const QString &header) final
+      \fn virtual auto generateFormularString(const QString &header) -> QString
       \brief generateFormularString
 
       \return a QString with the generated Table for Output
    */
   virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString = 0;
+      -> QString;
+
+  /*!
+      \fn auto writeReport(QIODevice *device, ReportWriter::Format format,
+                           const QString &header, const QString &where = {},
+                           const QVariantList &binds = {}) -> bool
+      \brief Stream the rows of the table as a report to the device
+      \details The rows are read with a forward only query and written one
+               by one, so the memory use does not depend on the table size.
+               Blob columns are left out.
+      \param device - The open device to write to
+      \param format - HTML, CSV or JSON
+      \param header - The title of the report
+      \param where - An optional condition with ? placeholders
+      \param binds - The values for the placeholders
+
+      \return false if the query or the device failed
+   */
+  JMBDEMODELS_EXPORT auto writeReport(QIODevice *device,
+                                      ReportWriter::Format format,
+                                      const QString &header,
+                                      const QString &where = {},
+                                      const QVariantList &binds = {}) -> bool;
+
+  /*!
+      \fn auto getTableName() const -> QString
+      \brief Get the name of the table in the database
+   */
+  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
+    return QLatin1String(this->m_table->name);
+  }
+
+  /*!
+      \fn auto getDB() const -> QSqlDatabase
+      \brief Get the connection of the model
+   */
+  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
+
+  /*!
+      \fn auto getTable() const -> const TableDescriptor &
+      \brief Get the descriptor of the table
+   */
+  JMBDEMODELS_EXPORT auto getTable() const -> const TableDescriptor & {
+    return *this->m_table;
+  }
+
+  /*!
+      \fn auto getFieldIndex(int column) const -> int
+      \brief Get the index of a field in the model
+      \param column - The position of the column in the descriptor, one of
+                      the Column enum of the table in Model::Schema
+
+      \return the index or -1 if the database has no such field
+   */
+  JMBDEMODELS_EXPORT auto getFieldIndex(int column) const -> int {
+    return this->m_indexes.value(column, -1);
+  }
+
+  /*!
+      \fn auto snapshot(const QString &where = {},
+                        const QVariantList &binds = {}) const
+                -> ColumnarSnapshot
+      \brief Read the table into a columnar snapshot for aggregations
+      \param where - An optional condition with ? placeholders
+      \param binds - The values for the placeholders
+   */
+  JMBDEMODELS_EXPORT auto snapshot(const QString &where = {},
+                                   const QVariantList &binds = {}) const
+      -> ColumnarSnapshot {
+    return ColumnarSnapshot::fromTable(this->m_db, *this->m_table, where,
+                                       binds);
+  }
+
+  /*!
+      \fn auto cursor(const QString &where = {},
+                      const QVariantList &binds = {}) const -> Cursor
+      \brief Read the rows of the table one by one, without the model
+      \details The columns are in the order of the table descriptor, so
+               Schema::<Table>::<Column> is the position for value(). Use it
+               for scans over large tables; select() keeps every row.
+      \param where - An optional condition with ? placeholders
+      \param binds - The values for the placeholders
+   */
+  JMBDEMODELS_EXPORT auto cursor(const QString &where = {},
+                                 const QVariantList &binds = {}) const
+      -> Cursor {
+    return Cursor(this->m_db, this->selectStatement(where, Blobs::Select),
+                  binds,
+                  this->m_dataContext->getFetchSize());
+  }
+
+  /*!
+      \fn auto readBlob(int column, qint64 id, QIODevice *device) -> qint64
+      \brief Copy a BLOB value, e.g. a document or photo, to the device
+      \details The value is copied in chunks, see BlobStream. The list and
+               view models select the BLOB columns as NULL.
+      \param column - The position of the column in the descriptor
+      \param id - The primary key of the row
+
+      \return the number of bytes copied, -1 on an error
+   */
+  JMBDEMODELS_EXPORT auto readBlob(int column, qint64 id, QIODevice *device)
+      -> qint64;
+
+  /*!
+      \fn auto writeBlob(int column, qint64 id, QIODevice *device,
+                         qint64 size = -1) -> bool
+      \brief Replace a BLOB value with the content of the device
+      \param size - The bytes to copy; -1 for the rest of the device
+   */
+  JMBDEMODELS_EXPORT auto writeBlob(int column, qint64 id, QIODevice *device,
+                                    qint64 size = -1) -> bool;
+
+  /*!
+      \fn auto changesSince(const QDateTime &since = QDateTime()) const
+                -> ChangeSet
+      \brief The rows of the table changed after the watermark
+      \details See DataContext::changesSince(); pass the watermark of the
+               result to the next call.
+   */
+  JMBDEMODELS_EXPORT auto changesSince(const QDateTime &since = QDateTime())
+      const -> ChangeSet {
+    return this->m_dataContext->changesSince(*this->m_table, since);
+  }
+
+  /*!
+      \fn static void clearIndexCache()
+      \brief Forget the field indexes of all tables
+      \details Call it after the schema of a database was changed.
+   */
+  static JMBDEMODELS_EXPORT void clearIndexCache();
 
   /*!
       \fn  QTextDocument *createSheet()
@@ -140,35 +289,138 @@ public:
    */
   static JMBDEMODELS_EXPORT QString setOutFormularStyle();
 
-  JMBDEMODELS_EXPORT int
-  rowCount(const QModelIndex & = QModelIndex()) const override {
-    return 200;
+  /*!
+      \fn auto selectAsync() -> QFuture<ResultSet>
+      \brief Read the table on the database worker thread
+      \details The filter of the model is used, the BLOB columns are read
+               as NULL, see readBlob(). When the future is finished,
+               the rows are shown by the item model interface of this class
+               and selectFinished() is emitted.
+
+      \return the future with the rows of the table
+      \sa DataContext::execAsync()
+   */
+  JMBDEMODELS_EXPORT auto selectAsync() -> QFuture<ResultSet>;
+
+  /*!
+      \fn auto getResultSet() const -> const ResultSet &
+      \brief Get the rows of the last selectAsync()
+   */
+  JMBDEMODELS_EXPORT auto getResultSet() const -> const ResultSet & {
+    return m_resultSet;
   }
 
+  /*!
+      \fn int rowCount(const QModelIndex &parent = QModelIndex()) const
+      \brief The number of rows fetched from the table so far
+   */
   JMBDEMODELS_EXPORT int
-  columnCount(const QModelIndex & = QModelIndex()) const override {
-    return 200;
-  }
+  rowCount(const QModelIndex &parent = QModelIndex()) const override;
+
+  /*!
+      \fn int columnCount(const QModelIndex &parent = QModelIndex()) const
+      \brief The number of fields of the table
+   */
+  JMBDEMODELS_EXPORT int
+  columnCount(const QModelIndex &parent = QModelIndex()) const override;
 
+  /*!
+      \fn QVariant data(const QModelIndex &index, int role) const
+      \brief The value of a field
+      \details The display and edit roles return the field in the column of
+               the index. The roles from roleNames() return the named field
+               of the row, so a QML delegate can read a row by field name.
+   */
   JMBDEMODELS_EXPORT QVariant data(const QModelIndex &index,
-                                   int role) const override {
-    switch (role) {
-    case Qt::DisplayRole:
-      return QString(QLatin1String("%1, %2"))
-          .arg(index.column())
-          .arg(index.row());
-    default:
-      break;
-    }
-
-    return QVariant();
-  }
+                                   int role) const override;
 
-  JMBDEMODELS_EXPORT QHash<int, QByteArray> roleNames() const override {
-    return {{Qt::DisplayRole, "display"}};
-  }
+  JMBDEMODELS_EXPORT QVariant headerData(int section,
+                                         Qt::Orientation orientation,
+                                         int role) const override;
+
+  /*!
+      \fn bool canFetchMore(const QModelIndex &parent) const
+      \brief true if the table has rows that are not fetched yet
+   */
+  JMBDEMODELS_EXPORT bool
+  canFetchMore(const QModelIndex &parent) const override;
+
+  /*!
+      \fn void fetchMore(const QModelIndex &parent)
+      \brief Fetch the next block of rows when a view scrolls to the end
+   */
+  JMBDEMODELS_EXPORT void fetchMore(const QModelIndex &parent) override;
+
+  /*!
+      \fn QHash<int, QByteArray> roleNames() const
+      \brief One role per field of the table
+      \details Qt::UserRole + 1 + the field index is named like the field
+               of the table, also for a column with a relation.
+   */
+  JMBDEMODELS_EXPORT QHash<int, QByteArray> roleNames() const override;
+
+  /*!
+      \fn auto release() -> bool
+      \brief Drop the rows that are cached by the models
+      \details The models stay valid and keep their table, filter and
+               relations; they are empty until the next select(). Call it
+               when a screen is closed to give the memory back.
+
+               A model with pending changes is left as it is, the changes
+               are neither submitted nor dropped. Submit or revert them
+               first to release it.
+
+      \return false if a model was kept for its pending changes
+   */
+  JMBDEMODELS_EXPORT auto release() -> bool;
+
+signals:
+  /*!
+      \fn void selectFinished()
+      \brief Emitted when the rows of selectAsync() are available
+   */
+  JMBDEMODELS_EXPORT void selectFinished();
 
 protected:
+  /*!
+      \brief holds the DataContext of the model
+   */
+  QSharedPointer<Model::DataContext> m_dataContext;
+
+  /*!
+      \brief holds the connection of the model
+   */
+  QSqlDatabase m_db;
+
+  /*!
+      \fn void setModel(QSqlRelationalTableModel *model)
+      \brief Set the model whose rows this class shows
+      \details The signals of the model are forwarded, so views bound to
+               this class follow selects, inserts and removes of the model.
+   */
+  JMBDEMODELS_EXPORT void setModel(QSqlRelationalTableModel *model);
+
+  /*!
+      \fn auto resetModel(const QString &tableName) -> QSqlRelationalTableModel *
+      \brief Get the model in the state of a new one for the table
+      \details The model is created on the first call and reused after that.
+               Pending changes, cached rows, filter and relations are dropped.
+
+      \return the model, it is owned by this class
+   */
+  JMBDEMODELS_EXPORT auto resetModel(const QString &tableName)
+      -> QSqlRelationalTableModel *;
+
+  /*!
+      \fn auto resetListModel(const QString &tableName) -> QSqlTableModel *
+      \brief Get the model to select one dataset of the table
+      \details Like resetModel(), the list model is created once and reused.
+
+      \return the model, it is owned by this class
+   */
+  JMBDEMODELS_EXPORT auto resetListModel(const QString &tableName)
+      -> QSqlTableModel *;
+
   /*!
       \brief holds an initialised pointer to the Relationmodel
       \sa QSqlRelationalTableModel
@@ -181,7 +433,72 @@ protected:
   */
   QItemSelectionModel *m_selectionModel{nullptr};
 
+  /*!
+     \brief holds the model of initializeListModel()
+     \sa QSqlTableModel
+  */
+  QSqlTableModel *m_listModel{nullptr};
+
 private:
-  int m_LastUpdateIndex{0};
+  /*!
+      \brief How selectStatement() reads the BLOB columns
+   */
+  enum class Blobs { Select, Skip, AsNull };
+
+  /*!
+      \brief SELECT the columns of the descriptor FROM the table WHERE where
+      \details Blobs::AsNull keeps the positions of the columns.
+   */
+  auto selectStatement(const QString &where, Blobs blobs) const -> QString;
+
+  /*!
+      \brief Reload the row of the model that another writer changed
+      \details An update reloads the one row, found by its primary key,
+               an insert or delete selects again, once for all the signals
+               of a commit. A model with pending changes is left alone.
+   */
+  void refreshRow(const QString &table, qint64 rowId,
+                  Model::RowOperation operation);
+
+  /*!
+     \brief the descriptor of the table
+  */
+  const TableDescriptor *m_table;
+
+  /*!
+     \brief the field index of every column of the descriptor
+  */
+  QVector<int> m_indexes;
+
+  /*!
+     \brief holds the rows of the last selectAsync()
+  */
+  ResultSet m_resultSet;
+
+  /*!
+     \brief true if a selectAsync() has finished
+  */
+  bool m_hasResultSet{false};
+
+  /*!
+     \brief true while a select() for inserted or deleted rows is queued
+  */
+  bool m_selectQueued{false};
+
+  /*!
+     \brief the row of the model for every fetched primary key
+  */
+  QHash<qint64, int> m_rowByKey;
+
+  /*!
+     \brief false after the rows of the model changed, m_rowByKey is built
+            again on the next update
+  */
+  bool m_rowByKeyValid{false};
+
+  /*!
+     \brief the roles of the fields, built on first use
+  */
+  mutable QHash<int, QByteArray> m_roleNames;
 };
 } // namespace Model
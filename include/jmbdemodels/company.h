@@ -38,11 +38,13 @@ class Company : public CommonData {
 
 public:
   /*!
-      \fn Company()
+      \fn Company(const QSharedPointer<Model::DataContext> &dataContext = {})
 
       \brief Constructor for the Company
+      \param dataContext - The DataContext to use, the shared one if null
    */
-  explicit JMBDEMODELS_EXPORT Company();
+  explicit JMBDEMODELS_EXPORT
+  Company(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
    * \fn   ~Company() override;
@@ -51,78 +53,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~Company() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int getCompanyIdIndex()
 
@@ -130,7 +61,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getCompanyIdIndex() const { return m_CompanyIdIndex; }
+  JMBDEMODELS_EXPORT int getCompanyIdIndex() const {
+    return this->getFieldIndex(Schema::Company::CompanyId);
+  }
 
   /*!
       \fn int getNameIndex()
@@ -139,7 +72,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getNameIndex() const { return m_NameIndex; }
+  JMBDEMODELS_EXPORT int getNameIndex() const {
+    return this->getFieldIndex(Schema::Company::Name);
+  }
 
   /*!
       \fn int getName2Index()
@@ -148,7 +83,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getName2Index() const { return m_Name2Index; }
+  JMBDEMODELS_EXPORT int getName2Index() const {
+    return this->getFieldIndex(Schema::Company::Name2);
+  }
 
   /*!
       \fn int getStreetIndex()
@@ -157,7 +94,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getStreetIndex() const { return m_StreetIndex; }
+  JMBDEMODELS_EXPORT int getStreetIndex() const {
+    return this->getFieldIndex(Schema::Company::Street);
+  }
 
   /*!
       \fn int getCityIndex()
@@ -166,7 +105,9 @@ public:
 
       Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getCityIndex() const { return m_CityIndex; }
+  JMBDEMODELS_EXPORT int getCityIndex() const {
+    return this->getFieldIndex(Schema::Company::City);
+  }
 
   /*!
       \fn int getZipCodeIndex()
@@ -175,7 +116,9 @@ public:
 
       Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getZipCodeIndex() const { return m_ZipCodeIndex; }
+  JMBDEMODELS_EXPORT int getZipCodeIndex() const {
+    return this->getFieldIndex(Schema::Company::ZipCode);
+  }
 
   /*!
       \fn int getPhoneNumberIndex()
@@ -185,7 +128,7 @@ public:
       Returns the value of the index
   */
   JMBDEMODELS_EXPORT int getPhoneNumberIndex() const {
-    return m_PhoneNumberIndex;
+    return this->getFieldIndex(Schema::Company::PhoneNumber);
   }
 
   /*!
@@ -195,7 +138,9 @@ public:
 
       Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getFaxNumberIndex() const { return m_FaxNumberIndex; }
+  JMBDEMODELS_EXPORT int getFaxNumberIndex() const {
+    return this->getFieldIndex(Schema::Company::FaxNumber);
+  }
 
   /*!
       \fn int getMobileNumberIndex()
@@ -205,7 +150,7 @@ public:
       Returns the value of the index
   */
   JMBDEMODELS_EXPORT int getMobileNumberIndex() const {
-    return m_MobileNumberIndex;
+    return this->getFieldIndex(Schema::Company::MobileNumber);
   }
 
   /*!
@@ -216,7 +161,7 @@ public:
       Returns the value of the index
   */
   JMBDEMODELS_EXPORT int getMailAddressIndex() const {
-    return m_MailAddressIndex;
+    return this->getFieldIndex(Schema::Company::MailAddress);
   }
 
   /*!
@@ -226,7 +171,9 @@ public:
 
       Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getActiveIndex() const { return m_ActiveIndex; }
+  JMBDEMODELS_EXPORT int getActiveIndex() const {
+    return this->getFieldIndex(Schema::Company::Active);
+  }
 
   /*!
       \fn int getEmployeeIdIndex()
@@ -236,7 +183,7 @@ public:
        Returns the value of the index
   */
   JMBDEMODELS_EXPORT int getEmployeeIdIndex() const {
-    return m_EmployeeIdIndex;
+    return this->getFieldIndex(Schema::Company::EmployeeId);
   }
 
   /*!
@@ -247,34 +194,7 @@ public:
           Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::Company::LastUpdate);
   }
-
-private:
-  const QString m_tableName = QLatin1String("company"); ///< QString m_tableName
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  int m_CompanyIdIndex{0};    ///< int CompanyIdIndex
-  int m_NameIndex{0};         ///< int NameIndex
-  int m_Name2Index{0};        ///< int Name2Index
-  int m_StreetIndex{0};       ///< int m_StreetIndex
-  int m_CityIndex{0};         ///< int CityIndex
-  int m_ZipCodeIndex{0};      ///< int ZipCodeIndex
-  int m_PhoneNumberIndex{0};  ///< int PhoneNumberIndex
-  int m_FaxNumberIndex{0};    ///< int FaxNumberIndex
-  int m_MobileNumberIndex{0}; ///< int MobileNumberIndex
-  int m_MailAddressIndex{0};  ///< int MailAddressIndex
-  int m_ActiveIndex{0};       ///< int ActiveIndex
-  int m_EmployeeIdIndex{0};   ///< int EmployeeIdIndex
-  int m_LastUpdateIndex{0};   ///< int LastUpdateIndex
 };
 } // namespace Model
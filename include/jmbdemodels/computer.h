@@ -37,11 +37,13 @@ class Computer : public CommonData {
 
 public:
   /*!
-      \fn Computer()
+      \fn Computer(const QSharedPointer<Model::DataContext> &dataContext = {})
 
       \brief Constructor for the Account
+      \param dataContext - The DataContext to use, the shared one if null
    */
-  explicit JMBDEMODELS_EXPORT Computer();
+  explicit JMBDEMODELS_EXPORT
+  Computer(const QSharedPointer<Model::DataContext> &dataContext = {});
   /*!
       \fn  ~Computer() override;
 
@@ -49,79 +51,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~Computer() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int getComputerIdIndex()
 
@@ -130,7 +60,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getComputerIdIndex() const {
-    return m_ComputerIdIndex;
+    return this->getFieldIndex(Schema::Computer::ComputerId);
   }
 
   /*!
@@ -141,7 +71,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getDeviceNameIdIndex() const {
-    return m_DeviceNameIdIndex;
+    return this->getFieldIndex(Schema::Computer::DeviceNameId);
   }
 
   /*!
@@ -152,7 +82,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getSerialNumberIndex() const {
-    return m_SerialNumberIndex;
+    return this->getFieldIndex(Schema::Computer::SerialNumber);
   }
 
   /*!
@@ -163,7 +93,7 @@ public:
      Returns the value of the index
   */
   JMBDEMODELS_EXPORT int getServiceTagIndex() const {
-    return m_ServiceTagIndex;
+    return this->getFieldIndex(Schema::Computer::ServiceTag);
   }
 
   /*!
@@ -174,7 +104,7 @@ public:
      Returns the value of the index
   */
   JMBDEMODELS_EXPORT int getServiceNumberIndex() const {
-    return m_ServiceNumberIndex;
+    return this->getFieldIndex(Schema::Computer::ServiceNumber);
   }
 
   /*!
@@ -184,7 +114,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getMemoryIndex() const { return m_MemoryIndex; }
+  JMBDEMODELS_EXPORT int getMemoryIndex() const {
+    return this->getFieldIndex(Schema::Computer::Memory);
+  }
 
   /*!
       \fn int getNetworkIndex()
@@ -193,7 +125,9 @@ public:
 
           Returns the value of the index
               */
-  JMBDEMODELS_EXPORT int getNetworkIndex() const { return m_NetworkIndex; }
+  JMBDEMODELS_EXPORT int getNetworkIndex() const {
+    return this->getFieldIndex(Schema::Computer::Network);
+  }
 
   /*!
       \fn int getNetworkNameIndex()
@@ -201,7 +135,7 @@ public:
       \brief Get the index of the fieldname Network_Name from the database
   */
   JMBDEMODELS_EXPORT int getNetworkNameIndex() const {
-    return m_NetworkNameIndex;
+    return this->getFieldIndex(Schema::Computer::NetworkName);
   }
 
   /*!
@@ -210,11 +144,11 @@ public:
   \brief Get the index of the fieldname network_ip_address from the database
           */
   JMBDEMODELS_EXPORT int getNetworkIPAddressIndex() const {
-    return m_NetworkIPAddressIndex;
+    return this->getFieldIndex(Schema::Computer::NetworkIpAddress);
   }
 
   JMBDEMODELS_EXPORT int getNetworkIpAddressIndex() const {
-    return m_NetworkIpAddressIndex;
+    return this->getFieldIndex(Schema::Computer::NetworkIpAddress);
   }
 
   /*!
@@ -224,7 +158,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getActiveIndex() const { return m_ActiveIndex; }
+  JMBDEMODELS_EXPORT int getActiveIndex() const {
+    return this->getFieldIndex(Schema::Computer::Active);
+  }
 
   /*!
       \fn int getReplaceIndex()
@@ -233,7 +169,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getReplaceIndex() const { return m_ReplaceIndex; }
+  JMBDEMODELS_EXPORT int getReplaceIndex() const {
+    return this->getFieldIndex(Schema::Computer::Replace);
+  }
 
   /*!
       \fn int getDeviceTypeIdIndex()
@@ -243,7 +181,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getDeviceTypeIdIndex() const {
-    return m_DeviceTypeIdIndex;
+    return this->getFieldIndex(Schema::Computer::DeviceTypeId);
   }
 
   /*!
@@ -254,7 +192,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getEmployeeIdIndex() const {
-    return m_EmployeeIdIndex;
+    return this->getFieldIndex(Schema::Computer::EmployeeId);
   }
 
   /*!
@@ -264,7 +202,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getPlaceIdIndex() const { return m_PlaceIdIndex; }
+  JMBDEMODELS_EXPORT int getPlaceIdIndex() const {
+    return this->getFieldIndex(Schema::Computer::PlaceId);
+  }
 
   /*!
     \fn int getDepartmentIdIndex()
@@ -274,7 +214,7 @@ public:
     Returns the value of the index
  */
   JMBDEMODELS_EXPORT int getDepartmentIdIndex() const {
-    return m_DepartmentIdIndex;
+    return this->getFieldIndex(Schema::Computer::DepartmentId);
   }
 
   /*!
@@ -285,7 +225,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getManufacturerIdIndex() const {
-    return m_ManufacturerIdIndex;
+    return this->getFieldIndex(Schema::Computer::ManufacturerId);
   }
 
   /*!
@@ -296,7 +236,7 @@ public:
      Returns the value of the index
   */
   JMBDEMODELS_EXPORT int getInventoryIdIndex() const {
-    return m_InventoryIdIndex;
+    return this->getFieldIndex(Schema::Computer::InventoryId);
   }
 
   /*!
@@ -307,7 +247,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getProcessorIdIndex() const {
-    return m_ProcessorIdIndex;
+    return this->getFieldIndex(Schema::Computer::ProcessorId);
   }
 
   /*!
@@ -317,7 +257,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getOSIdIndex() const { return m_OSIdIndex; }
+  JMBDEMODELS_EXPORT int getOSIdIndex() const {
+    return this->getFieldIndex(Schema::Computer::OsId);
+  }
 
   /*!
       \fn int getComputerSoftwareIdIndex()
@@ -328,7 +270,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getComputerSoftwareIdIndex() const {
-    return m_ComputerSoftwareIdIndex;
+    return this->getFieldIndex(Schema::Computer::ComputerSoftwareId);
   }
 
   /*!
@@ -338,7 +280,9 @@ public:
 
      Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getPrinterIdIndex() const { return m_PrinterIdIndex; }
+  JMBDEMODELS_EXPORT int getPrinterIdIndex() const {
+    return this->getFieldIndex(Schema::Computer::PrinterId);
+  }
 
   /*!
       \fn  int getLastUpdateIndex()
@@ -348,163 +292,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::Computer::LastUpdate);
   }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("computer");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-      \var   int m_ComputerIdIndex
-      \brief The value of the ComputerIdIndex
-   */
-  int m_ComputerIdIndex{0};
-
-  /*!
-      \var   int  m_NameIndex
-      \brief The value of the NameIndex
-   */
-  int m_NameIndex{0};
-
-  /*!
-     \var   int m_Name
-     \brief The value of the NameIndex
-  */
-  int m_SerialNumberIndex{0};
-
-  /*!
-     \var   int m_ServiceTagIndex
-     \brief The value of the ServiceTagIndex
-  */
-  int m_ServiceTagIndex{0};
-
-  /*!
-     \var   int m_ServiceNumberIndex
-     \brief The value of the ServiceNumberIndex
-  */
-  int m_ServiceNumberIndex{0};
-
-  /*!
-      \var   int m_MemoryIndex
-      \brief The value of the NameIndex
-   */
-  int m_MemoryIndex{0};
-
-  /*!
-      \var   nt m_NetworkIndex
-      \brief The value of the NetworkIndex
-   */
-  int m_NetworkIndex{0};
-
-  /*!
-      \var   nt m_NetworkNameIndex
-      \brief The value of the NetworkIndex
-   */
-  int m_NetworkNameIndex{0};
-
-  /*!
-      \var   nt m_NetworkIPAddressIndex
-      \brief The value of the NetworkIPAddressIndex
-   */
-  int m_NetworkIPAddressIndex{0};
-
-  int m_NetworkIpAddressIndex{0};
-
-  /*!
-      \var   int m_ActiveIndex
-      \brief The value of the ActiveIndex
-   */
-  int m_ActiveIndex{0};
-
-  /*!
-      \var   int m_ReplaceIndex
-      \brief The value of the ReplaceIndex
-   */
-  int m_ReplaceIndex{0};
-
-  /*!
-      \var   int m_DeviceNameIdIndex
-      \brief The value of the DeviceNameIdIndex
-   */
-  int m_DeviceNameIdIndex{0};
-
-  /*!
-     \var   int m_DeviceTypeIdIndex
-     \brief The value of the DeviceTypeIdIndex
-  */
-  int m_DeviceTypeIdIndex{0};
-
-  /*!
-     \var   int m_EmployeeIdIndex
-     \brief The value of the EmployeeIdIndexx
-  */
-  int m_EmployeeIdIndex{0};
-
-  /*!
-      \var   int m_PlaceIdIndex
-      \brief The value of the NameIndex
-   */
-  int m_PlaceIdIndex{0};
-
-  /*!
-      \var   int m_DepartmentIdIndex
-      \brief The value of the DepartmentIdIndex
-   */
-  int m_DepartmentIdIndex{0};
-
-  /*!
-      \var   int m_ManufacturerIdIndex
-      \brief The value of the ManufacturerIdIndex
-   */
-  int m_ManufacturerIdIndex{0};
-
-  /*!
-     \var   int m_InventoryIdIndex
-     \brief The value of the InventoryIdIndex
-  */
-  int m_InventoryIdIndex{0};
-
-  /*!
-     \var   int m_ProcessorIdIndex
-     \brief The value of the ProcessorIdIndex
-  */
-  int m_ProcessorIdIndex{0};
-
-  /*!
-     \var   int m_OSIdIndex
-     \brief The value of the OSIdIndex
-  */
-  int m_OSIdIndex{0};
-
-  /*!
-      \var   int m_ComputerSoftwareIdIndex
-      \brief The value of the ComputerSoftwareIdIndex
-   */
-  int m_ComputerSoftwareIdIndex{0};
-
-  /*!
-      \var   int m_PrinterIdIndex
-      \brief The value of the PrinterIdIndex
-   */
-  int m_PrinterIdIndex{0};
-
-  /*!
-     \var   int m_LastUpdateIndex
-     \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
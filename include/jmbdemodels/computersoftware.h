@@ -38,11 +38,13 @@ class ComputerSoftware : public CommonData {
 
 public:
   /*!
-      \fn ComputerSoftware()
+      \fn ComputerSoftware(const QSharedPointer<Model::DataContext> &dataContext = {})
 
       \brief Constructor for the ComputerSoftware
+      \param dataContext - The DataContext to use, the shared one if null
    */
-  explicit JMBDEMODELS_EXPORT ComputerSoftware();
+  explicit JMBDEMODELS_EXPORT
+  ComputerSoftware(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn  ~ComputerSoftware() override;
@@ -51,78 +53,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~ComputerSoftware() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int getComputerSoftwareIdIndex()
 
@@ -132,7 +63,7 @@ public:
        Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getComputerSoftwareIdIndex() const {
-    return m_ComputerSoftwareIdIndex;
+    return this->getFieldIndex(Schema::ComputerSoftware::ComputerSoftwareId);
   }
 
   /*!
@@ -143,7 +74,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getComputerIdIndex() const {
-    return m_ComputerIdIndex;
+    return this->getFieldIndex(Schema::ComputerSoftware::ComputerId);
   }
 
   /*!
@@ -154,7 +85,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getSoftwareIdIndex() const {
-    return m_SoftwareIdIndex;
+    return this->getFieldIndex(Schema::ComputerSoftware::SoftwareId);
   }
 
   /*!
@@ -165,47 +96,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::ComputerSoftware::LastUpdate);
   }
-
-private:
-  /*!
-        \brief The Tablename in the database \e is const
-     */
-  const QString m_tableName = QLatin1String("computer_software");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-      \var int m_ComputerSoftwareIdIndex
-      \brief The value of the ComputerSoftwareIdIndex
-  */
-  int m_ComputerSoftwareIdIndex{0};
-
-  /*!
-      \var int m_ComputerIdIndex
-      \brief The value of the ComputerIdIndex
-  */
-  int m_ComputerIdIndex{0};
-
-  /*!
-      \var int m_SoftwareIdIndex
-      \brief The value of the SoftwareIdIndex
-  */
-  int m_SoftwareIdIndex{0};
-
-  /*!
-      \var int m_LastUpdateIndex
-      \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
@@ -0,0 +1,313 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QDeadlineTimer>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QMutex>
+#include <QObject>
+#include <QSqlDatabase>
+#include <QString>
+#include <QStringList>
+#include <QThread>
+#include <QTimer>
+#include <QWaitCondition>
+
+#include "jmbdemodels_export.h"
+
+namespace Model {
+/*!
+    \class ConnectionPool
+    \brief Hands out one clone of a database connection per thread
+    \details Qt allows a QSqlDatabase connection to be used only from the
+             thread that created it. The pool clones the master connection
+             of a DataContext for every worker thread that asks for one, so
+             several readers can query the same database in parallel.
+
+             The thread that owns the pool gets the master connection itself.
+             The number of clones is capped; acquire() waits for a free slot.
+
+             A clone is only closed on its own thread: when it is released
+             and another thread waits, and when its thread finishes. A clone
+             that is idle too long, belongs to a previous master or gives its
+             slot to a waiting thread is only marked stale; its thread drops
+             it on the next acquire() or when it finishes.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+class ConnectionPool : public QObject {
+  Q_OBJECT
+
+public:
+  /*!
+      \fn ConnectionPool(const QSqlDatabase &master, QObject *parent = nullptr)
+
+      \brief Constructor for the ConnectionPool
+      \param master - The connection to clone for the worker threads
+      \param parent - The parent object
+   */
+  explicit JMBDEMODELS_EXPORT ConnectionPool(const QSqlDatabase &master,
+                                             QObject *parent = nullptr);
+
+  /*!
+      \fn ~ConnectionPool()
+
+      \brief Destructor for the ConnectionPool
+      \details The clones of the worker threads are removed when these
+               threads finish.
+   */
+  JMBDEMODELS_EXPORT ~ConnectionPool() override;
+
+  /*!
+      \fn auto acquire(int timeout = -1) -> QSqlDatabase
+
+      \brief Get the connection for the calling thread
+      \details Every call must be paired with release() from the same thread.
+               Nested calls share one connection.
+      \param timeout - Milliseconds to wait for a free slot, -1 waits forever
+
+      \return the open connection, or an invalid one on timeout or error
+   */
+  JMBDEMODELS_EXPORT auto acquire(int timeout = -1) -> QSqlDatabase;
+
+  /*!
+      \fn void release()
+
+      \brief Give back the connection of the calling thread
+   */
+  JMBDEMODELS_EXPORT void release();
+
+  /*!
+      \fn void setMaster(const QSqlDatabase &master)
+
+      \brief Set the connection to clone
+      \details The clones of the previous master are dropped by their
+               threads.
+   */
+  JMBDEMODELS_EXPORT void setMaster(const QSqlDatabase &master);
+
+  /*!
+      \fn void setInitStatements(const QStringList &statements)
+
+      \brief Set the statements that run on every new clone, e.g. PRAGMAs
+   */
+  JMBDEMODELS_EXPORT void setInitStatements(const QStringList &statements);
+
+  /*!
+      \fn void setMaxConnections(int maxConnections)
+
+      \brief Set the maximum number of clones that are open at the same time
+   */
+  JMBDEMODELS_EXPORT void setMaxConnections(int maxConnections);
+
+  /*!
+      \fn auto getMaxConnections() const -> int
+
+      \brief Get the maximum number of clones
+   */
+  JMBDEMODELS_EXPORT auto getMaxConnections() const -> int;
+
+  /*!
+      \fn void setIdleTimeout(int msecs)
+
+      \brief Set the time after which an unused clone is closed
+      \details Call it from the thread that owns the pool.
+   */
+  JMBDEMODELS_EXPORT void setIdleTimeout(int msecs);
+
+  /*!
+      \fn auto getIdleTimeout() const -> int
+
+      \brief Get the time after which an unused clone is closed
+   */
+  JMBDEMODELS_EXPORT auto getIdleTimeout() const -> int;
+
+  /*!
+      \fn auto getOpenConnections() const -> int
+
+      \brief Get the number of clones that hold a slot now
+      \details Stale clones that wait for their thread are not counted.
+   */
+  JMBDEMODELS_EXPORT auto getOpenConnections() const -> int;
+
+  /*!
+      \fn void closeIdleConnections(int minIdleTime = 0)
+
+      \brief Drop all clones that are unused for at least minIdleTime msecs
+      \details The clone of the calling thread is closed, the others are
+               marked stale.
+   */
+  JMBDEMODELS_EXPORT void closeIdleConnections(int minIdleTime = 0);
+
+private:
+  /*!
+      \brief The bookkeeping for one cloned connection
+   */
+  struct Connection {
+    QSqlDatabase db;
+    int useCount{0};
+    bool stale{false};
+    QElapsedTimer idleSince;
+    QMetaObject::Connection finished;
+  };
+
+  /*!
+      \fn void closeConnection(QThread *thread)
+
+      \brief Close and remove the clone of the calling thread, mutex must
+             be held
+   */
+  void closeConnection(QThread *thread);
+
+  /*!
+      \fn void dropConnection(QThread *thread)
+
+      \brief Free the slot of an idle clone, mutex must be held
+      \details The clone of the calling thread is closed, the clone of
+               another thread is moved to the stale ones.
+   */
+  void dropConnection(QThread *thread);
+
+  /*!
+      \fn auto closeOldestIdle() -> bool
+
+      \brief Drop the clone that is unused for the longest time
+
+      \return true if a slot was freed
+   */
+  auto closeOldestIdle() -> bool;
+
+  /*!
+      \fn void threadFinished(QThread *thread)
+
+      \brief Close the clones when their thread ends, called on that thread
+   */
+  void threadFinished(QThread *thread);
+
+  /*!
+      \var QSqlDatabase m_master
+      \brief The connection that is cloned for the worker threads
+   */
+  QSqlDatabase m_master;
+
+  /*!
+      \var QStringList m_initStatements
+      \brief The statements that run on every new clone
+   */
+  QStringList m_initStatements;
+
+  /*!
+      \var QHash<QThread *, Connection> m_connections
+      \brief The clones for every worker thread
+   */
+  QHash<QThread *, Connection> m_connections;
+
+  /*!
+      \var QHash<QThread *, Connection> m_stale
+      \brief The clones without a slot, that their thread has to close
+   */
+  QHash<QThread *, Connection> m_stale;
+
+  /*!
+      \var QMutex m_mutex
+      \brief Guards the clones
+   */
+  mutable QMutex m_mutex;
+
+  /*!
+      \var QWaitCondition m_slotFree
+      \brief Wakes up threads waiting for a free slot
+   */
+  QWaitCondition m_slotFree;
+
+  /*!
+      \var QTimer m_idleTimer
+      \brief Closes the idle clones
+   */
+  QTimer m_idleTimer;
+
+  /*!
+      \var int m_maxConnections
+      \brief The maximum number of clones
+   */
+  int m_maxConnections{0};
+
+  /*!
+      \var int m_idleTimeout
+      \brief The time in msecs after which an unused clone is closed
+   */
+  int m_idleTimeout{30000};
+
+  /*!
+      \var int m_waiting
+      \brief The number of threads waiting for a free slot
+   */
+  int m_waiting{0};
+
+  /*!
+      \var quint64 m_serial
+      \brief Makes the names of the clones unique
+   */
+  quint64 m_serial{0};
+};
+
+/*!
+    \class PooledConnection
+    \brief Holds the connection of the calling thread for one scope
+    \details Acquires the connection from the pool in the constructor and
+             releases it in the destructor.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+class PooledConnection {
+public:
+  /*!
+      \fn PooledConnection(ConnectionPool *pool, int timeout = -1)
+
+      \brief Acquire the connection of the calling thread
+   */
+  explicit JMBDEMODELS_EXPORT PooledConnection(ConnectionPool *pool,
+                                               int timeout = -1);
+
+  /*!
+      \fn ~PooledConnection()
+
+      \brief Release the connection of the calling thread
+   */
+  JMBDEMODELS_EXPORT ~PooledConnection();
+
+  PooledConnection(const PooledConnection &) = delete;
+  auto operator=(const PooledConnection &) -> PooledConnection & = delete;
+
+  /*!
+      \fn auto database() const -> QSqlDatabase
+
+      \brief Get the connection
+   */
+  JMBDEMODELS_EXPORT auto database() const -> QSqlDatabase { return m_db; }
+
+  /*!
+      \fn auto isValid() const -> bool
+
+      \brief true if the connection is open
+   */
+  JMBDEMODELS_EXPORT auto isValid() const -> bool { return m_db.isOpen(); }
+
+private:
+  ConnectionPool *m_pool{nullptr};
+  QSqlDatabase m_db;
+  bool m_acquired{false};
+};
+} // namespace Model
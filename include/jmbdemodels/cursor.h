@@ -0,0 +1,224 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QCoreApplication>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QSqlRecord>
+#include <QString>
+#include <QVariant>
+#include <QVariantList>
+
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include "jmbdemodels_export.h"
+
+namespace Model {
+class Transaction;
+
+/*!
+    \class Cursor
+    \brief Reads the rows of a query one by one without keeping them
+    \details The query is forward only, so the driver keeps no copy of the
+             rows already read and a scan over a whole table needs the
+             memory of one row.
+
+             The PostgreSQL client library fetches the complete result of
+             a query at once. On a QPSQL connection with a fetch size the
+             query runs as a server side cursor instead (DECLARE ... CURSOR
+             and FETCH FORWARD fetchSize), inside a Transaction of its own
+             that close() commits. Inside a Transaction of the caller the
+             cursor is declared WITH HOLD instead and close() commits
+             nothing; a transaction opened with QSqlDatabase::transaction()
+             can't be detected on PostgreSQL. The bound values are inlined
+             with the escaping of the driver, because DECLARE can't be
+             prepared.
+
+             The rows can be read with next() and value(), with forEach()
+             or with a range based for:
+
+             for (const auto &row : cursor) { row.value(0); }
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+class Cursor {
+  Q_DECLARE_TR_FUNCTIONS(Cursor)
+
+public:
+  /*!
+      \fn Cursor(const QSqlDatabase &db, const QString &sql,
+                 const QVariantList &binds = {}, int fetchSize = 0)
+
+      \brief Run the query
+      \param db - The connection, used from the thread that owns it
+      \param sql - The query, with ? for the bound values
+      \param binds - The values for the placeholders
+      \param fetchSize - The rows per FETCH on PostgreSQL, 0 for no cursor
+   */
+  JMBDEMODELS_EXPORT Cursor(const QSqlDatabase &db, const QString &sql,
+                            const QVariantList &binds = {},
+                            int fetchSize = 0);
+
+  /*!
+      \fn ~Cursor()
+
+      \brief Close the cursor
+   */
+  JMBDEMODELS_EXPORT ~Cursor();
+
+  Cursor(const Cursor &) = delete;
+  auto operator=(const Cursor &) -> Cursor & = delete;
+
+  /*!
+      \fn auto isValid() const -> bool
+
+      \brief true if the query could be run
+   */
+  JMBDEMODELS_EXPORT auto isValid() const -> bool { return m_error.isEmpty(); }
+
+  /*!
+      \fn auto lastError() const -> QString
+
+      \brief The error of the query or of the last fetch
+   */
+  JMBDEMODELS_EXPORT auto lastError() const -> QString { return m_error; }
+
+  /*!
+      \fn auto next() -> bool
+
+      \brief Move to the next row
+
+      \return false after the last row or on an error
+   */
+  JMBDEMODELS_EXPORT auto next() -> bool;
+
+  /*!
+      \fn auto value(int column) const -> QVariant
+
+      \brief The value of the column in the current row
+   */
+  JMBDEMODELS_EXPORT auto value(int column) const -> QVariant {
+    return m_query.value(column);
+  }
+
+  /*!
+      \fn auto record() const -> QSqlRecord
+
+      \brief The columns of the current row, with their values
+   */
+  JMBDEMODELS_EXPORT auto record() const -> QSqlRecord {
+    return m_query.record();
+  }
+
+  /*!
+      \fn auto getRowCount() const -> qint64
+
+      \brief The number of rows read so far
+   */
+  JMBDEMODELS_EXPORT auto getRowCount() const -> qint64 { return m_rows; }
+
+  /*!
+      \fn void close()
+
+      \brief Release the query and the server side cursor
+      \details Called by the destructor; next() returns false afterwards.
+   */
+  JMBDEMODELS_EXPORT void close();
+
+  /*!
+      \fn template <typename F> auto forEach(F &&f) -> qint64
+
+      \brief Call f(const Cursor &) for every remaining row
+      \details If f returns a bool, false stops the scan.
+
+      \return the number of rows visited
+   */
+  template <typename F> auto forEach(F &&f) -> qint64 {
+    qint64 count = 0;
+    while (this->next()) {
+      ++count;
+      if constexpr (std::is_same_v<std::invoke_result_t<F, const Cursor &>,
+                                   bool>) {
+        if (!f(static_cast<const Cursor &>(*this))) {
+          break;
+        }
+      } else {
+        f(static_cast<const Cursor &>(*this));
+      }
+    }
+    return count;
+  }
+
+  /*!
+      \class iterator
+      \brief Input iterator for the range based for; every step calls next()
+   */
+  class iterator {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = Cursor;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Cursor *;
+    using reference = const Cursor &;
+
+    iterator() = default;
+    explicit iterator(Cursor *cursor) : m_cursor(cursor) { ++(*this); }
+
+    auto operator*() const -> reference { return *m_cursor; }
+    auto operator->() const -> pointer { return m_cursor; }
+
+    auto operator++() -> iterator & {
+      if (m_cursor != nullptr && !m_cursor->next()) {
+        m_cursor = nullptr;
+      }
+      return *this;
+    }
+
+    auto operator==(const iterator &other) const -> bool {
+      return m_cursor == other.m_cursor;
+    }
+    auto operator!=(const iterator &other) const -> bool {
+      return m_cursor != other.m_cursor;
+    }
+
+  private:
+    Cursor *m_cursor{nullptr};
+  };
+
+  auto begin() -> iterator { return iterator(this); }
+  auto end() -> iterator { return iterator(); }
+
+private:
+  /*!
+      \brief FETCH the next block of the server side cursor
+   */
+  auto fetch() -> bool;
+
+  /*!
+      \brief Replace the ? placeholders with the escaped values
+   */
+  auto inlineBinds(const QString &sql, const QVariantList &binds) const
+      -> QString;
+
+  QSqlDatabase m_db;
+  QSqlQuery m_query;
+  QString m_cursorName;
+  QString m_error;
+  qint64 m_rows{0};
+  int m_fetchSize{0};
+  int m_fetched{0};
+  std::unique_ptr<Transaction> m_transaction;
+  bool m_closed{false};
+};
+} // namespace Model
@@ -11,10 +11,16 @@
 #include <QDate>
 #include <QDir>
 #include <QFileInfo>
+#include <QFuture>
+#include <QHash>
 #include <QList>
 #include <QLoggingCategory>
+#include <QMutex>
 #include <QObject>
+#include <QPair>
+#include <QRegularExpression>
 #include <QSettings>
+#include <QSharedPointer>
 #include <QSqlDatabase>
 #include <QSqlDriver>
 #include <QSqlError>
@@ -23,14 +29,23 @@
 #include <QStandardPaths>
 #include <QString>
 #include <QStringList>
+#include <QThreadPool>
 #include <QUuid>
+#include <QVector>
 #include <QVariantMap>
 
-#include "commondata.h"
+#include "connectionpool.h"
+#include "cursor.h"
+#include "pragmaprofile.h"
+#include "resultset.h"
+#include "statementcache.h"
+#include "tabledescriptor.h"
 
 #include "jmbdemodels_export.h"
 
 namespace Model {
+class ChangeNotifier;
+
 /**
   \class DataContext
   \brief The Main Database class
@@ -102,6 +117,22 @@ public:
      */
   JMBDEMODELS_EXPORT ~DataContext();
 
+  /*!
+      \fn static auto shared(const QString &name = QString())
+                -> QSharedPointer<DataContext>
+
+      \brief Get the shared DataContext for the database with the given name
+      \details All callers asking for the same name get the same instance, so
+               the connection setup runs only once. The context lives as long
+               as one caller holds the returned pointer; a later call creates
+               and opens it again. An empty name means the application name.
+      \param name - Name of the Database
+
+      \return the shared DataContext
+   */
+  JMBDEMODELS_EXPORT static auto shared(const QString &name = QString())
+      -> QSharedPointer<DataContext>;
+
   /*!
       \fn QSqlDatabase getDatabase()
 
@@ -109,6 +140,46 @@ public:
   */
   JMBDEMODELS_EXPORT auto getDatabase() -> const QSqlDatabase { return m_db; }
 
+  /*!
+      \fn auto getConnectionPool() const -> ConnectionPool *
+
+      \brief Get the pool with the connections for the worker threads
+      \details Use a PooledConnection to run queries from a QThreadPool
+               worker. The thread of the DataContext gets getDatabase().
+   */
+  JMBDEMODELS_EXPORT auto getConnectionPool() const -> ConnectionPool * {
+    return m_connectionPool;
+  }
+
+  /*!
+      \fn void setPragmaProfile(const PragmaProfile &profile)
+
+      \brief Set the PRAGMAs for the SQLite connections
+      \details Applied to the open connection now and to every connection
+               opened later, including the clones of the connection pool.
+      \sa PragmaProfile::interactive(), PragmaProfile::bulkLoad(),
+          PragmaProfile::readOnlyReporting()
+   */
+  JMBDEMODELS_EXPORT void setPragmaProfile(const PragmaProfile &profile);
+
+  /*!
+      \fn auto getPragmaProfile() const -> PragmaProfile
+
+      \brief Get the PRAGMAs for the SQLite connections
+   */
+  JMBDEMODELS_EXPORT auto getPragmaProfile() const -> PragmaProfile {
+    return m_pragmaProfile;
+  }
+
+  /*!
+      \fn auto getStatementCache() const -> const StatementCache &
+
+      \brief Get the cache of the prepared statements, e.g. for the hit rate
+   */
+  JMBDEMODELS_EXPORT auto getStatementCache() const -> const StatementCache & {
+    return m_statementCache;
+  }
+
   /*!
       \fn  QSqlQuery getQuery(const QString &queryText);
 
@@ -121,12 +192,212 @@ public:
 
   JMBDEMODELS_EXPORT static auto getQuery(const QString &query) -> QSqlQuery;
 
+  /*!
+      \fn auto execAsync(const QString &sql, const QVariantList &binds = {})
+                -> QFuture<ResultSet>
+
+      \brief Run the query on the database worker thread
+      \details The worker thread has its own connection from the pool. All
+               queries run one after the other in the order of the calls.
+      \param sql - The query, with ? for the bound values
+      \param binds - The values for the placeholders
+
+      \return the future with all rows of the query
+   */
+  JMBDEMODELS_EXPORT auto execAsync(const QString &sql,
+                                    const QVariantList &binds = {})
+      -> QFuture<ResultSet>;
+
+  /*!
+      \fn auto cursor(const QString &sql, const QVariantList &binds = {})
+                -> Cursor
+
+      \brief Run the query on the connection and read the rows one by one
+      \details The rows are not kept, so a scan over a large table needs the
+               memory of one row. On PostgreSQL the rows are fetched in
+               blocks of getFetchSize() rows.
+      \param sql - The query, with ? for the bound values
+      \param binds - The values for the placeholders
+
+      \return the cursor, before the first row
+   */
+  JMBDEMODELS_EXPORT auto cursor(const QString &sql,
+                                 const QVariantList &binds = {}) -> Cursor {
+    return Cursor(this->m_db, sql, binds, this->m_fetchSize);
+  }
+
+  /*!
+      \fn void setFetchSize(int rows)
+      \brief Set the rows per FETCH of the cursors on PostgreSQL
+      \details 0 reads the whole result at once, as QSqlQuery does.
+   */
+  JMBDEMODELS_EXPORT void setFetchSize(int rows) {
+    m_fetchSize = qMax(0, rows);
+  }
+
+  /*!
+      \fn auto getFetchSize() const -> int
+      \brief The rows per FETCH of the cursors on PostgreSQL
+   */
+  JMBDEMODELS_EXPORT auto getFetchSize() const -> int { return m_fetchSize; }
+
+  /*!
+      \fn auto changesSince(const TableDescriptor &table,
+                            const QDateTime &since = QDateTime()) const
+                -> ChangeSet
+
+      \brief The rows of the table with a last_update after since
+      \details last_update is kept current by the triggers of
+               createChangeTracking(), in milliseconds. BLOB columns are left
+               out. The keys of the rows deleted after since come from the
+               table deleted_row.
+      \param table - The table, e.g. Schema::Employee::Table
+      \param since - The watermark of the last call; invalid for all rows
+
+      \return the changed rows and the new watermark
+   */
+  JMBDEMODELS_EXPORT auto changesSince(const TableDescriptor &table,
+                                       const QDateTime &since = QDateTime())
+      const -> ChangeSet;
+
+  /*!
+      \fn auto createChangeTracking() const -> bool
+
+      \brief Create the triggers that set last_update on every write
+      \details One trigger per table with a last_update column of the
+               schema. A value written by the application is kept. Every
+               table gets a trigger that keeps the key of a deleted row in
+               deleted_row. On PostgreSQL every table also gets a trigger
+               that sends the NOTIFY for ChangeNotifier.
+
+               Only the functions, tables, indexes and triggers that are
+               missing are created, a database that has them all isn't
+               locked. A changed trigger needs a migration.
+   */
+  JMBDEMODELS_EXPORT auto createChangeTracking() const -> bool;
+
+  /*!
+      \fn auto purgeDeletedRows(int days = 7) const -> bool
+
+      \brief Remove the keys of rows deleted more than days ago
+      \details Not called by the library; the application runs it from
+               time to time, e.g. once a day. A change feed that reads less
+               often than that misses the older deletes.
+   */
+  JMBDEMODELS_EXPORT auto purgeDeletedRows(int days = 7) const -> bool;
+
+  /*!
+      \fn auto notifier() -> ChangeNotifier *
+
+      \brief The notifier for the rows written on this database
+      \details It is created on the first call and owned by the DataContext.
+               The models connect to it; call start() once to get the
+               changes of other processes too.
+   */
+  JMBDEMODELS_EXPORT auto notifier() -> ChangeNotifier *;
+
   /* basic public actions */
 
   JMBDEMODELS_EXPORT auto checkExistence(const QString &tableName,
                                          const QString &searchId,
                                          const QString &search) -> bool;
 
+  /*!
+      \fn bool insert(const QString &tableName, const QVariantMap &insertData)
+      \brief insert the VariantMap in the table
+
+      \return true is successful
+
+      \sa QVariantMap
+   */
+  JMBDEMODELS_EXPORT auto insert(const QString &tableName,
+                                 const QVariantMap &insertData) const -> bool;
+
+  /*!
+      \fn auto insertBatch(const QString &tableName,
+                           const QVector<QVariantMap> &rows,
+                           int batchSize = 1000) const -> BatchResult
+      \brief insert many rows in the table
+
+      \details The rows are written with one prepared statement and
+               QSqlQuery::execBatch(), in one transaction per batchSize rows.
+               Rows with the same keys share one statement, rows with other
+               keys are written with a statement of their own after them. A
+               column without a key in the row is left out of the INSERT and
+               gets its DEFAULT, a NULL must be given explicitly. When a
+               batch fails, its rows are written one by one, so only the bad
+               rows are lost.
+
+               Inside a Transaction of the caller every batch is a
+               savepoint; the rows are committed, or rolled back, with the
+               transaction of the caller.
+      \param tableName - The table to insert into
+      \param rows - The rows, one map of column and value for each
+      \param batchSize - The number of rows per transaction
+
+      \return the number of written rows and the failed rows
+   */
+  JMBDEMODELS_EXPORT auto insertBatch(const QString &tableName,
+                                      const QVector<QVariantMap> &rows,
+                                      int batchSize = 1000) const
+      -> BatchResult;
+
+  /*!
+      \fn auto update(const QString &tableName, const QVariantMap &values,
+                      const QVariantMap &keys) const -> bool
+      \brief Update the rows of the table that match all keys
+
+      \details The values and keys are bound to a cached prepared statement
+               UPDATE table SET a = ?, b = ? WHERE id = ?.
+               A NULL key matches no row.
+      \param tableName - The table to update
+      \param values - The columns and their new values
+      \param keys - The columns and values that select the rows
+
+      \return true is successful
+   */
+  JMBDEMODELS_EXPORT auto update(const QString &tableName,
+                                 const QVariantMap &values,
+                                 const QVariantMap &keys) const -> bool;
+
+  /*!
+      \fn auto updateBatch(const QString &tableName,
+                           const QVector<QPair<QVariantMap, QVariantMap>>
+                               &rows) const -> BatchResult
+      \brief Update many rows in one transaction
+
+      \details Every entry is a pair of the new values and the keys, as in
+               update(). Entries with the same columns share one prepared
+               statement. A failed entry doesn't abort the others.
+
+      \return the number of successful entries and the failed entries
+   */
+  JMBDEMODELS_EXPORT auto
+  updateBatch(const QString &tableName,
+              const QVector<QPair<QVariantMap, QVariantMap>> &rows) const
+      -> BatchResult;
+
+  /*!
+      \fn static auto splitStatements(const QString &script) -> QStringList
+      \brief Split a sql script in its statements
+
+      \details Comments are removed. Semicolons in strings, quoted names,
+               PostgreSQL dollar quotes and the BEGIN ... END body of a
+               trigger don't end a statement.
+   */
+  JMBDEMODELS_EXPORT static auto splitStatements(const QString &script)
+      -> QStringList;
+
+  /*!
+      \fn static auto isValidIdentifier(const QString &name) -> bool
+      \brief true if the name can be used as table or column name
+
+      \details Names can't be bound as values, so insert() and update()
+               accept only plain identifiers: letters, digits and _.
+   */
+  JMBDEMODELS_EXPORT static auto isValidIdentifier(const QString &name)
+      -> bool;
+
   /* useful actions */
 
   /*!
@@ -166,10 +437,10 @@ protected:
       \details calls from constructor. The CreateConnection
                will Create for the four OS DB's the Connection.
                By using sqlite is the system depend user directory
-               used.
+               used. An open SQLite or PostgreSQL database is migrated
+               and gets the search index and the change tracking.
 
       \todo init all tables
-      \todo check database version
       \todo export and import all tables
    */
   void init();
@@ -182,38 +453,47 @@ protected:
   void prepareDB() const;
 
   /*!
-      \fn bool checkDBVersion()
-      \brief Check the Version of the DB
+      \fn auto runScript(const QString &fileName) const -> bool
+
+      \brief Execute every statement of the sql script in one transaction
+      \details The file is read and split in one pass. On the first error
+               the whole script is rolled back.
 
-      \return False has the DB a wrong version
+      \return true if every statement was successful
    */
-  auto checkDBVersion(
-      const QString &actualVersion,
-      const QString &actualRevision /*, const QString &actualBuild */) const
-      -> bool;
+  auto runScript(const QString &fileName) const -> bool;
 
   /*!
-      \fn bool insert(const QString &tableName, const QVariantMap &insertData)
-      \brief insert the VariantMap in the table
+      \fn void insertGroup(const QString &tableName,
+                           const QVector<QVariantMap> &rows,
+                           const QStringList &fields,
+                           const QVector<int> &group, int batchSize,
+                           BatchResult &result) const
+
+      \brief Write the rows of insertBatch() with the positions in group,
+             which all have the keys fields
+   */
+  void insertGroup(const QString &tableName, const QVector<QVariantMap> &rows,
+                   const QStringList &fields, const QVector<int> &group,
+                   int batchSize, BatchResult &result) const;
 
-      \return true is successful
+  /*!
+      \fn auto prepareUpdate(const QString &tableName,
+                             const QVariantMap &values,
+                             const QVariantMap &keys) const -> QSqlQuery *
+      \brief Get the cached statement for the columns of values and keys
+             and bind the values
 
-      \sa QVariantMap
+      \return the query to execute, nullptr on error
    */
-  auto insert(const QString &tableName, const QVariantMap &insertData) const
-      -> bool;
+  auto prepareUpdate(const QString &tableName, const QVariantMap &values,
+                     const QVariantMap &keys) const -> QSqlQuery *;
 
   /*!
-      \fn  bool update(const QString &table, const QString &column,
-              const QVariant &newValue, const QVariant &op,
-              const QString &id)
-      \brief Update the Data in the table
-
-      \return true is successful
+      \fn void applyPragmaProfile()
+      \brief Run the PRAGMAs of the profile on the open SQLite connection
    */
-  auto update(const QString &table, const QString &column,
-              const QVariant &newValue, const QVariant &op,
-              const QString &id) const -> bool;
+  void applyPragmaProfile();
 
   /*!
       \fn QString getSqliteName()
@@ -275,6 +555,42 @@ private:
   QString m_dbPassWord;
 
   int m_dbPort{0};
+
+  /*!
+       \var ConnectionPool *m_connectionPool
+       \brief The clones of the connection for the worker threads
+    */
+  ConnectionPool *m_connectionPool{nullptr};
+
+  /*!
+       \var QThreadPool m_worker
+       \brief The database worker thread for execAsync()
+    */
+  QThreadPool m_worker;
+
+  /*!
+       \var ChangeNotifier *m_notifier
+       \brief The notifier of notifier(), a child of this object
+    */
+  ChangeNotifier *m_notifier{nullptr};
+
+  /*!
+       \var StatementCache m_statementCache
+       \brief The prepared statements of insert() and update() for m_db
+    */
+  mutable StatementCache m_statementCache;
+
+  /*!
+       \var PragmaProfile m_pragmaProfile
+       \brief The PRAGMAs for the SQLite connections
+    */
+  PragmaProfile m_pragmaProfile;
+
+  /*!
+       \var int m_fetchSize
+       \brief The rows per FETCH of the cursors on PostgreSQL
+    */
+  int m_fetchSize{1000};
 };
 } // namespace Model
 
@@ -0,0 +1,160 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QCoreApplication>
+#include <QHash>
+#include <QString>
+#include <QVariant>
+#include <QVariantMap>
+#include <QVector>
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "tabledescriptor.h"
+
+#include "jmbdemodels_export.h"
+
+namespace Model {
+class DataContext;
+
+/*!
+    \class DataGenerator
+    \brief Fills an empty database with synthetic rows for benchmarks and
+           load tests
+    \details Every table of the schema gets rows with the ids 1 to count.
+             The counts are known before the first row is written, so a
+             foreign key is drawn from the ids of the referenced table and is
+             valid once all tables are filled, also for the references
+             between employee and its devices.
+
+             References to the lookup tables (department, place,
+             manufacturer, software, ...) follow a Zipf distribution with the
+             exponent skew: a few departments own most devices. References
+             to the other tables are uniform.
+
+             The rows of a batch depend only on the seed, the table and the
+             number of the batch. The threads build the batches in parallel,
+             the connection of the DataContext writes them in order with
+             DataContext::insertBatch(). The same seed therefore gives the
+             same database with any number of threads.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+class DataGenerator {
+  Q_DECLARE_TR_FUNCTIONS(DataGenerator)
+
+public:
+  /*!
+      \struct Options
+      \brief The volume and shape of the data
+   */
+  struct Options {
+    quint64 seed{1};
+    int employees{1000};
+
+    /*!
+        \brief computer, phone, mobile, printer and fax together
+     */
+    int devices{5000};
+    int softwarePerComputer{10};
+
+    /*!
+        \brief The Zipf exponent of the references to lookup tables, 0 for
+               uniform
+     */
+    double skew{1.0};
+    int batchSize{1000};
+
+    /*!
+        \brief The threads that build rows, 0 for one per core
+     */
+    int threads{0};
+
+    /*!
+        \brief The row count of a table by its name, instead of the default
+     */
+    QHash<QString, int> counts;
+  };
+
+  /*!
+      \fn explicit DataGenerator(const Options &options)
+
+      \brief Constructor for the DataGenerator
+   */
+  explicit JMBDEMODELS_EXPORT DataGenerator(const Options &options);
+
+  /*!
+      \fn auto count(const TableDescriptor &table) const -> int
+
+      \brief The number of rows the table gets
+   */
+  JMBDEMODELS_EXPORT auto count(const TableDescriptor &table) const -> int;
+
+  /*!
+      \fn auto rows(const TableDescriptor &table, int batch) const
+                -> QVector<QVariantMap>
+
+      \brief The rows of one batch of the table, without a database
+   */
+  JMBDEMODELS_EXPORT auto rows(const TableDescriptor &table, int batch) const
+      -> QVector<QVariantMap>;
+
+  /*!
+      \fn void setProgress(std::function<void(const QString &, qint64,
+                                              qint64)> progress)
+
+      \brief Call progress(table, rows written, rows of the table) after
+             every batch
+   */
+  JMBDEMODELS_EXPORT void
+  setProgress(std::function<void(const QString &, qint64, qint64)> progress) {
+    m_progress = std::move(progress);
+  }
+
+  /*!
+      \fn auto run(DataContext &context) -> bool
+
+      \brief Fill every table of the schema, database_version excepted
+      \details On SQLite the bulk load PRAGMAs are used while it runs. The
+               tables should be empty.
+
+      \return false if a row could not be written, see lastError()
+   */
+  JMBDEMODELS_EXPORT auto run(DataContext &context) -> bool;
+
+  /*!
+      \fn auto rowsWritten() const -> qint64
+
+      \brief The rows written by the last run()
+   */
+  JMBDEMODELS_EXPORT auto rowsWritten() const -> qint64 {
+    return m_rowsWritten;
+  }
+
+  JMBDEMODELS_EXPORT auto lastError() const -> QString { return m_error; }
+
+private:
+  auto defaultCount(const QString &table) const -> int;
+  auto reference(const char *table, quint64 random, double uniform) const
+      -> QVariant;
+
+  Options m_options;
+  QHash<QString, int> m_counts;
+  // The cumulative Zipf probabilities of the ids of every lookup table
+  QHash<QString, std::vector<double>> m_zipf;
+  std::function<void(const QString &, qint64, qint64)> m_progress;
+  qint64 m_rowsWritten{0};
+  QString m_error;
+};
+} // namespace Model
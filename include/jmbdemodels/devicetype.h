@@ -37,10 +37,12 @@ class DeviceType : public CommonData {
 
 public:
   /*!
-      \fn explicit DeviceType()
+      \fn explicit DeviceType(const QSharedPointer<Model::DataContext> &dataContext = {})
       \brief The Constructor for the DeviceName
+      \param dataContext - The DataContext to use, the shared one if null
   */
-  explicit JMBDEMODELS_EXPORT DeviceType();
+  explicit JMBDEMODELS_EXPORT
+  DeviceType(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn  ~DeviceType() override;
@@ -49,78 +51,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~DeviceType() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int DeviceTypeIdIndex()
 
@@ -129,7 +60,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int DeviceTypeIdIndex() const {
-    return m_DeviceTypeIdIndex;
+    return this->getFieldIndex(Schema::DeviceType::DeviceTypeId);
   }
 
   /*!
@@ -139,7 +70,9 @@ public:
 
      Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getNameIndex() const { return m_NameIndex; }
+  JMBDEMODELS_EXPORT int getNameIndex() const {
+    return this->getFieldIndex(Schema::DeviceType::Name);
+  }
 
   /*!
       \fn  int getLastUpdateIndex()
@@ -149,41 +82,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::DeviceType::LastUpdate);
   }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("device_type");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-     \var int m_DeviceTypeIdIndex
-     \brief The value of the DeviceTypeIdIndexx
-  */
-  int m_DeviceTypeIdIndex{0};
-
-  /*!
-      \var int m_NameIndex
-      \brief The value of the NameIndex
-   */
-  int m_NameIndex{0};
-
-  /*!
-      \var int m_LastUpdateIndex
-      \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
@@ -37,10 +37,12 @@ class Document : public CommonData {
 
 public:
   /*!
-      \fn explicit Document()
+      \fn explicit Document(const QSharedPointer<Model::DataContext> &dataContext = {})
       \brief The Constructor for the Document
+      \param dataContext - The DataContext to use, the shared one if null
   */
-  explicit JMBDEMODELS_EXPORT Document();
+  explicit JMBDEMODELS_EXPORT
+  Document(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn  ~Document() override;
@@ -49,78 +51,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~Document() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int DocumentIdIndex()
 
@@ -129,7 +60,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getDocumentIdIndex() const {
-    return m_DocumentIdIndex;
+    return this->getFieldIndex(Schema::Document::DocumentId);
   }
 
   /*!
@@ -139,7 +70,9 @@ public:
 
      Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getNameIndex() const { return m_NameIndex; }
+  JMBDEMODELS_EXPORT int getNameIndex() const {
+    return this->getFieldIndex(Schema::Document::Name);
+  }
 
   /*!
      \fn int DocumentDataIndex()
@@ -149,7 +82,7 @@ public:
      Returns the value of the index
   */
   JMBDEMODELS_EXPORT int getDocumentDataIndex() const {
-    return m_DocumentDataIndex;
+    return this->getFieldIndex(Schema::Document::DocumentData);
   }
 
   /*!
@@ -160,47 +93,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::Document::LastUpdate);
   }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("document");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-     \var int m_DocumentIdIndex
-     \brief The value of the DocumentIdIndex
-  */
-  int m_DocumentIdIndex{0};
-
-  /*!
-      \var int m_NameIndex
-      \brief The value of the NameIndex
-   */
-  int m_NameIndex{0};
-
-  /*!
-     \var int m_DocumentDataIndex
-     \brief The value of the DocumentDataIndex
-  */
-  int m_DocumentDataIndex{0};
-
-  /*!
-      \var int m_LastUpdateIndex
-      \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
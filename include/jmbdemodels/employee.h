@@ -69,10 +69,12 @@ class Employee : public CommonData {
 
 public:
   /*!
-      \fn explicit Employee()
+      \fn explicit Employee(const QSharedPointer<Model::DataContext> &dataContext = {})
       \brief The Constructor for the Employee
+      \param dataContext - The DataContext to use, the shared one if null
   */
-  explicit JMBDEMODELS_EXPORT Employee();
+  explicit JMBDEMODELS_EXPORT
+  Employee(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn  ~Employee() override;
@@ -81,78 +83,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~Employee() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int getEmployeeIdIndex()
 
@@ -161,7 +92,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getEmployeeIdIndex() const {
-    return m_EmployeeIdIndex;
+    return this->getFieldIndex(Schema::Employee::EmployeeId);
   }
 
   /*!
@@ -172,7 +103,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getEmployeeNrIndex() const {
-    return m_EmployeeNrIndex;
+    return this->getFieldIndex(Schema::Employee::EmployeeNr);
   }
 
   /*!
@@ -182,7 +113,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getGenderIndex() const { return m_GenderIndex; }
+  JMBDEMODELS_EXPORT int getGenderIndex() const {
+    return this->getFieldIndex(Schema::Employee::Gender);
+  }
 
   /*!
       \fn int getTitleIdIndex()
@@ -191,7 +124,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getTitleIdIndex() const { return m_TitleIdIndex; }
+  JMBDEMODELS_EXPORT int getTitleIdIndex() const {
+    return this->getFieldIndex(Schema::Employee::TitleId);
+  }
 
   /*!
       \fn int getFirstNameIndex()
@@ -200,7 +135,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getFirstNameIndex() const { return m_FirstNameIndex; }
+  JMBDEMODELS_EXPORT int getFirstNameIndex() const {
+    return this->getFieldIndex(Schema::Employee::FirstName);
+  }
 
   /*!
       \fn int getLastNameIndex()
@@ -209,7 +146,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getLastNameIndex() const { return m_LastNameIndex; }
+  JMBDEMODELS_EXPORT int getLastNameIndex() const {
+    return this->getFieldIndex(Schema::Employee::LastName);
+  }
 
   /*!
       \fn int getBirthDayIndex()
@@ -218,7 +157,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getBirthDayIndex() const { return m_BirthDayIndex; }
+  JMBDEMODELS_EXPORT int getBirthDayIndex() const {
+    return this->getFieldIndex(Schema::Employee::BirthDay);
+  }
 
   /*!
       \fn  int getAddressIndex()
@@ -227,7 +168,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getAddressIndex() const { return m_AddressIndex; }
+  JMBDEMODELS_EXPORT int getAddressIndex() const {
+    return this->getFieldIndex(Schema::Employee::Address);
+  }
 
   /*!
      \fn int getZipCityIdIndex()
@@ -236,7 +179,9 @@ public:
 
      Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getZipCityIdIndex() const { return m_ZipCityIdIndex; }
+  JMBDEMODELS_EXPORT int getZipCityIdIndex() const {
+    return this->getFieldIndex(Schema::Employee::ZipCityId);
+  }
 
   /*!
      \fn int getHomePhoneIndex()
@@ -245,7 +190,9 @@ public:
 
      Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getHomePhoneIndex() const { return m_HomePhoneIndex; }
+  JMBDEMODELS_EXPORT int getHomePhoneIndex() const {
+    return this->getFieldIndex(Schema::Employee::HomePhone);
+  }
 
   /*!
      \fn int getHomeMobileIndex()
@@ -255,7 +202,7 @@ public:
      Returns the value of the index
   */
   JMBDEMODELS_EXPORT int getHomeMobileIndex() const {
-    return m_HomeMobileIndex;
+    return this->getFieldIndex(Schema::Employee::HomeMobile);
   }
 
   /*!
@@ -265,7 +212,9 @@ public:
 
      Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getHomeMailIndex() const { return m_HomeMailIndex; }
+  JMBDEMODELS_EXPORT int getHomeMailIndex() const {
+    return this->getFieldIndex(Schema::Employee::HomeMailAddress);
+  }
 
   /*!
       \fn int getBusinessMailIndex()
@@ -275,7 +224,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getBusinessMailIndex() const {
-    return m_BusinessMailIndex;
+    return this->getFieldIndex(Schema::Employee::BusinessMailAddress);
   }
 
   /*!
@@ -285,7 +234,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getDataCareIndex() const { return m_DataCareIndex; }
+  JMBDEMODELS_EXPORT int getDataCareIndex() const {
+    return this->getFieldIndex(Schema::Employee::DataCare);
+  }
 
   /*!
       \fn int getActiveIndex()
@@ -294,7 +245,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getActiveIndex() const { return m_ActiveIndex; }
+  JMBDEMODELS_EXPORT int getActiveIndex() const {
+    return this->getFieldIndex(Schema::Employee::Active);
+  }
 
   /*!
       \fn int getPhotoIndex()
@@ -303,7 +256,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getPhotoIndex() const { return m_PhotoIndex; }
+  JMBDEMODELS_EXPORT int getPhotoIndex() const {
+    return this->getFieldIndex(Schema::Employee::Photo);
+  }
 
   /*!
       \fn int getNotesIndex()
@@ -312,7 +267,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getNotesIndex() const { return m_NotesIndex; }
+  JMBDEMODELS_EXPORT int getNotesIndex() const {
+    return this->getFieldIndex(Schema::Employee::Notes);
+  }
 
   /*!
       \fn int getHireDateIndex()
@@ -321,7 +278,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getHireDateIndex() const { return m_HireDateIndex; }
+  JMBDEMODELS_EXPORT int getHireDateIndex() const {
+    return this->getFieldIndex(Schema::Employee::HireDate);
+  }
 
   /*!
       \fn int getEndDateIndex()
@@ -330,7 +289,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getEndDateIndex() const { return m_EndDateIndex; }
+  JMBDEMODELS_EXPORT int getEndDateIndex() const {
+    return this->getFieldIndex(Schema::Employee::EndDate);
+  }
 
   /*!
       \fn int getDepartmentIdIndex()
@@ -340,7 +301,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getDepartmentIdIndex() const {
-    return m_DepartmentIdIndex;
+    return this->getFieldIndex(Schema::Employee::DepartmentId);
   }
 
   /*!
@@ -351,7 +312,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getFunctionIdIndex() const {
-    return m_FunctionIdIndex;
+    return this->getFieldIndex(Schema::Employee::FunctionId);
   }
 
   /*!
@@ -362,7 +323,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getComputerIdIndex() const {
-    return m_ComputerIdIndex;
+    return this->getFieldIndex(Schema::Employee::ComputerId);
   }
 
   /*!
@@ -372,7 +333,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getPrinterIdIndex() const { return m_PrinterIdIndex; }
+  JMBDEMODELS_EXPORT int getPrinterIdIndex() const {
+    return this->getFieldIndex(Schema::Employee::PrinterId);
+  }
 
   /*!
       \fn int getPhoneIdIndex()
@@ -381,7 +344,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getPhoneIdIndex() const { return m_PhoneIdIndex; }
+  JMBDEMODELS_EXPORT int getPhoneIdIndex() const {
+    return this->getFieldIndex(Schema::Employee::PhoneId);
+  }
 
   /*!
       \fn int getMobileIdIndex()
@@ -390,7 +355,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getMobileIdIndex() const { return m_MobileIdIndex; }
+  JMBDEMODELS_EXPORT int getMobileIdIndex() const {
+    return this->getFieldIndex(Schema::Employee::MobileId);
+  }
 
   /*!
       \fn int getFaxIdIndex()
@@ -399,7 +366,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getFaxIdIndex() const { return m_FaxIdIndex; }
+  JMBDEMODELS_EXPORT int getFaxIdIndex() const {
+    return this->getFieldIndex(Schema::Employee::FaxId);
+  }
 
   /*!
       \fn int getEmployeeAccountIdIndex()
@@ -410,7 +379,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getEmployeeAccountIdIndex() const {
-    return m_EmployeeAccountIdIndex;
+    return this->getFieldIndex(Schema::Employee::EmployeeAccountId);
   }
 
   /*!
@@ -422,7 +391,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getEmployeeDocumentIdIndex() const {
-    return m_EmployeeDocumentIdIndex;
+    return this->getFieldIndex(Schema::Employee::EmployeeDocumentId);
   }
 
   /*!
@@ -433,7 +402,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getChipCardIdIndex() const {
-    return m_ChipCardIdIndex;
+    return this->getFieldIndex(Schema::Employee::ChipCardId);
   }
 
   /*!
@@ -444,204 +413,8 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::Employee::LastUpdate);
   }
 
-protected:
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("employee");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-     \var int m_EmployeeIdIndex
-     \brief The value of the EmployeeIdIndex
-  */
-  int m_EmployeeIdIndex{0};
-
-  /*!
-     \var int m_EmployeeNrIndex
-     \brief The value of the EmployeeNrIndex
-  */
-  int m_EmployeeNrIndex{0};
-
-  /*!
-     \var int m_GenderIndex
-     \brief The value of the GenderIndex
-  */
-  int m_GenderIndex{0};
-
-  /*!
-     \var int m_TitleIdIndex
-     \brief The value of the TitleIdIndex
-  */
-  int m_TitleIdIndex{0};
-
-  /*!
-     \var int m_FirstNameIndex
-     \brief The value of the FirstNameIndex
-  */
-  int m_FirstNameIndex{0};
-
-  /*!
-      \var int m_LastNameIndex
-      \brief The value of the LastNameIndex
-   */
-  int m_LastNameIndex{0};
-
-  /*!
-      \var int m_BirthDayIndex
-      \brief The value of the BirthDayIndex
-   */
-  int m_BirthDayIndex{0};
-
-  /*!
-      \var int m_AddressIndex
-      \brief The value of the AddressIndex
-   */
-  int m_AddressIndex{0};
-
-  /*!
-      \var int m_ZipCityIdIndex
-      \brief The value of the ZipCityIdIndex
-   */
-  int m_ZipCityIdIndex{0};
-
-  /*!
-      \var int m_HomePhoneIndex
-      \brief The value of the HomePhoneIndex
-   */
-  int m_HomePhoneIndex{0};
-
-  /*!
-      \var int m_HomeMobileIndex
-      \brief The value of the HomeMobileIndex
-   */
-  int m_HomeMobileIndex{0};
-
-  /*!
-      \var int m_HomeMailIndex
-      \brief The value of the HomeMailIndex
-   */
-  int m_HomeMailIndex{0};
-
-  /*!
-      \var int m_BusinessMailIndex
-      \brief The value of the BusinessMailIndex
-   */
-  int m_BusinessMailIndex{0};
-
-  /*!
-      \var int m_DataCareIndex
-      \brief The value of the DataCareIndex
-   */
-  int m_DataCareIndex{0};
-
-  /*!
-      \var int m_ActiveIndex
-      \brief The value of the ActiveIndex
-   */
-  int m_ActiveIndex{0};
-
-  /*!
-      \var int m_PhotoIndex
-      \brief The value of the PhotoIndex
-   */
-  int m_PhotoIndex{0};
-
-  /*!
-      \var int m_NotesIndex
-      \brief The value of the NotesIndex
-   */
-  int m_NotesIndex{0};
-
-  /*!
-      \var int m_HireDateIndex
-      \brief The value of the HireDateIndex
-   */
-  int m_HireDateIndex{0};
-
-  /*!
-      \var int m_EndDateIndex
-      \brief The value of the EndDateIndex
-   */
-  int m_EndDateIndex{0};
-
-  /*!
-      \var int m_DepartmentIdIndex
-      \brief The value of the DepartmentIdIndex
-   */
-  int m_DepartmentIdIndex{0};
-
-  /*!
-      \var int m_FunctionIdIndex
-      \brief The value of the FunctionIdIndex
-   */
-  int m_FunctionIdIndex{0};
-
-  /*!
-      \var int m_ComputerIdIndex
-      \brief The value of the ComputerIdIndex
-   */
-  int m_ComputerIdIndex{0};
-
-  /*!
-      \var int m_PrinterIdIndex
-      \brief The value of the PrinterIdIndex
-   */
-  int m_PrinterIdIndex{0};
-
-  /*!
-      \var int m_PhoneIdIndex
-      \brief The value of the PhoneIdIndex
-   */
-  int m_PhoneIdIndex{0};
-
-  /*!
-      \var int m_MobileIdIndex
-      \brief The value of the MobileIdIndex
-   */
-  int m_MobileIdIndex{0};
-
-  /*!
-      \var int m_FaxIdIndex
-      \brief The value of the FaxIdIndex
-   */
-  int m_FaxIdIndex{0};
-
-  /*!
-      \var int m_EmployeeAccountIdIndex
-      \brief The value of the EmployeeAccountIdIndex
-   */
-  int m_EmployeeAccountIdIndex{0};
-
-  /*!
-      \var int m_EmployeeDocumentIdIndex
-      \brief The value of the EmployeeDocumentIdIndex
-   */
-  int m_EmployeeDocumentIdIndex{0};
-
-  /*!
-      \var int m_ChipCardIdIndex
-      \brief The value of the ChipCardIdIndex
-   */
-  int m_ChipCardIdIndex{0};
-
-  /*!
-      \var int m_LastUpdateIndex
-      \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
@@ -37,10 +37,12 @@ class EmployeeAccount : public CommonData {
 
 public:
   /*!
-      \fn explicit EmployeeAccount()
+      \fn explicit EmployeeAccount(const QSharedPointer<Model::DataContext> &dataContext = {})
       \brief The Constructor for the EmployeeAccount
+      \param dataContext - The DataContext to use, the shared one if null
   */
-  explicit JMBDEMODELS_EXPORT EmployeeAccount();
+  explicit JMBDEMODELS_EXPORT
+  EmployeeAccount(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn  ~EmployeeAccount() override;
@@ -49,78 +51,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~EmployeeAccount() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int EmployeeAccountIdIndex()
 
@@ -130,7 +61,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getEmployeeAccountIdIndex() const {
-    return m_EmployeeAccountIdIndex;
+    return this->getFieldIndex(Schema::EmployeeAccount::EmployeeAccountId);
   }
 
   /*!
@@ -141,7 +72,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getEmployeeIdIndex() const {
-    return m_EmployeeIdIndex;
+    return this->getFieldIndex(Schema::EmployeeAccount::EmployeId);
   }
 
   /*!
@@ -151,7 +82,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getAccountIdIndex() const { return m_AccountIdIndex; }
+  JMBDEMODELS_EXPORT int getAccountIdIndex() const {
+    return this->getFieldIndex(Schema::EmployeeAccount::AccountId);
+  }
 
   /*!
       \fn  int LastUpdateIndex()
@@ -161,47 +94,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::EmployeeAccount::LastUpdate);
   }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("employee_account");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-     \var int m_EmployeeAccountIdIndex
-     \brief The value of the EmployeeAccountIdIndex
-  */
-  int m_EmployeeAccountIdIndex{0};
-
-  /*!
-     \var int m_EmployeeIdIndex
-     \brief The value of the EmployeeIdIndex
-  */
-  int m_EmployeeIdIndex{0};
-
-  /*!
-     \var int m_AccountIdIndex
-     \brief The value of the AccountIdIndex
-  */
-  int m_AccountIdIndex{0};
-
-  /*!
-      \var int m_LastUpdateIndex
-      \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
@@ -37,10 +37,12 @@ class EmployeeDocument : public CommonData {
 
 public:
   /*!
-      \fn explicit EmployeeDocument()
+      \fn explicit EmployeeDocument(const QSharedPointer<Model::DataContext> &dataContext = {})
       \brief The Constructor for the EmployeeDocument
+      \param dataContext - The DataContext to use, the shared one if null
   */
-  explicit JMBDEMODELS_EXPORT EmployeeDocument();
+  explicit JMBDEMODELS_EXPORT
+  EmployeeDocument(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn  ~EmployeeDocument() override;
@@ -49,78 +51,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~EmployeeDocument() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int EmployeeDocumentIdIndex()
 
@@ -130,7 +61,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getEmployeeDocumentIdIndex() const {
-    return m_EmployeeDocumentIdIndex;
+    return this->getFieldIndex(Schema::EmployeeDocument::EmployeeDocumentId);
   }
 
   /*!
@@ -141,7 +72,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getEmployeeIdIndex() const {
-    return m_EmployeeIdIndex;
+    return this->getFieldIndex(Schema::EmployeeDocument::EmployeId);
   }
 
   /*!
@@ -152,7 +83,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getDocumentIdIndex() const {
-    return m_DocumentIdIndex;
+    return this->getFieldIndex(Schema::EmployeeDocument::DocumentId);
   }
 
   /*!
@@ -163,47 +94,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::EmployeeDocument::LastUpdate);
   }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("employee_document");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-     \var int m_EmployeeDocumentIdIndex
-     \brief The value of the EmployeeDocumentIdIndex
-  */
-  int m_EmployeeDocumentIdIndex{0};
-
-  /*!
-     \var int m_EmployeeIdIndex
-     \brief The value of the EmployeeIdIndex
-  */
-  int m_EmployeeIdIndex{0};
-
-  /*!
-     \var int m_DocumentIdIndex
-     \brief The value of the DocumentIdIndex
-  */
-  int m_DocumentIdIndex{0};
-
-  /*!
-      \var int m_LastUpdateIndex
-      \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
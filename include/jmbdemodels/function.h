@@ -37,10 +37,12 @@ class Function : public CommonData {
   Q_OBJECT
 public:
   /*!
-      \fn explicit Function()
+      \fn explicit Function(const QSharedPointer<Model::DataContext> &dataContext = {})
       \brief The Constructor for the EmployeeAccount
+      \param dataContext - The DataContext to use, the shared one if null
   */
-  explicit JMBDEMODELS_EXPORT Function();
+  explicit JMBDEMODELS_EXPORT
+  Function(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn ~Function;
@@ -49,78 +51,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~Function() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int FunctionIdIndex()
 
@@ -129,7 +60,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getFunctionIdIndex() const {
-    return m_FunctionIdIndex;
+    return this->getFieldIndex(Schema::Function::FunctionId);
   }
 
   /*!
@@ -139,7 +70,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getNameIndex() const { return m_NameIndex; }
+  JMBDEMODELS_EXPORT int getNameIndex() const {
+    return this->getFieldIndex(Schema::Function::Name);
+  }
 
   /*!
       \fn  int PriorityIndex()
@@ -148,7 +81,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getPriorityIndex() const { return m_PriorityIndex; }
+  JMBDEMODELS_EXPORT int getPriorityIndex() const {
+    return this->getFieldIndex(Schema::Function::Priority);
+  }
 
   /*!
       \fn  int LastUpdateIndex()
@@ -158,47 +93,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::Function::LastUpdate);
   }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("function");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-     \var int m_FunctionIdIndex
-     \brief The value of the FunctionIdIndex
-  */
-  int m_FunctionIdIndex{0};
-
-  /*!
-     \var int m_NameIndex
-     \brief The value of the NameIndex
-  */
-  int m_NameIndex{0};
-
-  /*!
-    \var int m_PriorityIndex
-    \brief The value of the PriorityIndexx
- */
-  int m_PriorityIndex{0};
-
-  /*!
-      \var int m_LastUpdateIndex
-      \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
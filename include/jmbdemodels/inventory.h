@@ -38,10 +38,12 @@ class Inventory : public CommonData {
 
 public:
   /*!
-      \fn explicit Inventory()
+      \fn explicit Inventory(const QSharedPointer<Model::DataContext> &dataContext = {})
       \brief The Constructor for the Inventory
+      \param dataContext - The DataContext to use, the shared one if null
   */
-  explicit JMBDEMODELS_EXPORT Inventory();
+  explicit JMBDEMODELS_EXPORT
+  Inventory(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn  ~Inventory() override;
@@ -50,78 +52,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~Inventory() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int InventoryIdIndex()
 
@@ -130,7 +61,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getInventoryIdIndex() const {
-    return m_InventoryIdIndex;
+    return this->getFieldIndex(Schema::Inventory::InventoryId);
   }
 
   /*!
@@ -140,7 +71,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getNumberIndex() const { return m_NumberIndex; }
+  JMBDEMODELS_EXPORT int getNumberIndex() const {
+    return this->getFieldIndex(Schema::Inventory::Number);
+  }
 
   /*!
       \fn int DescriptionIndex()
@@ -150,7 +83,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getDescriptionIndex() const {
-    return m_DescriptionIndex;
+    return this->getFieldIndex(Schema::Inventory::Text);
   }
 
   /*!
@@ -160,7 +93,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getActiveIndex() const { return m_ActiveIndex; }
+  JMBDEMODELS_EXPORT int getActiveIndex() const {
+    return this->getFieldIndex(Schema::Inventory::Active);
+  }
 
   /*!
       \fn  int int LastUpateIndex() const
@@ -169,52 +104,8 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getLastUpateIndex() const { return m_LastUpdateIndex; }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("inventory");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-     \var int m_InventoryIdIndex
-     \brief The value of the InventoryIdIndex
-  */
-  int m_InventoryIdIndex{0};
-
-  /*!
-     \var int m_NumberIndex
-     \brief The value of the NumberIndex
-  */
-  int m_NumberIndex{0};
-
-  /*!
-     \var int m_DescriptionIndex
-     \brief The value of the DescriptionIndex
-  */
-  int m_DescriptionIndex{0};
-
-  /*!
-     \var int m_ActiveIndex
-     \brief The value of the ActiveIndex
-  */
-  int m_ActiveIndex{0};
-
-  /*!
-      \var int m_LastUpdateIndex
-      \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
+  JMBDEMODELS_EXPORT int getLastUpateIndex() const {
+    return this->getFieldIndex(Schema::Inventory::LastUpdate);
+  }
 };
 } // namespace Model
@@ -0,0 +1,69 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QObject>
+#include <QSqlDatabase>
+#include <QSqlRelationalTableModel>
+#include <QString>
+
+#include "tabledescriptor.h"
+
+#include "jmbdemodels_export.h"
+
+namespace Model {
+/*!
+    \class LazyBlobTableModel
+    \brief A QSqlRelationalTableModel that leaves the BLOB columns out
+    \details The BLOB columns of the descriptor are selected as NULL, so a
+             list of employees doesn't load every photo. The columns keep
+             their position and are not written back unless they are set.
+             Use setLoadBlobs(true) for a model that edits them, or
+             BlobStream to read one value.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+class LazyBlobTableModel : public QSqlRelationalTableModel {
+  Q_OBJECT
+
+public:
+  /*!
+      \fn LazyBlobTableModel(const TableDescriptor &table,
+                             QObject *parent = nullptr,
+                             const QSqlDatabase &db = QSqlDatabase())
+
+      \brief Constructor for the LazyBlobTableModel
+      \param table - The descriptor with the BLOB columns of the table
+   */
+  explicit JMBDEMODELS_EXPORT
+  LazyBlobTableModel(const TableDescriptor &table, QObject *parent = nullptr,
+                     const QSqlDatabase &db = QSqlDatabase());
+
+  /*!
+      \fn void setLoadBlobs(bool load)
+
+      \brief Select the BLOB columns too; takes effect on the next select()
+   */
+  JMBDEMODELS_EXPORT void setLoadBlobs(bool load) { m_loadBlobs = load; }
+
+  JMBDEMODELS_EXPORT auto getLoadBlobs() const -> bool { return m_loadBlobs; }
+
+protected:
+  /*!
+      \brief The statement of the base class with NULL for every BLOB column
+   */
+  auto selectStatement() const -> QString override;
+
+private:
+  const TableDescriptor *m_table;
+  bool m_loadBlobs{false};
+};
+} // namespace Model
@@ -37,10 +37,12 @@ class Manufacturer : public CommonData {
 
 public:
   /*!
-      \fn explicit Manufacturer()
+      \fn explicit Manufacturer(const QSharedPointer<Model::DataContext> &dataContext = {})
       \brief The Constructor for the Manufacturer
+      \param dataContext - The DataContext to use, the shared one if null
   */
-  explicit JMBDEMODELS_EXPORT Manufacturer();
+  explicit JMBDEMODELS_EXPORT
+  Manufacturer(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn  ~Manufacturer();
@@ -49,78 +51,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~Manufacturer() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int ManufacturerIdIndex()
 
@@ -129,7 +60,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getManufacturerIdIndex() const {
-    return m_ManufacturerIdIndex;
+    return this->getFieldIndex(Schema::Manufacturer::ManufacturerId);
   }
 
   /*!
@@ -139,7 +70,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getNameIndex() const { return m_NameIndex; }
+  JMBDEMODELS_EXPORT int getNameIndex() const {
+    return this->getFieldIndex(Schema::Manufacturer::Name);
+  }
 
   /*!
       \fn int Name2Index()
@@ -148,7 +81,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getName2Index() const { return m_Name2Index; }
+  JMBDEMODELS_EXPORT int getName2Index() const {
+    return this->getFieldIndex(Schema::Manufacturer::Name2);
+  }
 
   /*!
       \fn int SupporterIndex()
@@ -157,7 +92,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getSupporterIndex() const { return m_SupporterIndex; }
+  JMBDEMODELS_EXPORT int getSupporterIndex() const {
+    return this->getFieldIndex(Schema::Manufacturer::Supporter);
+  }
 
   /*!
       \fn int AddressIndex()
@@ -166,7 +103,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getAddressIndex() const { return m_AddressIndex; }
+  JMBDEMODELS_EXPORT int getAddressIndex() const {
+    return this->getFieldIndex(Schema::Manufacturer::Address);
+  }
 
   /*!
       \fn int Address2Index()
@@ -175,7 +114,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getAddress2Index() const { return m_Address2Index; }
+  JMBDEMODELS_EXPORT int getAddress2Index() const {
+    return this->getFieldIndex(Schema::Manufacturer::Address2);
+  }
 
   /*!
       \fn int ZipCityIdIndex()
@@ -184,7 +125,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getZipCityIdIndex() const { return m_ZipCityIdIndex; }
+  JMBDEMODELS_EXPORT int getZipCityIdIndex() const {
+    return this->getFieldIndex(Schema::Manufacturer::ZipCityId);
+  }
 
   /*!
       \fn int MailAddressIndex()
@@ -194,7 +137,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getMailAddressIndex() const {
-    return m_MailAddressIndex;
+    return this->getFieldIndex(Schema::Manufacturer::MailAddress);
   }
 
   /*!
@@ -205,7 +148,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getPhoneNumberIndex() const {
-    return m_PhoneNumberIndex;
+    return this->getFieldIndex(Schema::Manufacturer::PhoneNumber);
   }
 
   /*!
@@ -215,7 +158,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getFaxNumberIndex() const { return m_FaxNumberIndex; }
+  JMBDEMODELS_EXPORT int getFaxNumberIndex() const {
+    return this->getFieldIndex(Schema::Manufacturer::FaxNumber);
+  }
 
   /*!
       \fn int HotlineNumberIndex()
@@ -225,7 +170,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getHotlineNumberIndex() const {
-    return m_HotlineNumberIndex;
+    return this->getFieldIndex(Schema::Manufacturer::HotlineNumber);
   }
 
   /*!
@@ -236,95 +181,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::Manufacturer::LastUpdate);
   }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("manufacturer");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-     \var int m_ManufacturerIdIndex
-     \brief The value of the ManufacturerIdIndex
-  */
-  int m_ManufacturerIdIndex{0};
-
-  /*!
-     \var int m_NameIndex
-     \brief The value of the NameIndex
-  */
-  int m_NameIndex{0};
-
-  /*!
-     \var int m_Name2Index
-     \brief The value of the Name2Index
-  */
-  int m_Name2Index{0};
-
-  /*!
-      \var int m_SupporterIndex
-      \brief The value of the SupporterIndex
-   */
-  int m_SupporterIndex{0};
-
-  /*!
-      \var int m_AddressIndex
-      \brief The value of the AddressIndex
-   */
-  int m_AddressIndex{0};
-
-  /*!
-      \var int m_Address2Index
-      \brief The value of the Address2Index
-   */
-  int m_Address2Index{0};
-
-  /*!
-      \var int m_ZipCityIdIndex
-      \brief The value of the ZipCityIdIndex
-   */
-  int m_ZipCityIdIndex{0};
-
-  /*!
-      \var int m_MailAddressIndex
-      \brief The value of the MailAddressIndex
-   */
-  int m_MailAddressIndex{0};
-
-  /*!
-      \var int m_PhoneNumberIndex
-      \brief The value of the PhoneNumberIndex
-   */
-  int m_PhoneNumberIndex{0};
-
-  /*!
-      \var int m_FaxNumberIndex
-      \brief The value of the FaxNumberIndex
-   */
-  int m_FaxNumberIndex{0};
-
-  /*!
-      \var int m_HotlineNumberIndex
-      \brief The value of the HotlineNumberIndex
-   */
-  int m_HotlineNumberIndex{0};
-
-  /*!
-      \var int m_LastUpdateIndex
-      \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
@@ -0,0 +1,151 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QObject>
+#include <QSet>
+#include <QSqlDatabase>
+#include <QString>
+#include <QVector>
+
+#include "jmbdemodels_export.h"
+
+namespace Model {
+/*!
+    \class Migrator
+    \brief Brings the schema of an existing database up to date
+    \details The migrations are the scripts <version>_<name>.sql of the
+             directory, :/data/migrations by default. A script named
+             <version>_<name>.sqlite.sql or .pgsql.sql is only run on that
+             database, instead of the plain one of the version. The
+             applied versions are kept in schema_migrations, a version that
+             is missing there runs, in the order of the versions.
+             database_version only keeps the version of the first schema
+             and is not read anymore. DataContext::init() migrates every
+             SQLite and PostgreSQL database it opens.
+
+             Every migration runs in a transaction of its own, together with
+             its row in schema_migrations, so an interrupted upgrade starts
+             again with the migration that didn't finish.
+
+             A script with the line "-- migrate: online" runs each statement
+             on its own instead, for long index builds that shouldn't block
+             the database for the whole migration. On PostgreSQL its CREATE
+             INDEX statements are run CONCURRENTLY, an invalid index left by
+             an interrupted build is dropped first. Such a script is only
+             recorded after its last statement, a retry runs the statements
+             before a failed one again. An online script may therefore only
+             have CREATE [UNIQUE] INDEX IF NOT EXISTS statements, any other
+             statement fails the migration before anything runs.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+class Migrator : public QObject {
+  Q_OBJECT
+
+public:
+  /*!
+      \struct Migration
+      \brief One migration script
+   */
+  struct Migration {
+    int version{0};
+    QString name;
+    QString fileName;
+  };
+
+  /*!
+      \fn Migrator(const QSqlDatabase &db, QObject *parent = nullptr)
+
+      \brief Constructor for the Migrator
+      \param db - The open connection to upgrade
+   */
+  explicit JMBDEMODELS_EXPORT Migrator(const QSqlDatabase &db,
+                                       QObject *parent = nullptr);
+
+  /*!
+      \fn void setDirectory(const QString &directory)
+
+      \brief Read the migrations from another directory
+   */
+  JMBDEMODELS_EXPORT void setDirectory(const QString &directory) {
+    m_directory = directory;
+  }
+
+  JMBDEMODELS_EXPORT auto getDirectory() const -> QString {
+    return m_directory;
+  }
+
+  /*!
+      \fn auto migrations() const -> QVector<Migration>
+
+      \brief The migrations for the driver of the database, by version
+   */
+  JMBDEMODELS_EXPORT auto migrations() const -> QVector<Migration>;
+
+  /*!
+      \fn auto pending() const -> QVector<Migration>
+
+      \brief The migrations that are not applied yet, by version
+   */
+  JMBDEMODELS_EXPORT auto pending() const -> QVector<Migration>;
+
+  /*!
+      \fn auto currentVersion() const -> int
+
+      \brief The highest applied version, 0 if there is none
+   */
+  JMBDEMODELS_EXPORT auto currentVersion() const -> int;
+
+  /*!
+      \fn auto migrate() -> bool
+
+      \brief Apply the pending migrations
+      \details Stops at the first migration that fails; the ones before it
+               stay applied.
+
+      \return true if every pending migration was applied
+   */
+  JMBDEMODELS_EXPORT auto migrate() -> bool;
+
+  /*!
+      \fn auto lastError() const -> QString
+
+      \brief The error of the last migrate(), empty if it succeeded
+   */
+  JMBDEMODELS_EXPORT auto lastError() const -> QString { return m_error; }
+
+signals:
+  /*!
+      \fn void progress(int migration, int migrations, int statement,
+                        int statements, const QString &name)
+      \brief A statement of a migration is done
+      \param migration - The position of the migration, from 1
+      \param migrations - The number of pending migrations
+      \param statement - The statements done of this migration
+      \param statements - The statements of this migration
+      \param name - The name of the migration
+   */
+  JMBDEMODELS_EXPORT void progress(int migration, int migrations,
+                                   int statement, int statements,
+                                   const QString &name);
+
+private:
+  auto ensureTable() -> bool;
+  auto applied() const -> QSet<int>;
+  auto apply(const Migration &migration, int position, int count) -> bool;
+  auto execOnline(const QString &statement) -> bool;
+
+  QSqlDatabase m_db;
+  QString m_directory;
+  QString m_error;
+};
+} // namespace Model
@@ -37,10 +37,12 @@ class OS : public CommonData {
 
 public:
   /*!
-      \fn explicit OS()
+      \fn explicit OS(const QSharedPointer<Model::DataContext> &dataContext = {})
       \brief The Constructor for the Inventory
+      \param dataContext - The DataContext to use, the shared one if null
   */
-  explicit JMBDEMODELS_EXPORT OS();
+  explicit JMBDEMODELS_EXPORT
+  OS(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn  ~OS();
@@ -49,78 +51,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~OS() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int OSIdIndex()
 
@@ -128,7 +59,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getOSIdIndex() const { return m_OSIdIndex; }
+  JMBDEMODELS_EXPORT int getOSIdIndex() const {
+    return this->getFieldIndex(Schema::OS::OsId);
+  }
 
   /*!
       \fn int NameIndex() const
@@ -137,7 +70,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getNameIndex() const { return m_NameIndex; }
+  JMBDEMODELS_EXPORT int getNameIndex() const {
+    return this->getFieldIndex(Schema::OS::Name);
+  }
 
   /*!
      \fn int VersionIndex()
@@ -146,7 +81,9 @@ public:
 
      Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getVersionIndex() const { return m_VersionIndex; }
+  JMBDEMODELS_EXPORT int getVersionIndex() const {
+    return this->getFieldIndex(Schema::OS::Version);
+  }
 
   /*!
      \fn int RevisionIndex()
@@ -155,7 +92,9 @@ public:
 
      Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getRevisionIndex() const { return m_RevisionIndex; }
+  JMBDEMODELS_EXPORT int getRevisionIndex() const {
+    return this->getFieldIndex(Schema::OS::Revision);
+  }
 
   /*!
      \fn int FixIndex()
@@ -164,7 +103,9 @@ public:
 
      Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getFixIndex() const { return m_FixIndex; }
+  JMBDEMODELS_EXPORT int getFixIndex() const {
+    return this->getFieldIndex(Schema::OS::Fix);
+  }
 
   /*!
      \fn  int LastUpdateIndex()
@@ -174,59 +115,7 @@ public:
      Returns the value of the index
   */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::OS::LastUpdate);
   }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("os");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-     \var int m_OSIdIndex
-     \brief The value of the OSId
-  */
-  int m_OSIdIndex{0};
-
-  /*!
-     \var int m_NameIndex
-     \brief The value of the Name
-  */
-  int m_NameIndex{0};
-
-  /*!
-     \var int m_VersionIndex
-     \brief The value of the Version
-  */
-  int m_VersionIndex{0};
-
-  /*!
-     \var int m_RevisionIndex
-     \brief The value of the Revision
-  */
-  int m_RevisionIndex{0};
-
-  /*!
-     \var int m_FixIndex
-     \brief The value of the Fix
-  */
-  int m_FixIndex{0};
-
-  /*!
-      \var int m_LastUpdateIndex
-      \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
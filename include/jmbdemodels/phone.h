@@ -39,10 +39,12 @@ class Phone : public CommonData {
 
 public:
   /*!
-      \fn explicit Phone()
+      \fn explicit Phone(const QSharedPointer<Model::DataContext> &dataContext = {})
       \brief The Constructor for the Phone
+      \param dataContext - The DataContext to use, the shared one if null
   */
-  explicit JMBDEMODELS_EXPORT Phone();
+  explicit JMBDEMODELS_EXPORT
+  Phone(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn ~Phone()
@@ -50,78 +52,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~Phone() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int PhoneIdIndex()
 
@@ -129,7 +60,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getPhoneIdIndex() const { return m_PhoneIdIndex; }
+  JMBDEMODELS_EXPORT int getPhoneIdIndex() const {
+    return this->getFieldIndex(Schema::Phone::PhoneId);
+  }
 
   /*!
       \fn int DeviceNameIdIndex()
@@ -139,7 +72,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getDeviceNameIdIndex() const {
-    return m_DeviceNameIdIndex;
+    return this->getFieldIndex(Schema::Phone::DeviceNameId);
   }
 
   /*!
@@ -150,7 +83,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getSerialNumberIndex() const {
-    return m_SerialNumberIndex;
+    return this->getFieldIndex(Schema::Phone::SerialNumber);
   }
 
   /*!
@@ -160,7 +93,9 @@ public:
 
      Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getNumberIndex() const { return m_NumberIndex; }
+  JMBDEMODELS_EXPORT int getNumberIndex() const {
+    return this->getFieldIndex(Schema::Phone::Number);
+  }
 
   /*!
       \fn int PinIndex()
@@ -169,7 +104,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getPinIndex() const { return m_PinIndex; }
+  JMBDEMODELS_EXPORT int getPinIndex() const {
+    return this->getFieldIndex(Schema::Phone::Pin);
+  }
 
   /*!
      \fn int ActiveIndex()
@@ -178,7 +115,9 @@ public:
 
      Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getActiveIndex() const { return m_ActiveIndex; }
+  JMBDEMODELS_EXPORT int getActiveIndex() const {
+    return this->getFieldIndex(Schema::Phone::Active);
+  }
 
   /*!
      \fn int ReplaceIndex()
@@ -187,7 +126,9 @@ public:
 
      Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getReplaceIndex() const { return m_ReplaceIndex; }
+  JMBDEMODELS_EXPORT int getReplaceIndex() const {
+    return this->getFieldIndex(Schema::Phone::Replace);
+  }
 
   /*!
      \fn int DeviceTypeIdIndex()
@@ -197,7 +138,7 @@ public:
      Returns the value of the index
   */
   JMBDEMODELS_EXPORT int getDeviceTypeIdIndex() const {
-    return m_DeviceTypeIdIndex;
+    return this->getFieldIndex(Schema::Phone::DeviceTypeId);
   }
 
   /*!
@@ -208,7 +149,7 @@ public:
      Returns the value of the index
   */
   JMBDEMODELS_EXPORT int getEmployeeIdIndex() const {
-    return m_EmployeeIdIndex;
+    return this->getFieldIndex(Schema::Phone::EmployeId);
   }
 
   /*!
@@ -218,7 +159,9 @@ public:
 
      Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getPlaceIdIndex() const { return m_PlaceIdIndex; }
+  JMBDEMODELS_EXPORT int getPlaceIdIndex() const {
+    return this->getFieldIndex(Schema::Phone::PlaceId);
+  }
 
   /*!
       \fn int DepartmentIdIndex()
@@ -228,7 +171,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getDepartmentIdIndex() const {
-    return m_DepartmentIdIndex;
+    return this->getFieldIndex(Schema::Phone::DepartmentId);
   }
 
   /*!
@@ -239,7 +182,7 @@ public:
      Returns the value of the index
   */
   JMBDEMODELS_EXPORT int getManufacturerIdIndex() const {
-    return m_ManufacturerIdIndex;
+    return this->getFieldIndex(Schema::Phone::ManufacturerId);
   }
 
   /*!
@@ -250,116 +193,16 @@ public:
      Returns the value of the index
   */
   JMBDEMODELS_EXPORT int getInventoryIdIndex() const {
-    return m_InventoryIdIndex;
+    return this->getFieldIndex(Schema::Phone::InventoryId);
   }
 
   /*!
-      \var int m_LastUpdateIndex
-      \brief The value of the LastUpdateIndex
+      \fn int getLastUpdateIndex() const
+
+      \brief Get the index of the fieldname LastUpdate form the database
   */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::Phone::LastUpdate);
   }
-
-private:
-  /**
-   * @brief tableName - the name of the database table
-   * @
-   */
-  const QString m_tableName = QLatin1String("phone");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-     \var int m_PhoneIdIndex
-     \brief The value of the PhoneIdIndex
-  */
-  int m_PhoneIdIndex{0};
-
-  /*!
-     \var int m_DeviceNameIdIndex
-     \brief The value of the DeviceNameIdIndex
-  */
-  int m_DeviceNameIdIndex{0};
-
-  /*!
-       \var int m_SerialNumberIndex
-       \brief The value of the SerialNumberIndex
-    */
-  int m_SerialNumberIndex{0};
-
-  /*!
-     \var int m_NumberIndex
-     \brief The value of the NumberIndex
-  */
-  int m_NumberIndex{0};
-
-  /*!
-     \var int m_PinIndex
-     \brief The value of the PinIndex
-  */
-  int m_PinIndex{0};
-
-  /*!
-     \var int m_ActiveIndex
-     \brief The value of the ActiveIndex
-  */
-  int m_ActiveIndex{0};
-
-  /*!
-     \var int m_ReplaceIndex
-     \brief The value of the ReplaceIndex
-  */
-  int m_ReplaceIndex{0};
-
-  /*!
-     \var int m_DeviceTypeIdIndex
-     \brief The value of the DeviceTypeIdIndex
-  */
-  int m_DeviceTypeIdIndex{0};
-
-  /*!
-     \var int m_EmployeeIdIndex
-     \brief The value of the EmployeeIdIndex
-  */
-  int m_EmployeeIdIndex{0};
-
-  /*!
-     \var int m_PlaceIdIndex
-     \brief The value of the PlaceIdIndex
-  */
-  int m_PlaceIdIndex{0};
-
-  /*!
-     \var int m_DepartmentIdIndex
-     \brief The value of the DepartmentIdIndex
-  */
-  int m_DepartmentIdIndex{0};
-
-  /*!
-     \var int m_ManufacturerIdIndex
-     \brief The value of the ManufacturerIdIndex
-  */
-  int m_ManufacturerIdIndex{0};
-
-  /*!
-     \var int m_InventoryIdIndex
-     \brief The value of the InventoryIdIndex
-  */
-  int m_InventoryIdIndex{0};
-
-  /*!
-     \var int m_LastUpdateIndex
-     \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
@@ -40,8 +40,10 @@ public:
   /*!
      \fn explicit Place(QObject *parent = nullptr)
      \brief The Constructor for the Place
+      \param dataContext - The DataContext to use, the shared one if null
  */
-  explicit JMBDEMODELS_EXPORT Place();
+  explicit JMBDEMODELS_EXPORT
+  Place(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn ~Place()
@@ -49,78 +51,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~Place() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int PlaceIdIndex()
 
@@ -128,7 +59,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getPlaceIdIndex() const { return m_PlaceIdIndex; }
+  JMBDEMODELS_EXPORT int getPlaceIdIndex() const {
+    return this->getFieldIndex(Schema::Place::PlaceId);
+  }
 
   /*!
       \fn int NameIndex()
@@ -137,7 +70,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getNameIndex() const { return m_NameIndex; }
+  JMBDEMODELS_EXPORT int getNameIndex() const {
+    return this->getFieldIndex(Schema::Place::Name);
+  }
 
   /*!
       \fn int RoomIndex()
@@ -146,7 +81,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getRoomIndex() const { return m_RoomIndex; }
+  JMBDEMODELS_EXPORT int getRoomIndex() const {
+    return this->getFieldIndex(Schema::Place::Room);
+  }
 
   /*!
       \fn int DeskIndex()
@@ -155,60 +92,17 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getDeskIndex() const { return m_DeskIndex; }
-
-  /*!
-      \var int m_LastUpdateIndex
-      \brief The value of the LastUpdateIndex
-  */
-  JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+  JMBDEMODELS_EXPORT int getDeskIndex() const {
+    return this->getFieldIndex(Schema::Place::Desk);
   }
 
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("place");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-     \var int m_PlaceIdIndex
-     \brief The value of the PlaceIdIndex
-  */
-  int m_PlaceIdIndex{0};
-
   /*!
-     \var int m_NameIndex
-     \brief The value of the NameIndex
-  */
-  int m_NameIndex{0};
+      \fn int getLastUpdateIndex() const
 
-  /*!
-     \var int m_RoomIndex
-     \brief The value of the RoomIndex
+      \brief Get the index of the fieldname LastUpdate form the database
   */
-  int m_RoomIndex{0};
-
-  /*!
-    \var int m_DeskIndex
-    \brief The value of the DeskIndex
- */
-  int m_DeskIndex{0};
-
-  /*!
-     \var int m_LastUpdateIndex
-     \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
+  JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
+    return this->getFieldIndex(Schema::Place::LastUpdate);
+  }
 };
 } // namespace Model
@@ -0,0 +1,105 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QString>
+#include <QStringList>
+
+#include "jmbdemodels_export.h"
+
+namespace Model {
+/*!
+    \struct PragmaProfile
+    \brief The PRAGMA settings for a SQLite connection
+    \details The default values are the interactive profile: WAL journal,
+             so readers and the writer don't block each other, and
+             synchronous=NORMAL, which is safe with WAL.
+             A value of -1 or an empty string leaves the SQLite default.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+struct PragmaProfile {
+  /*!
+      \var QString journalMode
+      \brief DELETE, TRUNCATE, PERSIST, MEMORY, WAL or OFF
+   */
+  QString journalMode{QStringLiteral("WAL")};
+
+  /*!
+      \var QString synchronous
+      \brief OFF, NORMAL, FULL or EXTRA
+   */
+  QString synchronous{QStringLiteral("NORMAL")};
+
+  /*!
+      \var int cacheSize
+      \brief The page cache, negative values are KiB, positive are pages
+   */
+  int cacheSize{-16384};
+
+  /*!
+      \var qint64 mmapSize
+      \brief The bytes of the file that are memory mapped
+   */
+  qint64 mmapSize{0};
+
+  /*!
+      \var QString tempStore
+      \brief DEFAULT, FILE or MEMORY
+   */
+  QString tempStore{QStringLiteral("MEMORY")};
+
+  /*!
+      \var int busyTimeout
+      \brief The msecs to wait for a lock before SQLITE_BUSY
+   */
+  int busyTimeout{5000};
+
+  /*!
+      \var int pageSize
+      \brief The page size, only used for a new database
+   */
+  int pageSize{4096};
+
+  /*!
+      \var bool queryOnly
+      \brief Reject every change of the database
+   */
+  bool queryOnly{false};
+
+  /*!
+      \fn static auto interactive() -> PragmaProfile
+      \brief The profile for the editing UI
+   */
+  JMBDEMODELS_EXPORT static auto interactive() -> PragmaProfile;
+
+  /*!
+      \fn static auto bulkLoad() -> PragmaProfile
+      \brief The profile for large imports
+      \details synchronous=OFF and a large cache. A crash of the operating
+               system during the import may lose the last transactions.
+   */
+  JMBDEMODELS_EXPORT static auto bulkLoad() -> PragmaProfile;
+
+  /*!
+      \fn static auto readOnlyReporting() -> PragmaProfile
+      \brief The profile for reports on connections that never write
+      \details Memory mapped reads, a large cache and query_only.
+   */
+  JMBDEMODELS_EXPORT static auto readOnlyReporting() -> PragmaProfile;
+
+  /*!
+      \fn auto statements() const -> QStringList
+      \brief The PRAGMA statements of the profile, in the order to run
+   */
+  JMBDEMODELS_EXPORT auto statements() const -> QStringList;
+};
+} // namespace Model
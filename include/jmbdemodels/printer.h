@@ -35,11 +35,13 @@ namespace Model {
 class Printer : public CommonData {
 public:
   /*!
-      \fn Printer()
+      \fn Printer(const QSharedPointer<Model::DataContext> &dataContext = {})
 
       \brief Constructor for the Account
+      \param dataContext - The DataContext to use, the shared one if null
    */
-  explicit JMBDEMODELS_EXPORT Printer();
+  explicit JMBDEMODELS_EXPORT
+  Printer(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
      \fn  ~Printer() override;
@@ -48,78 +50,7 @@ public:
   */
   JMBDEMODELS_EXPORT ~Printer() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int PrinterIdIndex()
 
@@ -127,7 +58,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getPrinterIdIndex() const { return m_PrinterIdIndex; }
+  JMBDEMODELS_EXPORT int getPrinterIdIndex() const {
+    return this->getFieldIndex(Schema::Printer::PrinterId);
+  }
 
   /*!
      \fn  nt SerialNumberIndex() const
@@ -137,7 +70,7 @@ public:
      Returns the value of the index
   */
   JMBDEMODELS_EXPORT int getSerialNumberIndex() const {
-    return m_SerialNumberIndex;
+    return this->getFieldIndex(Schema::Printer::SerialNumber);
   }
 
   /*!
@@ -147,7 +80,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getNetworkIndex() const { return m_NetworkIndex; }
+  JMBDEMODELS_EXPORT int getNetworkIndex() const {
+    return this->getFieldIndex(Schema::Printer::Network);
+  }
 
   /*!
       \fn int NetworkNameIndex()
@@ -157,7 +92,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getNetworkNameIndex() const {
-    return m_NetworkNameIndex;
+    return this->getFieldIndex(Schema::Printer::NetworkName);
   }
 
   /*!
@@ -168,7 +103,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getNetworkIpAddressIndex() const {
-    return m_NetworkIpAddressIndex;
+    return this->getFieldIndex(Schema::Printer::NetworkIpAddress);
   }
 
   /*!
@@ -178,7 +113,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getActiveIndex() const { return m_ActiveIndex; }
+  JMBDEMODELS_EXPORT int getActiveIndex() const {
+    return this->getFieldIndex(Schema::Printer::Active);
+  }
 
   /*!
       \fn int ReplaceIndex()
@@ -187,7 +124,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getReplaceIndex() const { return m_ReplaceIndex; }
+  JMBDEMODELS_EXPORT int getReplaceIndex() const {
+    return this->getFieldIndex(Schema::Printer::Replace);
+  }
 
   /*!
       \fn int ResourcesIndex()
@@ -196,7 +135,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getResourcesIndex() const { return m_ResourcesIndex; }
+  JMBDEMODELS_EXPORT int getResourcesIndex() const {
+    return this->getFieldIndex(Schema::Printer::Resources);
+  }
 
   /*!
       \fn int PaperSizeMaxIndex()
@@ -206,7 +147,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getPaperSizeMaxIndex() const {
-    return m_PaperSizeMaxIndex;
+    return this->getFieldIndex(Schema::Printer::PaperSizeMax);
   }
 
   /*!
@@ -216,7 +157,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getColorIndex() const { return m_ColorIndex; }
+  JMBDEMODELS_EXPORT int getColorIndex() const {
+    return this->getFieldIndex(Schema::Printer::Color);
+  }
 
   /*!
       \fn int DeviceNameIdIndex()
@@ -226,7 +169,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getDeviceNameIdIndex() const {
-    return m_DeviceNameIdIndex;
+    return this->getFieldIndex(Schema::Printer::DeviceNameId);
   }
 
   /*!
@@ -237,7 +180,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getDeviceTypeIdIndex() const {
-    return m_DeviceTypeIdIndex;
+    return this->getFieldIndex(Schema::Printer::DeviceTypeId);
   }
 
   /*!
@@ -248,7 +191,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getEmployeeIdIndex() const {
-    return m_EmployeeIdIndex;
+    return this->getFieldIndex(Schema::Printer::EmployeId);
   }
 
   /*!
@@ -258,7 +201,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getPlaceIdIndex() const { return m_PlaceIdIndex; }
+  JMBDEMODELS_EXPORT int getPlaceIdIndex() const {
+    return this->getFieldIndex(Schema::Printer::PlaceId);
+  }
 
   /*!
     \fn int DepartmentIdIndex()
@@ -268,7 +213,7 @@ public:
     Returns the value of the index
  */
   JMBDEMODELS_EXPORT int getDepartmentIdIndex() const {
-    return m_DepartmentIdIndex;
+    return this->getFieldIndex(Schema::Printer::DepartmentId);
   }
 
   /*!
@@ -279,7 +224,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getManufacurerIdIndex() const {
-    return m_ManufacturerIdIndex;
+    return this->getFieldIndex(Schema::Printer::ManufacturerId);
   }
 
   /*!
@@ -290,7 +235,7 @@ public:
      Returns the value of the index
   */
   JMBDEMODELS_EXPORT int getInventoryIdIndex() const {
-    return m_InventoryIdIndex;
+    return this->getFieldIndex(Schema::Printer::InventoryId);
   }
 
   /*!
@@ -301,7 +246,7 @@ public:
      Returns the value of the index
   */
   JMBDEMODELS_EXPORT int getComputerIdIndex() const {
-    return m_ComputerIdIndex;
+    return this->getFieldIndex(Schema::Printer::ComputerId);
   }
 
   /*!
@@ -312,137 +257,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::Printer::LastUpdate);
   }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("printer");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-      \var   int m_PrinterrIdIndex
-      \brief The value of the PrinterIdIndex
-   */
-  int m_PrinterIdIndex{0};
-
-  /*!
-     \var   int m_Name
-     \brief The value of the NameIndex
-  */
-  int m_SerialNumberIndex{0};
-
-  /*!
-      \var   nt m_NetworkIndex
-      \brief The value of the NetworkIndex
-   */
-  int m_NetworkIndex{0};
-
-  /*!
-      \var   nt m_NetworkNameIndex
-      \brief The value of the NetworkNameIndex
-   */
-  int m_NetworkNameIndex{0};
-
-  /*!
-      \var   nt m_NetworkIpAddressIndex
-      \brief The value of the NetworkIpAddressIndex
-   */
-  int m_NetworkIpAddressIndex{0};
-
-  /*!
-      \var   int m_ActiveIndex
-      \brief The value of the ActiveIndex
-   */
-  int m_ActiveIndex{0};
-
-  /*!
-      \var   int m_ReplaceIndex
-      \brief The value of the ReplaceIndex
-   */
-  int m_ReplaceIndex{0};
-
-  /*!
-      \var   int m_ResourcesIndex
-      \brief The value of the ResourcesIndex
-   */
-  int m_ResourcesIndex{0};
-
-  /*!
-      \var   int m_PaperSizeMaxIndex
-      \brief The value of the PaperSizeMaxIndex
-   */
-  int m_PaperSizeMaxIndex{0};
-
-  /*!
-      \var   int m_ColorIndex
-      \brief The value of the ColorIndex
-   */
-  int m_ColorIndex{0};
-
-  /*!
-      \var   int m_DeviceNameIdIndex
-      \brief The value of the DeviceNameIdIndex
-   */
-  int m_DeviceNameIdIndex{0};
-
-  /*!
-     \var   int m_DeviceTypeIdIndex
-     \brief The value of the DeviceTypeIdIndex
-  */
-  int m_DeviceTypeIdIndex{0};
-
-  /*!
-     \var   int m_EmployeeIdIndex
-     \brief The value of the EmployeeIdIndexx
-  */
-  int m_EmployeeIdIndex{0};
-
-  /*!
-      \var   int m_Name
-      \brief The value of the NameIndex
-   */
-  int m_PlaceIdIndex{0};
-
-  /*!
-      \var   int m_DepartmentIdIndex
-      \brief The value of the DepartmentIdIndex
-   */
-  int m_DepartmentIdIndex{0};
-
-  /*!
-      \var   int m_ManufacturerIdIndex
-      \brief The value of the ManufacturerIdIndex
-   */
-  int m_ManufacturerIdIndex{0};
-
-  /*!
-     \var   int m_InventoryIdIndex
-     \brief The value of the InventoryIdIndex
-  */
-  int m_InventoryIdIndex{0};
-
-  /*!
-     \var   int m_ComputerIdIndex
-     \brief The value of the ComputerIdIndex
-  */
-  int m_ComputerIdIndex{0};
-
-  /*!
-     \var   int m_LastUpdateIndex
-     \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
@@ -36,10 +36,12 @@ namespace Model {
 class Processor : public CommonData {
 public:
   /*!
-      \fn explicit Processor()
+      \fn explicit Processor(const QSharedPointer<Model::DataContext> &dataContext = {})
       \brief The Constructor for the Processor
+      \param dataContext - The DataContext to use, the shared one if null
   */
-  explicit JMBDEMODELS_EXPORT Processor();
+  explicit JMBDEMODELS_EXPORT
+  Processor(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn ~Processor
@@ -47,78 +49,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~Processor() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int ProcessorIdIndex()
 
@@ -127,7 +58,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getProcessorIdIndex() const {
-    return m_ProcessorIdIndex;
+    return this->getFieldIndex(Schema::Processor::ProcessorId);
   }
 
   /*!
@@ -137,7 +68,9 @@ public:
 
      Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getNameIndex() const { return m_NameIndex; }
+  JMBDEMODELS_EXPORT int getNameIndex() const {
+    return this->getFieldIndex(Schema::Processor::Name);
+  }
 
   /*!
      \fn int ClockRateIndex()
@@ -146,7 +79,9 @@ public:
 
      Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getClockRateIndex() const { return m_ClockRateIndex; }
+  JMBDEMODELS_EXPORT int getClockRateIndex() const {
+    return this->getFieldIndex(Schema::Processor::ClockRate);
+  }
 
   /*!
      \fn int CoresIndex()
@@ -155,60 +90,17 @@ public:
 
      Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getCoresIndex() const { return m_CoresIndex; }
-
-  /*!
-      \var int m_LastUpdateIndex
-      \brief The value of the LastUpdateIndex
-  */
-  JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+  JMBDEMODELS_EXPORT int getCoresIndex() const {
+    return this->getFieldIndex(Schema::Processor::Cores);
   }
 
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("processor");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-     \var int m_ProcessorIdIndex
-     \brief The value of the ProcessorIdIndex
-  */
-  int m_ProcessorIdIndex{0};
-
   /*!
-     \var int m_NameIndex
-     \brief The value of the Name
-  */
-  int m_NameIndex{0};
+      \fn int getLastUpdateIndex() const
 
-  /*!
-     \var int m_ClockRateIndex
-     \brief The value of the ClockRate ndex
+      \brief Get the index of the fieldname LastUpdate form the database
   */
-  int m_ClockRateIndex{0};
-
-  /*!
-     \var int m_CoresIndex
-     \brief The value of the CoresIndex
-  */
-  int m_CoresIndex{0};
-
-  /*!
-     \var int m_LastUpdateIndex
-     \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
+  JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
+    return this->getFieldIndex(Schema::Processor::LastUpdate);
+  }
 };
 } // namespace Model
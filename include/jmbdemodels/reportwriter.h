@@ -0,0 +1,157 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QCoreApplication>
+#include <QIODevice>
+#include <QSqlQuery>
+#include <QString>
+#include <QStringList>
+#include <QTextStream>
+#include <QVariant>
+#include <QVariantList>
+
+#include "jmbdemodels_export.h"
+
+namespace Model {
+/*!
+    \class ReportWriter
+    \brief Writes the rows of a query as HTML, CSV or JSON to a device
+    \details The rows are written one by one and the stream is flushed every
+             getChunkRows() rows, so the memory use does not depend on the
+             number of rows. Use a forward only query for large tables.
+
+             The cells are escaped for the format: HTML entities, CSV quotes
+             as in RFC 4180 and JSON strings.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+class ReportWriter {
+  Q_DECLARE_TR_FUNCTIONS(ReportWriter)
+
+public:
+  /*!
+      \enum Format
+      \brief The output formats
+   */
+  enum class Format { Html, Csv, Json };
+
+  /*!
+      \fn ReportWriter(QIODevice *device, Format format)
+
+      \brief Constructor for the ReportWriter
+      \param device - The open device to write to
+      \param format - The format of the report
+   */
+  JMBDEMODELS_EXPORT ReportWriter(QIODevice *device, Format format);
+
+  /*!
+      \fn ~ReportWriter()
+
+      \brief Finishes the report if finish() was not called
+   */
+  JMBDEMODELS_EXPORT ~ReportWriter();
+
+  ReportWriter(const ReportWriter &) = delete;
+  auto operator=(const ReportWriter &) -> ReportWriter & = delete;
+
+  /*!
+      \fn void setChunkRows(int rows)
+
+      \brief Set the number of rows after which the stream is flushed
+   */
+  JMBDEMODELS_EXPORT void setChunkRows(int rows) {
+    m_chunkRows = qMax(1, rows);
+  }
+
+  /*!
+      \fn auto getChunkRows() const -> int
+
+      \brief Get the number of rows after which the stream is flushed
+   */
+  JMBDEMODELS_EXPORT auto getChunkRows() const -> int { return m_chunkRows; }
+
+  /*!
+      \fn void begin(const QString &title, const QStringList &columns)
+
+      \brief Write the start of the report and the column headers
+      \param title - The title, used by HTML only
+      \param columns - The column names, the keys of the JSON objects
+   */
+  JMBDEMODELS_EXPORT void begin(const QString &title,
+                                const QStringList &columns);
+
+  /*!
+      \fn void writeRow(const QVariantList &values)
+
+      \brief Write one row, in the order of the columns
+   */
+  JMBDEMODELS_EXPORT void writeRow(const QVariantList &values);
+
+  /*!
+      \fn auto writeQuery(QSqlQuery &query) -> qint64
+
+      \brief Write all remaining rows of the executed query
+
+      \return the number of rows written
+   */
+  JMBDEMODELS_EXPORT auto writeQuery(QSqlQuery &query) -> qint64;
+
+  /*!
+      \fn auto finish() -> bool
+
+      \brief Write the end of the report and flush the stream
+
+      \return false if the device reported an error
+   */
+  JMBDEMODELS_EXPORT auto finish() -> bool;
+
+  /*!
+      \fn auto getRowCount() const -> qint64
+
+      \brief The number of rows written so far
+   */
+  JMBDEMODELS_EXPORT auto getRowCount() const -> qint64 { return m_rows; }
+
+  /*!
+      \fn static auto escapeCsv(const QString &value) -> QString
+
+      \brief Quote a CSV cell if it holds a separator, a quote or a newline
+   */
+  static JMBDEMODELS_EXPORT auto escapeCsv(const QString &value) -> QString;
+
+  /*!
+      \fn static auto escapeJson(const QString &value) -> QString
+
+      \brief Escape a string for a JSON string literal, without the quotes
+   */
+  static JMBDEMODELS_EXPORT auto escapeJson(const QString &value) -> QString;
+
+private:
+  /*!
+      \brief The text of a cell: dates in ISO format, blobs left out
+   */
+  static auto cellText(const QVariant &value) -> QString;
+
+  /*!
+      \brief The JSON literal of a cell
+   */
+  static auto jsonValue(const QVariant &value) -> QString;
+
+  QTextStream m_stream;
+  Format m_format;
+  QStringList m_columns;
+  qint64 m_rows{0};
+  int m_chunkRows{1000};
+  bool m_begun{false};
+  bool m_finished{false};
+};
+} // namespace Model
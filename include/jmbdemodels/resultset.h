@@ -0,0 +1,153 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QDateTime>
+#include <QMetaType>
+#include <QString>
+#include <QStringList>
+#include <QVariant>
+#include <QVariantList>
+#include <QVector>
+
+namespace Model {
+/*!
+    \struct ResultSet
+    \brief The complete result of one query
+    \details Holds the rows of a query that was run on a worker thread, so
+             it can be handed to the GUI thread without a connection.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+struct ResultSet {
+  /*!
+      \var QStringList columns
+      \brief The names of the columns
+   */
+  QStringList columns;
+
+  /*!
+      \var QVector<QVariantList> rows
+      \brief The values of every row, in the order of the columns
+   */
+  QVector<QVariantList> rows;
+
+  /*!
+      \var int numRowsAffected
+      \brief The rows changed by an INSERT, UPDATE or DELETE
+   */
+  int numRowsAffected{-1};
+
+  /*!
+      \var QVariant lastInsertId
+      \brief The id of the last inserted row, if the driver supports it
+   */
+  QVariant lastInsertId;
+
+  /*!
+      \var QString error
+      \brief The error text, empty if the query was successful
+   */
+  QString error;
+
+  /*!
+      \fn auto isValid() const -> bool
+      \brief true if the query was successful
+   */
+  auto isValid() const -> bool { return error.isEmpty(); }
+};
+
+/*!
+    \struct BatchResult
+    \brief The outcome of a batch of inserts or updates
+    \details Failed rows don't abort the batch. They are listed with the
+             index of the row in the input and the error text.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+struct BatchResult {
+  /*!
+      \struct RowError
+      \brief The error of one row of the batch
+   */
+  struct RowError {
+    int row{-1};
+    QString error;
+  };
+
+  /*!
+      \var int succeeded
+      \brief The number of rows that were written
+   */
+  int succeeded{0};
+
+  /*!
+      \var QVector<RowError> failed
+      \brief The rows that could not be written
+   */
+  QVector<RowError> failed;
+
+  /*!
+      \fn auto isValid() const -> bool
+      \brief true if every row was written
+   */
+  auto isValid() const -> bool { return failed.isEmpty(); }
+};
+
+/*!
+    \struct ChangeSet
+    \brief The rows of one table changed after a watermark
+    \details Pass the watermark to the next call to get the rows changed
+             after this one.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+struct ChangeSet {
+  /*!
+      \var QString table
+      \brief The name of the table
+   */
+  QString table;
+
+  /*!
+      \var ResultSet rows
+      \brief The changed rows, the oldest change first
+   */
+  ResultSet rows;
+
+  /*!
+      \var QVector<qint64> deleted
+      \brief The primary keys of the deleted rows, the oldest delete first
+   */
+  QVector<qint64> deleted;
+
+  /*!
+      \var QDateTime watermark
+      \brief The newest last_update or delete, or the given one if no row
+             changed
+   */
+  QDateTime watermark;
+};
+
+/*!
+    \enum RowOperation
+    \brief The kind of write that changed a row
+ */
+enum class RowOperation { Insert, Update, Delete };
+} // namespace Model
+
+Q_DECLARE_METATYPE(Model::RowOperation)
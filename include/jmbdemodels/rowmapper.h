@@ -0,0 +1,413 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QCoreApplication>
+#include <QSqlDatabase>
+#include <QSqlError>
+#include <QSqlQuery>
+#include <QStringList>
+#include <QVariant>
+#include <QVariantList>
+#include <QVector>
+
+#include <optional>
+#include <tuple>
+#include <utility>
+
+#include "resultset.h"
+#include "rows.h"
+#include "sqlitestatement.h"
+#include "statementcache.h"
+#include "transaction.h"
+
+namespace Model {
+namespace RowMapping {
+
+// Read one column into a member, from a QSqlQuery value ...
+
+inline void read(const QVariant &value, qint64 &member) {
+  member = value.toLongLong();
+}
+inline void read(const QVariant &value, double &member) {
+  member = value.toDouble();
+}
+inline void read(const QVariant &value, bool &member) {
+  member = value.toBool();
+}
+inline void read(const QVariant &value, QString &member) {
+  member = value.toString();
+}
+inline void read(const QVariant &value, QDate &member) {
+  member = value.toDate();
+}
+inline void read(const QVariant &value, QDateTime &member) {
+  member = value.toDateTime();
+}
+inline void read(const QVariant &value, QByteArray &member) {
+  member = value.toByteArray();
+}
+template <typename T>
+void read(const QVariant &value, std::optional<T> &member) {
+  if (value.isNull()) {
+    member.reset();
+  } else {
+    read(value, member.emplace());
+  }
+}
+
+// ... or straight from the sqlite3 statement
+
+inline void read(const SqliteStatement &row, int column, qint64 &member) {
+  member = row.toInt64(column);
+}
+inline void read(const SqliteStatement &row, int column, double &member) {
+  member = row.toDouble(column);
+}
+inline void read(const SqliteStatement &row, int column, bool &member) {
+  member = row.toInt64(column) != 0;
+}
+inline void read(const SqliteStatement &row, int column, QString &member) {
+  member = row.toString(column);
+}
+inline void read(const SqliteStatement &row, int column, QDate &member) {
+  member = QDate::fromString(row.toString(column), Qt::ISODate);
+}
+inline void read(const SqliteStatement &row, int column, QDateTime &member) {
+  member = QDateTime::fromString(row.toString(column), Qt::ISODateWithMs);
+}
+inline void read(const SqliteStatement &row, int column, QByteArray &member) {
+  member = row.toByteArray(column);
+}
+template <typename T>
+void read(const SqliteStatement &row, int column, std::optional<T> &member) {
+  if (row.isNull(column)) {
+    member.reset();
+  } else {
+    read(row, column, member.emplace());
+  }
+}
+
+// The value to bind for a member, NULL for empty optionals
+
+template <typename T> auto bindValue(const T &member) -> QVariant {
+  return QVariant::fromValue(member);
+}
+template <typename T>
+auto bindValue(const std::optional<T> &member) -> QVariant {
+  return member.has_value() ? QVariant::fromValue(*member) : QVariant();
+}
+
+/*!
+    \fn template <typename Row, typename F> void forEachField(Row &row, F &&f)
+    \brief Call f(column, member) for every member of the row
+   */
+template <typename Row, typename F> void forEachField(Row &row, F &&f) {
+  std::apply(
+      [&row, &f](auto... members) {
+        int column = 0;
+        (f(column++, row.*members), ...);
+      },
+      Row::fields());
+}
+
+/*!
+    \fn template <typename Row> auto columnList() -> QString
+    \brief The columns of the row in their order, separated by commas
+   */
+template <typename Row> auto columnList() -> QString {
+  const auto &table = Row::table();
+  QStringList columns;
+  for (std::size_t i = 0; i < table.columnCount; ++i) {
+    columns.append(QLatin1String(table.columns[i].name));
+  }
+  return columns.join(QLatin1Char(','));
+}
+} // namespace RowMapping
+
+/*!
+    \class RowReader
+    \brief Reads the rows of a table into the plain struct of the table
+    \details The columns are selected in the order of the struct and are
+             copied by position, no field names are looked up. On a SQLite
+             connection of a library built with WITH_SQLITE3 the rows are
+             read from the sqlite3 statement without a QVariant per cell.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+template <typename Row> class RowReader {
+public:
+  /*!
+      \fn RowReader(const QSqlDatabase &db)
+
+      \brief Constructor for the RowReader
+      \param db - The connection to read from
+   */
+  explicit RowReader(const QSqlDatabase &db) : m_db(db) {}
+
+  /*!
+      \fn template <typename F> auto forEach(F &&f, const QString &where = {},
+                                             const QVariantList &binds = {})
+                -> bool
+
+      \brief Call f(const Row &) for every row
+      \param where - An optional condition with ? placeholders
+      \param binds - The values for the placeholders
+
+      \return false on an error, see lastError()
+   */
+  template <typename F>
+  auto forEach(F &&f, const QString &where = {},
+               const QVariantList &binds = {}) -> bool {
+    auto sql = QLatin1String("SELECT ") + RowMapping::columnList<Row>() +
+               QLatin1String(" FROM ") + QLatin1String(Row::table().name);
+    if (!where.isEmpty()) {
+      sql += QLatin1String(" WHERE ") + where;
+    }
+
+    this->m_error.clear();
+    Row row;
+
+    if (SqliteStatement::isSupported(this->m_db)) {
+      SqliteStatement statement(this->m_db, sql);
+      for (int i = 0; statement.isValid() && i < binds.size(); ++i) {
+        statement.bind(i, binds.at(i));
+      }
+      while (statement.next()) {
+        RowMapping::forEachField(row, [&statement](int column, auto &member) {
+          RowMapping::read(statement, column, member);
+        });
+        f(std::as_const(row));
+      }
+      this->m_error = statement.lastError();
+      return this->m_error.isEmpty();
+    }
+
+    QSqlQuery query(this->m_db);
+    query.setForwardOnly(true);
+    if (!query.prepare(sql)) {
+      this->m_error = query.lastError().text();
+      return false;
+    }
+    for (int i = 0; i < binds.size(); ++i) {
+      query.bindValue(i, binds.at(i));
+    }
+    if (!query.exec()) {
+      this->m_error = query.lastError().text();
+      return false;
+    }
+    while (query.next()) {
+      RowMapping::forEachField(row, [&query](int column, auto &member) {
+        RowMapping::read(query.value(column), member);
+      });
+      f(std::as_const(row));
+    }
+    return true;
+  }
+
+  /*!
+      \fn auto select(const QString &where = {},
+                      const QVariantList &binds = {}) -> QVector<Row>
+
+      \brief Read the rows into a vector
+
+      \return the rows, empty on an error
+   */
+  auto select(const QString &where = {}, const QVariantList &binds = {})
+      -> QVector<Row> {
+    QVector<Row> rows;
+    if (!this->forEach([&rows](const Row &row) { rows.append(row); }, where,
+                       binds)) {
+      rows.clear();
+    }
+    return rows;
+  }
+
+  /*!
+      \fn auto lastError() const -> QString
+
+      \brief The error of the last read, empty if it succeeded
+   */
+  auto lastError() const -> QString { return m_error; }
+
+private:
+  QSqlDatabase m_db;
+  QString m_error;
+};
+
+/*!
+    \class RowWriter
+    \brief Inserts and updates the plain struct of a table
+    \details The statements are prepared once per writer and the members are
+             bound by position.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+template <typename Row> class RowWriter {
+public:
+  /*!
+      \fn RowWriter(const QSqlDatabase &db)
+
+      \brief Constructor for the RowWriter
+      \param db - The connection to write to
+   */
+  explicit RowWriter(const QSqlDatabase &db) : m_db(db), m_statements(4) {}
+
+  /*!
+      \fn auto insert(Row &row) -> bool
+
+      \brief Insert the row
+      \details A primary key of 0 is assigned by the database and written
+               back to the row.
+   */
+  auto insert(Row &row) -> bool {
+    const auto &table = Row::table();
+    const bool withKey = primaryKey(row) != 0;
+
+    QStringList columns;
+    QStringList placeholders;
+    for (std::size_t i = withKey ? 0 : 1; i < table.columnCount; ++i) {
+      columns.append(QLatin1String(table.columns[i].name));
+      placeholders.append(QLatin1String("?"));
+    }
+
+    auto *query = this->m_statements.prepare(
+        this->m_db,
+        withKey ? QStringLiteral("INSERT|KEY") : QStringLiteral("INSERT"),
+        QLatin1String("INSERT INTO ") + QLatin1String(table.name) +
+            QLatin1String(" (") + columns.join(QLatin1Char(',')) +
+            QLatin1String(") VALUES(") + placeholders.join(QLatin1Char(',')) +
+            QLatin1String(")"));
+    if (query == nullptr) {
+      this->m_error = tr("Fehler beim Vorbereiten von INSERT");
+      return false;
+    }
+
+    int position = 0;
+    RowMapping::forEachField(row, [&](int column, const auto &member) {
+      if (column > 0 || withKey) {
+        query->bindValue(position++, RowMapping::bindValue(member));
+      }
+    });
+
+    if (!query->exec()) {
+      this->m_error = query->lastError().text();
+      return false;
+    }
+    if (!withKey) {
+      primaryKey(row) = query->lastInsertId().toLongLong();
+    }
+    this->m_error.clear();
+    return true;
+  }
+
+  /*!
+      \fn auto update(const Row &row) -> bool
+
+      \brief Write all columns of the row with the primary key of the row
+      \details last_update is left out, the triggers of
+               DataContext::createChangeTracking() set it.
+   */
+  auto update(const Row &row) -> bool {
+    const auto &table = Row::table();
+    const auto lastUpdate = table.indexOf("last_update");
+
+    QStringList assignments;
+    for (std::size_t i = 1; i < table.columnCount; ++i) {
+      if (static_cast<int>(i) == lastUpdate) {
+        continue;
+      }
+      assignments.append(QLatin1String(table.columns[i].name) +
+                         QLatin1String(" = ?"));
+    }
+
+    auto *query = this->m_statements.prepare(
+        this->m_db, QStringLiteral("UPDATE"),
+        QLatin1String("UPDATE ") + QLatin1String(table.name) +
+            QLatin1String(" SET ") + assignments.join(QLatin1Char(',')) +
+            QLatin1String(" WHERE ") +
+            QLatin1String(table.primaryKey().name) + QLatin1String(" = ?"));
+    if (query == nullptr) {
+      this->m_error = tr("Fehler beim Vorbereiten von UPDATE");
+      return false;
+    }
+
+    int position = 0;
+    RowMapping::forEachField(row, [&](int column, const auto &member) {
+      if (column > 0 && column != lastUpdate) {
+        query->bindValue(position++, RowMapping::bindValue(member));
+      }
+    });
+    query->bindValue(position, QVariant(primaryKey(row)));
+
+    if (!query->exec()) {
+      this->m_error = query->lastError().text();
+      return false;
+    }
+    this->m_error.clear();
+    return query->numRowsAffected() != 0;
+  }
+
+  /*!
+      \fn auto insert(QVector<Row> &rows) -> BatchResult
+
+      \brief Insert the rows in one transaction
+      \details Every row is a savepoint of its own, so a row that fails is
+               reported and skipped and the others are committed, also on
+               PostgreSQL, where an error aborts the whole transaction.
+   */
+  auto insert(QVector<Row> &rows) -> BatchResult {
+    BatchResult result;
+    Transaction transaction(this->m_db);
+
+    for (int i = 0; i < rows.size(); ++i) {
+      Transaction savepoint(this->m_db);
+      if (this->insert(rows[i]) &&
+          (!savepoint.isActive() || savepoint.commit())) {
+        ++result.succeeded;
+      } else {
+        savepoint.rollback();
+        result.failed.append({i, this->m_error});
+      }
+    }
+
+    if (transaction.isActive() && !transaction.commit()) {
+      this->m_error = transaction.lastError();
+      result.failed.append({-1, this->m_error});
+      result.succeeded = 0;
+    }
+    return result;
+  }
+
+  /*!
+      \fn auto lastError() const -> QString
+
+      \brief The error of the last write, empty if it succeeded
+   */
+  auto lastError() const -> QString { return m_error; }
+
+private:
+  static auto tr(const char *text) -> QString {
+    return QCoreApplication::translate("Model::RowWriter", text);
+  }
+
+  template <typename R> static auto primaryKey(R &row) -> auto & {
+    return row.*std::get<0>(Row::fields());
+  }
+
+  QSqlDatabase m_db;
+  StatementCache m_statements;
+  QString m_error;
+};
+} // namespace Model
@@ -0,0 +1,949 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QDate>
+#include <QDateTime>
+#include <QString>
+#include <QtGlobal>
+
+#include <optional>
+#include <tuple>
+
+#include "schema.h"
+
+/*!
+    \file rows.h
+    \brief One plain struct per table of Model::Schema
+    \details The members are in the order of the columns. The primary key is
+             0 for a row that is not stored yet. Numbers and booleans that may
+             be NULL are std::optional; strings, dates and blobs use their
+             null value. fields() lists the members for RowReader and
+             RowWriter.
+   */
+namespace Model {
+
+/*!
+    \struct AccountRow
+    \brief One row of the table account
+   */
+struct AccountRow {
+  qint64 accountId{0};
+  QString userName;
+  QString password;
+  std::optional<qint64> systemDataId;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::Account::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&AccountRow::accountId, &AccountRow::userName,
+                           &AccountRow::password, &AccountRow::systemDataId,
+                           &AccountRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(AccountRow::fields())> ==
+              Schema::Account::ColumnCount);
+
+/*!
+    \struct ChipCardRow
+    \brief One row of the table chip_card
+   */
+struct ChipCardRow {
+  qint64 chipCardId{0};
+  QString number;
+  std::optional<qint64> chipCardDoorId;
+  std::optional<qint64> chipCardProfileId;
+  std::optional<qint64> employeeId;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::ChipCard::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&ChipCardRow::chipCardId, &ChipCardRow::number,
+                           &ChipCardRow::chipCardDoorId,
+                           &ChipCardRow::chipCardProfileId,
+                           &ChipCardRow::employeeId, &ChipCardRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(ChipCardRow::fields())> ==
+              Schema::ChipCard::ColumnCount);
+
+/*!
+    \struct ChipCardDoorRow
+    \brief One row of the table chip_card_door
+   */
+struct ChipCardDoorRow {
+  qint64 chipCardDoorId{0};
+  QString number;
+  std::optional<qint64> placeId;
+  std::optional<qint64> departmentId;
+  std::optional<qint64> employeeId;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::ChipCardDoor::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&ChipCardDoorRow::chipCardDoorId,
+                           &ChipCardDoorRow::number, &ChipCardDoorRow::placeId,
+                           &ChipCardDoorRow::departmentId,
+                           &ChipCardDoorRow::employeeId,
+                           &ChipCardDoorRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(ChipCardDoorRow::fields())> ==
+              Schema::ChipCardDoor::ColumnCount);
+
+/*!
+    \struct ChipCardProfileRow
+    \brief One row of the table chip_card_profile
+   */
+struct ChipCardProfileRow {
+  qint64 chipCardProfileId{0};
+  QString number;
+  std::optional<qint64> chipCardDoorId;
+  std::optional<qint64> employeeId;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::ChipCardProfile::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&ChipCardProfileRow::chipCardProfileId,
+                           &ChipCardProfileRow::number,
+                           &ChipCardProfileRow::chipCardDoorId,
+                           &ChipCardProfileRow::employeeId,
+                           &ChipCardProfileRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(ChipCardProfileRow::fields())> ==
+              Schema::ChipCardProfile::ColumnCount);
+
+/*!
+    \struct ChipCardProfileDoorRow
+    \brief One row of the table chip_card_profile_door
+   */
+struct ChipCardProfileDoorRow {
+  qint64 chipCardProfileDoorId{0};
+  std::optional<qint64> chipCardProfileId;
+  std::optional<qint64> chipCardDoorId;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::ChipCardProfileDoor::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&ChipCardProfileDoorRow::chipCardProfileDoorId,
+                           &ChipCardProfileDoorRow::chipCardProfileId,
+                           &ChipCardProfileDoorRow::chipCardDoorId,
+                           &ChipCardProfileDoorRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(ChipCardProfileDoorRow::fields())> ==
+              Schema::ChipCardProfileDoor::ColumnCount);
+
+/*!
+    \struct CityNameRow
+    \brief One row of the table city_name
+   */
+struct CityNameRow {
+  qint64 cityNameId{0};
+  QString name;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::CityName::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&CityNameRow::cityNameId, &CityNameRow::name,
+                           &CityNameRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(CityNameRow::fields())> ==
+              Schema::CityName::ColumnCount);
+
+/*!
+    \struct CompanyRow
+    \brief One row of the table company
+   */
+struct CompanyRow {
+  qint64 companyId{0};
+  QString name;
+  QString name2;
+  QString street;
+  QString city;
+  std::optional<qint64> zipCode;
+  QString phoneNumber;
+  QString faxNumber;
+  QString mobileNumber;
+  QString mailAddress;
+  std::optional<bool> active;
+  std::optional<qint64> employeeId;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::Company::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&CompanyRow::companyId, &CompanyRow::name,
+                           &CompanyRow::name2, &CompanyRow::street,
+                           &CompanyRow::city, &CompanyRow::zipCode,
+                           &CompanyRow::phoneNumber, &CompanyRow::faxNumber,
+                           &CompanyRow::mobileNumber, &CompanyRow::mailAddress,
+                           &CompanyRow::active, &CompanyRow::employeeId,
+                           &CompanyRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(CompanyRow::fields())> ==
+              Schema::Company::ColumnCount);
+
+/*!
+    \struct ComputerRow
+    \brief One row of the table computer
+   */
+struct ComputerRow {
+  qint64 computerId{0};
+  std::optional<qint64> deviceNameId;
+  QString serialNumber;
+  QString serviceTag;
+  QString serviceNumber;
+  std::optional<qint64> memory;
+  QString network;
+  QString networkName;
+  QString networkIpAddress;
+  std::optional<bool> active;
+  std::optional<bool> replace;
+  std::optional<qint64> deviceTypeId;
+  std::optional<qint64> employeeId;
+  std::optional<qint64> placeId;
+  std::optional<qint64> departmentId;
+  std::optional<qint64> manufacturerId;
+  std::optional<qint64> inventoryId;
+  std::optional<qint64> processorId;
+  std::optional<qint64> osId;
+  std::optional<qint64> computerSoftwareId;
+  std::optional<qint64> printerId;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::Computer::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&ComputerRow::computerId,
+                           &ComputerRow::deviceNameId,
+                           &ComputerRow::serialNumber,
+                           &ComputerRow::serviceTag,
+                           &ComputerRow::serviceNumber, &ComputerRow::memory,
+                           &ComputerRow::network, &ComputerRow::networkName,
+                           &ComputerRow::networkIpAddress,
+                           &ComputerRow::active, &ComputerRow::replace,
+                           &ComputerRow::deviceTypeId,
+                           &ComputerRow::employeeId, &ComputerRow::placeId,
+                           &ComputerRow::departmentId,
+                           &ComputerRow::manufacturerId,
+                           &ComputerRow::inventoryId,
+                           &ComputerRow::processorId, &ComputerRow::osId,
+                           &ComputerRow::computerSoftwareId,
+                           &ComputerRow::printerId, &ComputerRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(ComputerRow::fields())> ==
+              Schema::Computer::ColumnCount);
+
+/*!
+    \struct ComputerSoftwareRow
+    \brief One row of the table computer_software
+   */
+struct ComputerSoftwareRow {
+  qint64 computerSoftwareId{0};
+  std::optional<qint64> computerId;
+  std::optional<qint64> softwareId;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::ComputerSoftware::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&ComputerSoftwareRow::computerSoftwareId,
+                           &ComputerSoftwareRow::computerId,
+                           &ComputerSoftwareRow::softwareId,
+                           &ComputerSoftwareRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(ComputerSoftwareRow::fields())> ==
+              Schema::ComputerSoftware::ColumnCount);
+
+/*!
+    \struct DepartmentRow
+    \brief One row of the table department
+   */
+struct DepartmentRow {
+  qint64 departmentId{0};
+  QString name;
+  std::optional<qint64> priority;
+  std::optional<qint64> printerId;
+  std::optional<qint64> faxId;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::Department::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&DepartmentRow::departmentId, &DepartmentRow::name,
+                           &DepartmentRow::priority, &DepartmentRow::printerId,
+                           &DepartmentRow::faxId, &DepartmentRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(DepartmentRow::fields())> ==
+              Schema::Department::ColumnCount);
+
+/*!
+    \struct DeviceNameRow
+    \brief One row of the table device_name
+   */
+struct DeviceNameRow {
+  qint64 deviceNameId{0};
+  QString name;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::DeviceName::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&DeviceNameRow::deviceNameId, &DeviceNameRow::name,
+                           &DeviceNameRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(DeviceNameRow::fields())> ==
+              Schema::DeviceName::ColumnCount);
+
+/*!
+    \struct DeviceTypeRow
+    \brief One row of the table device_type
+   */
+struct DeviceTypeRow {
+  qint64 deviceTypeId{0};
+  QString name;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::DeviceType::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&DeviceTypeRow::deviceTypeId, &DeviceTypeRow::name,
+                           &DeviceTypeRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(DeviceTypeRow::fields())> ==
+              Schema::DeviceType::ColumnCount);
+
+/*!
+    \struct DocumentRow
+    \brief One row of the table document
+   */
+struct DocumentRow {
+  qint64 documentId{0};
+  QString name;
+  QByteArray documentData;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::Document::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&DocumentRow::documentId, &DocumentRow::name,
+                           &DocumentRow::documentData,
+                           &DocumentRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(DocumentRow::fields())> ==
+              Schema::Document::ColumnCount);
+
+/*!
+    \struct EmployeeAccountRow
+    \brief One row of the table employee_account
+   */
+struct EmployeeAccountRow {
+  qint64 employeeAccountId{0};
+  std::optional<qint64> employeId;
+  std::optional<qint64> accountId;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::EmployeeAccount::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&EmployeeAccountRow::employeeAccountId,
+                           &EmployeeAccountRow::employeId,
+                           &EmployeeAccountRow::accountId,
+                           &EmployeeAccountRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(EmployeeAccountRow::fields())> ==
+              Schema::EmployeeAccount::ColumnCount);
+
+/*!
+    \struct EmployeeRow
+    \brief One row of the table employee
+   */
+struct EmployeeRow {
+  qint64 employeeId{0};
+  std::optional<qint64> employeeNr;
+  std::optional<qint64> gender;
+  std::optional<qint64> titleId;
+  QString firstName;
+  QString lastName;
+  QDate birthDay;
+  QString address;
+  std::optional<qint64> zipCityId;
+  QString homePhone;
+  QString homeMobile;
+  QString homeMailAddress;
+  QString businessMailAddress;
+  std::optional<bool> dataCare;
+  std::optional<bool> active;
+  QByteArray photo;
+  QString notes;
+  QDate hireDate;
+  QDate endDate;
+  std::optional<qint64> departmentId;
+  std::optional<qint64> functionId;
+  std::optional<qint64> computerId;
+  std::optional<qint64> printerId;
+  std::optional<qint64> phoneId;
+  std::optional<qint64> mobileId;
+  std::optional<qint64> faxId;
+  std::optional<qint64> employeeAccountId;
+  std::optional<qint64> employeeDocumentId;
+  std::optional<qint64> chipCardId;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::Employee::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&EmployeeRow::employeeId, &EmployeeRow::employeeNr,
+                           &EmployeeRow::gender, &EmployeeRow::titleId,
+                           &EmployeeRow::firstName, &EmployeeRow::lastName,
+                           &EmployeeRow::birthDay, &EmployeeRow::address,
+                           &EmployeeRow::zipCityId, &EmployeeRow::homePhone,
+                           &EmployeeRow::homeMobile,
+                           &EmployeeRow::homeMailAddress,
+                           &EmployeeRow::businessMailAddress,
+                           &EmployeeRow::dataCare, &EmployeeRow::active,
+                           &EmployeeRow::photo, &EmployeeRow::notes,
+                           &EmployeeRow::hireDate, &EmployeeRow::endDate,
+                           &EmployeeRow::departmentId,
+                           &EmployeeRow::functionId, &EmployeeRow::computerId,
+                           &EmployeeRow::printerId, &EmployeeRow::phoneId,
+                           &EmployeeRow::mobileId, &EmployeeRow::faxId,
+                           &EmployeeRow::employeeAccountId,
+                           &EmployeeRow::employeeDocumentId,
+                           &EmployeeRow::chipCardId, &EmployeeRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(EmployeeRow::fields())> ==
+              Schema::Employee::ColumnCount);
+
+/*!
+    \struct EmployeeDocumentRow
+    \brief One row of the table employee_document
+   */
+struct EmployeeDocumentRow {
+  qint64 employeeDocumentId{0};
+  std::optional<qint64> employeId;
+  std::optional<qint64> documentId;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::EmployeeDocument::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&EmployeeDocumentRow::employeeDocumentId,
+                           &EmployeeDocumentRow::employeId,
+                           &EmployeeDocumentRow::documentId,
+                           &EmployeeDocumentRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(EmployeeDocumentRow::fields())> ==
+              Schema::EmployeeDocument::ColumnCount);
+
+/*!
+    \struct FaxRow
+    \brief One row of the table fax
+   */
+struct FaxRow {
+  qint64 faxId{0};
+  std::optional<qint64> deviceNameId;
+  QString serialNumber;
+  QString number;
+  QString pin;
+  std::optional<bool> active;
+  std::optional<bool> replace;
+  std::optional<qint64> deviceTypeId;
+  std::optional<qint64> employeeId;
+  std::optional<qint64> placeId;
+  std::optional<qint64> departmentId;
+  std::optional<qint64> manufacturerId;
+  std::optional<qint64> inventoryId;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::Fax::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&FaxRow::faxId, &FaxRow::deviceNameId,
+                           &FaxRow::serialNumber, &FaxRow::number,
+                           &FaxRow::pin, &FaxRow::active, &FaxRow::replace,
+                           &FaxRow::deviceTypeId, &FaxRow::employeeId,
+                           &FaxRow::placeId, &FaxRow::departmentId,
+                           &FaxRow::manufacturerId, &FaxRow::inventoryId,
+                           &FaxRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(FaxRow::fields())> ==
+              Schema::Fax::ColumnCount);
+
+/*!
+    \struct FunctionRow
+    \brief One row of the table function
+   */
+struct FunctionRow {
+  qint64 functionId{0};
+  QString name;
+  std::optional<qint64> priority;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::Function::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&FunctionRow::functionId, &FunctionRow::name,
+                           &FunctionRow::priority, &FunctionRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(FunctionRow::fields())> ==
+              Schema::Function::ColumnCount);
+
+/*!
+    \struct InventoryRow
+    \brief One row of the table inventory
+   */
+struct InventoryRow {
+  qint64 inventoryId{0};
+  QString number;
+  QString text;
+  std::optional<bool> active;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::Inventory::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&InventoryRow::inventoryId, &InventoryRow::number,
+                           &InventoryRow::text, &InventoryRow::active,
+                           &InventoryRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(InventoryRow::fields())> ==
+              Schema::Inventory::ColumnCount);
+
+/*!
+    \struct ManufacturerRow
+    \brief One row of the table manufacturer
+   */
+struct ManufacturerRow {
+  qint64 manufacturerId{0};
+  QString name;
+  QString name2;
+  QString supporter;
+  QString address;
+  QString address2;
+  std::optional<qint64> zipCityId;
+  QString mailAddress;
+  QString phoneNumber;
+  QString faxNumber;
+  QString hotlineNumber;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::Manufacturer::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&ManufacturerRow::manufacturerId,
+                           &ManufacturerRow::name, &ManufacturerRow::name2,
+                           &ManufacturerRow::supporter,
+                           &ManufacturerRow::address,
+                           &ManufacturerRow::address2,
+                           &ManufacturerRow::zipCityId,
+                           &ManufacturerRow::mailAddress,
+                           &ManufacturerRow::phoneNumber,
+                           &ManufacturerRow::faxNumber,
+                           &ManufacturerRow::hotlineNumber,
+                           &ManufacturerRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(ManufacturerRow::fields())> ==
+              Schema::Manufacturer::ColumnCount);
+
+/*!
+    \struct MobileRow
+    \brief One row of the table mobile
+   */
+struct MobileRow {
+  qint64 mobileId{0};
+  std::optional<qint64> deviceNameId;
+  QString serialNumber;
+  QString number;
+  QString pin;
+  QString cardNumber;
+  std::optional<bool> active;
+  std::optional<bool> replace;
+  std::optional<qint64> deviceTypeId;
+  std::optional<qint64> employeId;
+  std::optional<qint64> placeId;
+  std::optional<qint64> departmentId;
+  std::optional<qint64> manufacturerId;
+  std::optional<qint64> inventoryId;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::Mobile::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&MobileRow::mobileId, &MobileRow::deviceNameId,
+                           &MobileRow::serialNumber, &MobileRow::number,
+                           &MobileRow::pin, &MobileRow::cardNumber,
+                           &MobileRow::active, &MobileRow::replace,
+                           &MobileRow::deviceTypeId, &MobileRow::employeId,
+                           &MobileRow::placeId, &MobileRow::departmentId,
+                           &MobileRow::manufacturerId, &MobileRow::inventoryId,
+                           &MobileRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(MobileRow::fields())> ==
+              Schema::Mobile::ColumnCount);
+
+/*!
+    \struct OsRow
+    \brief One row of the table os
+   */
+struct OsRow {
+  qint64 osId{0};
+  QString name;
+  QString version;
+  QString revision;
+  QString fix;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::Os::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&OsRow::osId, &OsRow::name, &OsRow::version,
+                           &OsRow::revision, &OsRow::fix, &OsRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(OsRow::fields())> ==
+              Schema::Os::ColumnCount);
+
+/*!
+    \struct PhoneRow
+    \brief One row of the table phone
+   */
+struct PhoneRow {
+  qint64 phoneId{0};
+  std::optional<qint64> deviceNameId;
+  QString serialNumber;
+  QString number;
+  QString pin;
+  std::optional<bool> active;
+  std::optional<bool> replace;
+  std::optional<qint64> deviceTypeId;
+  std::optional<qint64> employeId;
+  std::optional<qint64> placeId;
+  std::optional<qint64> departmentId;
+  std::optional<qint64> manufacturerId;
+  std::optional<qint64> inventoryId;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::Phone::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&PhoneRow::phoneId, &PhoneRow::deviceNameId,
+                           &PhoneRow::serialNumber, &PhoneRow::number,
+                           &PhoneRow::pin, &PhoneRow::active,
+                           &PhoneRow::replace, &PhoneRow::deviceTypeId,
+                           &PhoneRow::employeId, &PhoneRow::placeId,
+                           &PhoneRow::departmentId, &PhoneRow::manufacturerId,
+                           &PhoneRow::inventoryId, &PhoneRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(PhoneRow::fields())> ==
+              Schema::Phone::ColumnCount);
+
+/*!
+    \struct PlaceRow
+    \brief One row of the table place
+   */
+struct PlaceRow {
+  qint64 placeId{0};
+  QString name;
+  QString room;
+  QString desk;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::Place::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&PlaceRow::placeId, &PlaceRow::name,
+                           &PlaceRow::room, &PlaceRow::desk,
+                           &PlaceRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(PlaceRow::fields())> ==
+              Schema::Place::ColumnCount);
+
+/*!
+    \struct PrinterRow
+    \brief One row of the table printer
+   */
+struct PrinterRow {
+  qint64 printerId{0};
+  std::optional<qint64> deviceNameId;
+  QString serialNumber;
+  QString network;
+  QString networkName;
+  QString networkIpAddress;
+  std::optional<bool> active;
+  std::optional<bool> replace;
+  QString resources;
+  QString paperSizeMax;
+  std::optional<bool> color;
+  std::optional<qint64> deviceTypeId;
+  std::optional<qint64> employeId;
+  std::optional<qint64> placeId;
+  std::optional<qint64> departmentId;
+  std::optional<qint64> manufacturerId;
+  std::optional<qint64> inventoryId;
+  std::optional<qint64> computerId;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::Printer::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&PrinterRow::printerId, &PrinterRow::deviceNameId,
+                           &PrinterRow::serialNumber, &PrinterRow::network,
+                           &PrinterRow::networkName,
+                           &PrinterRow::networkIpAddress, &PrinterRow::active,
+                           &PrinterRow::replace, &PrinterRow::resources,
+                           &PrinterRow::paperSizeMax, &PrinterRow::color,
+                           &PrinterRow::deviceTypeId, &PrinterRow::employeId,
+                           &PrinterRow::placeId, &PrinterRow::departmentId,
+                           &PrinterRow::manufacturerId,
+                           &PrinterRow::inventoryId, &PrinterRow::computerId,
+                           &PrinterRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(PrinterRow::fields())> ==
+              Schema::Printer::ColumnCount);
+
+/*!
+    \struct ProcessorRow
+    \brief One row of the table processor
+   */
+struct ProcessorRow {
+  qint64 processorId{0};
+  QString name;
+  std::optional<double> clockRate;
+  std::optional<qint64> cores;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::Processor::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&ProcessorRow::processorId, &ProcessorRow::name,
+                           &ProcessorRow::clockRate, &ProcessorRow::cores,
+                           &ProcessorRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(ProcessorRow::fields())> ==
+              Schema::Processor::ColumnCount);
+
+/*!
+    \struct SoftwareRow
+    \brief One row of the table software
+   */
+struct SoftwareRow {
+  qint64 softwareId{0};
+  QString name;
+  QString version;
+  QString revision;
+  QString fix;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::Software::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&SoftwareRow::softwareId, &SoftwareRow::name,
+                           &SoftwareRow::version, &SoftwareRow::revision,
+                           &SoftwareRow::fix, &SoftwareRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(SoftwareRow::fields())> ==
+              Schema::Software::ColumnCount);
+
+/*!
+    \struct SystemDataRow
+    \brief One row of the table system_data
+   */
+struct SystemDataRow {
+  qint64 systemDataId{0};
+  QString name;
+  std::optional<bool> local;
+  std::optional<qint64> companyId;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::SystemData::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&SystemDataRow::systemDataId, &SystemDataRow::name,
+                           &SystemDataRow::local, &SystemDataRow::companyId,
+                           &SystemDataRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(SystemDataRow::fields())> ==
+              Schema::SystemData::ColumnCount);
+
+/*!
+    \struct TitleRow
+    \brief One row of the table title
+   */
+struct TitleRow {
+  qint64 titleId{0};
+  QString name;
+  QDate fromDate;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::Title::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&TitleRow::titleId, &TitleRow::name,
+                           &TitleRow::fromDate, &TitleRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(TitleRow::fields())> ==
+              Schema::Title::ColumnCount);
+
+/*!
+    \struct ZipCityRow
+    \brief One row of the table zip_city
+   */
+struct ZipCityRow {
+  qint64 zipCityId{0};
+  std::optional<qint64> zipCodeId;
+  std::optional<qint64> cityId;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::ZipCity::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&ZipCityRow::zipCityId, &ZipCityRow::zipCodeId,
+                           &ZipCityRow::cityId, &ZipCityRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(ZipCityRow::fields())> ==
+              Schema::ZipCity::ColumnCount);
+
+/*!
+    \struct ZipCodeRow
+    \brief One row of the table zip_code
+   */
+struct ZipCodeRow {
+  qint64 zipCodeId{0};
+  QString code;
+  QDateTime lastUpdate;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::ZipCode::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&ZipCodeRow::zipCodeId, &ZipCodeRow::code,
+                           &ZipCodeRow::lastUpdate);
+  }
+};
+static_assert(std::tuple_size_v<decltype(ZipCodeRow::fields())> ==
+              Schema::ZipCode::ColumnCount);
+
+/*!
+    \struct DatabaseVersionRow
+    \brief One row of the table database_version
+   */
+struct DatabaseVersionRow {
+  qint64 databaseVersionId{0};
+  QString version;
+  QString revision;
+  QString patch;
+
+  static constexpr auto table() -> const TableDescriptor & {
+    return Schema::DatabaseVersion::Table;
+  }
+
+  static constexpr auto fields() {
+    return std::make_tuple(&DatabaseVersionRow::databaseVersionId,
+                           &DatabaseVersionRow::version,
+                           &DatabaseVersionRow::revision,
+                           &DatabaseVersionRow::patch);
+  }
+};
+static_assert(std::tuple_size_v<decltype(DatabaseVersionRow::fields())> ==
+              Schema::DatabaseVersion::ColumnCount);
+} // namespace Model
@@ -0,0 +1,793 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include "tabledescriptor.h"
+
+/*!
+    \namespace Model::Schema
+    \brief The tables of src/data/script.sql
+    \details Every table has a namespace with the enum Column, the positions
+             of its columns, and the descriptor Table. Keep it in sync with
+             the schema.
+   */
+namespace Model::Schema {
+
+namespace Account {
+enum Column : int {
+  AccountId,
+  UserName,
+  Password,
+  SystemDataId,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"account_id", ColumnType::Integer},
+    {"user_name", ColumnType::Text},
+    {"password", ColumnType::Text},
+    {"system_data_id", ColumnType::Integer, "system_data"},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"account", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace Account
+
+namespace ChipCard {
+enum Column : int {
+  ChipCardId,
+  Number,
+  ChipCardDoorId,
+  ChipCardProfileId,
+  EmployeeId,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"chip_card_id", ColumnType::Integer},
+    {"number", ColumnType::Text},
+    {"chip_card_door_id", ColumnType::Integer, "chip_card_door"},
+    {"chip_card_profile_id", ColumnType::Integer, "chip_card_profile"},
+    {"employee_id", ColumnType::Integer, "employee"},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"chip_card", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace ChipCard
+
+namespace ChipCardDoor {
+enum Column : int {
+  ChipCardDoorId,
+  Number,
+  PlaceId,
+  DepartmentId,
+  EmployeeId,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"chip_card_door_id", ColumnType::Integer},
+    {"number", ColumnType::Text},
+    {"place_id", ColumnType::Integer, "place"},
+    {"department_id", ColumnType::Integer, "department"},
+    {"employee_id", ColumnType::Integer, "employee"},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"chip_card_door", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace ChipCardDoor
+
+namespace ChipCardProfile {
+enum Column : int {
+  ChipCardProfileId,
+  Number,
+  ChipCardDoorId,
+  EmployeeId,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"chip_card_profile_id", ColumnType::Integer},
+    {"number", ColumnType::Text},
+    {"chip_card_door_id", ColumnType::Integer, "chip_card_door"},
+    {"employee_id", ColumnType::Integer, "employee"},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"chip_card_profile", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace ChipCardProfile
+
+namespace ChipCardProfileDoor {
+enum Column : int {
+  ChipCardProfileDoorId,
+  ChipCardProfileId,
+  ChipCardDoorId,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"chip_card_profile_door_id", ColumnType::Integer},
+    {"chip_card_profile_id", ColumnType::Integer, "chip_card_profile"},
+    {"chip_card_door_id", ColumnType::Integer, "chip_card_door"},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"chip_card_profile_door", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace ChipCardProfileDoor
+
+namespace CityName {
+enum Column : int { CityNameId, Name, LastUpdate, ColumnCount };
+inline constexpr ColumnDescriptor Columns[] = {
+    {"city_name_id", ColumnType::Integer},
+    {"name", ColumnType::Text},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"city_name", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace CityName
+
+namespace Company {
+enum Column : int {
+  CompanyId,
+  Name,
+  Name2,
+  Street,
+  City,
+  ZipCode,
+  PhoneNumber,
+  FaxNumber,
+  MobileNumber,
+  MailAddress,
+  Active,
+  EmployeeId,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"company_id", ColumnType::Integer},
+    {"name", ColumnType::Text},
+    {"name2", ColumnType::Text},
+    {"street", ColumnType::Text},
+    {"city", ColumnType::Text},
+    {"zip_code", ColumnType::Integer},
+    {"phone_number", ColumnType::Text},
+    {"fax_number", ColumnType::Text},
+    {"mobile_number", ColumnType::Text},
+    {"mail_address", ColumnType::Text},
+    {"active", ColumnType::Boolean},
+    {"employee_id", ColumnType::Integer, "employee"},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"company", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace Company
+
+namespace Computer {
+enum Column : int {
+  ComputerId,
+  DeviceNameId,
+  SerialNumber,
+  ServiceTag,
+  ServiceNumber,
+  Memory,
+  Network,
+  NetworkName,
+  NetworkIpAddress,
+  Active,
+  Replace,
+  DeviceTypeId,
+  EmployeeId,
+  PlaceId,
+  DepartmentId,
+  ManufacturerId,
+  InventoryId,
+  ProcessorId,
+  OsId,
+  ComputerSoftwareId,
+  PrinterId,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"computer_id", ColumnType::Integer},
+    {"device_name_id", ColumnType::Integer, "device_name"},
+    {"serial_number", ColumnType::Text},
+    {"service_tag", ColumnType::Text},
+    {"service_number", ColumnType::Text},
+    {"memory", ColumnType::Integer},
+    {"network", ColumnType::Text},
+    {"network_name", ColumnType::Text},
+    {"network_ip_address", ColumnType::Text},
+    {"active", ColumnType::Boolean},
+    {"replace", ColumnType::Boolean},
+    {"device_type_id", ColumnType::Integer, "device_type"},
+    {"employee_id", ColumnType::Integer, "employee"},
+    {"place_id", ColumnType::Integer, "place"},
+    {"department_id", ColumnType::Integer, "department"},
+    {"manufacturer_id", ColumnType::Integer, "manufacturer"},
+    {"inventory_id", ColumnType::Integer, "inventory"},
+    {"processor_id", ColumnType::Integer, "processor"},
+    {"os_id", ColumnType::Integer, "os"},
+    {"computer_software_id", ColumnType::Integer, "computer_software"},
+    {"printer_id", ColumnType::Integer, "printer"},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"computer", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace Computer
+
+namespace ComputerSoftware {
+enum Column : int {
+  ComputerSoftwareId,
+  ComputerId,
+  SoftwareId,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"computer_software_id", ColumnType::Integer},
+    {"computer_id", ColumnType::Integer, "computer"},
+    {"software_id", ColumnType::Integer, "software"},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"computer_software", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace ComputerSoftware
+
+namespace Department {
+enum Column : int {
+  DepartmentId,
+  Name,
+  Priority,
+  PrinterId,
+  FaxId,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"department_id", ColumnType::Integer},
+    {"name", ColumnType::Text},
+    {"priority", ColumnType::Integer},
+    {"printer_id", ColumnType::Integer, "printer"},
+    {"fax_id", ColumnType::Integer, "fax"},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"department", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace Department
+
+namespace DeviceName {
+enum Column : int { DeviceNameId, Name, LastUpdate, ColumnCount };
+inline constexpr ColumnDescriptor Columns[] = {
+    {"device_name_id", ColumnType::Integer},
+    {"name", ColumnType::Text},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"device_name", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace DeviceName
+
+namespace DeviceType {
+enum Column : int { DeviceTypeId, Name, LastUpdate, ColumnCount };
+inline constexpr ColumnDescriptor Columns[] = {
+    {"device_type_id", ColumnType::Integer},
+    {"name", ColumnType::Text},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"device_type", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace DeviceType
+
+namespace Document {
+enum Column : int { DocumentId, Name, DocumentData, LastUpdate, ColumnCount };
+inline constexpr ColumnDescriptor Columns[] = {
+    {"document_id", ColumnType::Integer},
+    {"name", ColumnType::Text},
+    {"document_data", ColumnType::Blob},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"document", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace Document
+
+namespace EmployeeAccount {
+enum Column : int {
+  EmployeeAccountId,
+  EmployeId,
+  AccountId,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"employee_account_id", ColumnType::Integer},
+    {"employe_id", ColumnType::Integer, "employee"},
+    {"account_id", ColumnType::Integer, "account"},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"employee_account", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace EmployeeAccount
+
+namespace Employee {
+enum Column : int {
+  EmployeeId,
+  EmployeeNr,
+  Gender,
+  TitleId,
+  FirstName,
+  LastName,
+  BirthDay,
+  Address,
+  ZipCityId,
+  HomePhone,
+  HomeMobile,
+  HomeMailAddress,
+  BusinessMailAddress,
+  DataCare,
+  Active,
+  Photo,
+  Notes,
+  HireDate,
+  EndDate,
+  DepartmentId,
+  FunctionId,
+  ComputerId,
+  PrinterId,
+  PhoneId,
+  MobileId,
+  FaxId,
+  EmployeeAccountId,
+  EmployeeDocumentId,
+  ChipCardId,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"employee_id", ColumnType::Integer},
+    {"employee_nr", ColumnType::Integer},
+    {"gender", ColumnType::Integer},
+    {"title_id", ColumnType::Integer, "title"},
+    {"first_name", ColumnType::Text},
+    {"last_name", ColumnType::Text},
+    {"birth_day", ColumnType::Date},
+    {"address", ColumnType::Text},
+    {"zip_city_id", ColumnType::Integer, "zip_city"},
+    {"home_phone", ColumnType::Text},
+    {"home_mobile", ColumnType::Text},
+    {"home_mail_address", ColumnType::Text},
+    {"business_mail_address", ColumnType::Text},
+    {"data_care", ColumnType::Boolean},
+    {"active", ColumnType::Boolean},
+    {"photo", ColumnType::Blob},
+    {"notes", ColumnType::Text},
+    {"hire_date", ColumnType::Date},
+    {"end_date", ColumnType::Date},
+    {"department_id", ColumnType::Integer, "department"},
+    {"function_id", ColumnType::Integer, "function"},
+    {"computer_id", ColumnType::Integer, "computer"},
+    {"printer_id", ColumnType::Integer, "printer"},
+    {"phone_id", ColumnType::Integer, "phone"},
+    {"mobile_id", ColumnType::Integer, "mobile"},
+    {"fax_id", ColumnType::Integer, "fax"},
+    {"employee_account_id", ColumnType::Integer, "employee_account"},
+    {"employee_document_id", ColumnType::Integer, "employee_document"},
+    {"chip_card_id", ColumnType::Integer, "chip_card"},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"employee", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace Employee
+
+namespace EmployeeDocument {
+enum Column : int {
+  EmployeeDocumentId,
+  EmployeId,
+  DocumentId,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"employee_document_id", ColumnType::Integer},
+    {"employe_id", ColumnType::Integer, "employee"},
+    {"document_id", ColumnType::Integer, "document"},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"employee_document", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace EmployeeDocument
+
+namespace Fax {
+enum Column : int {
+  FaxId,
+  DeviceNameId,
+  SerialNumber,
+  Number,
+  Pin,
+  Active,
+  Replace,
+  DeviceTypeId,
+  EmployeeId,
+  PlaceId,
+  DepartmentId,
+  ManufacturerId,
+  InventoryId,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"fax_id", ColumnType::Integer},
+    {"device_name_id", ColumnType::Integer, "device_name"},
+    {"serial_number", ColumnType::Text},
+    {"number", ColumnType::Text},
+    {"pin", ColumnType::Text},
+    {"active", ColumnType::Boolean},
+    {"replace", ColumnType::Boolean},
+    {"device_type_id", ColumnType::Integer, "device_type"},
+    {"employee_id", ColumnType::Integer, "employee"},
+    {"place_id", ColumnType::Integer, "place"},
+    {"department_id", ColumnType::Integer, "department"},
+    {"manufacturer_id", ColumnType::Integer, "manufacturer"},
+    {"inventory_id", ColumnType::Integer, "inventory"},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"fax", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace Fax
+
+namespace Function {
+enum Column : int { FunctionId, Name, Priority, LastUpdate, ColumnCount };
+inline constexpr ColumnDescriptor Columns[] = {
+    {"function_id", ColumnType::Integer},
+    {"name", ColumnType::Text},
+    {"priority", ColumnType::Integer},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"function", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace Function
+
+namespace Inventory {
+enum Column : int {
+  InventoryId,
+  Number,
+  Text,
+  Active,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"inventory_id", ColumnType::Integer},
+    {"number", ColumnType::Text},
+    {"text", ColumnType::Text},
+    {"active", ColumnType::Boolean},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"inventory", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace Inventory
+
+namespace Manufacturer {
+enum Column : int {
+  ManufacturerId,
+  Name,
+  Name2,
+  Supporter,
+  Address,
+  Address2,
+  ZipCityId,
+  MailAddress,
+  PhoneNumber,
+  FaxNumber,
+  HotlineNumber,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"manufacturer_id", ColumnType::Integer},
+    {"name", ColumnType::Text},
+    {"name2", ColumnType::Text},
+    {"supporter", ColumnType::Text},
+    {"address", ColumnType::Text},
+    {"address2", ColumnType::Text},
+    {"zip_city_id", ColumnType::Integer, "zip_city"},
+    {"mail_address", ColumnType::Text},
+    {"phone_number", ColumnType::Text},
+    {"fax_number", ColumnType::Text},
+    {"hotline_number", ColumnType::Text},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"manufacturer", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace Manufacturer
+
+namespace Mobile {
+enum Column : int {
+  MobileId,
+  DeviceNameId,
+  SerialNumber,
+  Number,
+  Pin,
+  CardNumber,
+  Active,
+  Replace,
+  DeviceTypeId,
+  EmployeId,
+  PlaceId,
+  DepartmentId,
+  ManufacturerId,
+  InventoryId,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"mobile_id", ColumnType::Integer},
+    {"device_name_id", ColumnType::Integer, "device_name"},
+    {"serial_number", ColumnType::Text},
+    {"number", ColumnType::Text},
+    {"pin", ColumnType::Text},
+    {"card_number", ColumnType::Text},
+    {"active", ColumnType::Boolean},
+    {"replace", ColumnType::Boolean},
+    {"device_type_id", ColumnType::Integer, "device_type"},
+    {"employe_id", ColumnType::Integer, "employee"},
+    {"place_id", ColumnType::Integer, "place"},
+    {"department_id", ColumnType::Integer, "department"},
+    {"manufacturer_id", ColumnType::Integer, "manufacturer"},
+    {"inventory_id", ColumnType::Integer, "inventory"},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"mobile", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace Mobile
+
+namespace OS {
+enum Column : int {
+  OsId,
+  Name,
+  Version,
+  Revision,
+  Fix,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"os_id", ColumnType::Integer},
+    {"name", ColumnType::Text},
+    {"version", ColumnType::Text},
+    {"revision", ColumnType::Text},
+    {"fix", ColumnType::Text},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"os", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace OS
+
+namespace Phone {
+enum Column : int {
+  PhoneId,
+  DeviceNameId,
+  SerialNumber,
+  Number,
+  Pin,
+  Active,
+  Replace,
+  DeviceTypeId,
+  EmployeId,
+  PlaceId,
+  DepartmentId,
+  ManufacturerId,
+  InventoryId,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"phone_id", ColumnType::Integer},
+    {"device_name_id", ColumnType::Integer, "device_name"},
+    {"serial_number", ColumnType::Text},
+    {"number", ColumnType::Text},
+    {"pin", ColumnType::Text},
+    {"active", ColumnType::Boolean},
+    {"replace", ColumnType::Boolean},
+    {"device_type_id", ColumnType::Integer, "device_type"},
+    {"employe_id", ColumnType::Integer, "employee"},
+    {"place_id", ColumnType::Integer, "place"},
+    {"department_id", ColumnType::Integer, "department"},
+    {"manufacturer_id", ColumnType::Integer, "manufacturer"},
+    {"inventory_id", ColumnType::Integer, "inventory"},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"phone", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace Phone
+
+namespace Place {
+enum Column : int { PlaceId, Name, Room, Desk, LastUpdate, ColumnCount };
+inline constexpr ColumnDescriptor Columns[] = {
+    {"place_id", ColumnType::Integer},
+    {"name", ColumnType::Text},
+    {"room", ColumnType::Text},
+    {"desk", ColumnType::Text},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"place", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace Place
+
+namespace Printer {
+enum Column : int {
+  PrinterId,
+  DeviceNameId,
+  SerialNumber,
+  Network,
+  NetworkName,
+  NetworkIpAddress,
+  Active,
+  Replace,
+  Resources,
+  PaperSizeMax,
+  Color,
+  DeviceTypeId,
+  EmployeId,
+  PlaceId,
+  DepartmentId,
+  ManufacturerId,
+  InventoryId,
+  ComputerId,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"printer_id", ColumnType::Integer},
+    {"device_name_id", ColumnType::Integer, "device_name"},
+    {"serial_number", ColumnType::Text},
+    {"network", ColumnType::Text},
+    {"network_name", ColumnType::Text},
+    {"network_ip_address", ColumnType::Text},
+    {"active", ColumnType::Boolean},
+    {"replace", ColumnType::Boolean},
+    {"resources", ColumnType::Text},
+    {"paper_size_max", ColumnType::Text},
+    {"color", ColumnType::Boolean},
+    {"device_type_id", ColumnType::Integer, "device_type"},
+    {"employe_id", ColumnType::Integer, "employee"},
+    {"place_id", ColumnType::Integer, "place"},
+    {"department_id", ColumnType::Integer, "department"},
+    {"manufacturer_id", ColumnType::Integer, "manufacturer"},
+    {"inventory_id", ColumnType::Integer, "inventory"},
+    {"computer_id", ColumnType::Integer, "computer"},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"printer", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace Printer
+
+namespace Processor {
+enum Column : int {
+  ProcessorId,
+  Name,
+  ClockRate,
+  Cores,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"processor_id", ColumnType::Integer},
+    {"name", ColumnType::Text},
+    {"clock_rate", ColumnType::Real},
+    {"cores", ColumnType::Integer},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"processor", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace Processor
+
+namespace Software {
+enum Column : int {
+  SoftwareId,
+  Name,
+  Version,
+  Revision,
+  Fix,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"software_id", ColumnType::Integer},
+    {"name", ColumnType::Text},
+    {"version", ColumnType::Text},
+    {"revision", ColumnType::Text},
+    {"fix", ColumnType::Text},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"software", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace Software
+
+namespace SystemData {
+enum Column : int {
+  SystemDataId,
+  Name,
+  Local,
+  CompanyId,
+  LastUpdate,
+  ColumnCount
+};
+inline constexpr ColumnDescriptor Columns[] = {
+    {"system_data_id", ColumnType::Integer},
+    {"name", ColumnType::Text},
+    {"local", ColumnType::Boolean},
+    {"company_id", ColumnType::Integer, "company"},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"system_data", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace SystemData
+
+namespace Title {
+enum Column : int { TitleId, Name, FromDate, LastUpdate, ColumnCount };
+inline constexpr ColumnDescriptor Columns[] = {
+    {"title_id", ColumnType::Integer},
+    {"name", ColumnType::Text},
+    {"from_date", ColumnType::Date},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"title", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace Title
+
+namespace ZipCity {
+enum Column : int { ZipCityId, ZipCodeId, CityId, LastUpdate, ColumnCount };
+inline constexpr ColumnDescriptor Columns[] = {
+    {"zip_city_id", ColumnType::Integer},
+    {"zip_code_id", ColumnType::Integer, "zip_code"},
+    {"city_id", ColumnType::Integer},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"zip_city", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace ZipCity
+
+namespace ZipCode {
+enum Column : int { ZipCodeId, Code, LastUpdate, ColumnCount };
+inline constexpr ColumnDescriptor Columns[] = {
+    {"zip_code_id", ColumnType::Integer},
+    {"code", ColumnType::Text},
+    {"last_update", ColumnType::DateTime},
+};
+inline constexpr TableDescriptor Table{"zip_code", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace ZipCode
+
+namespace DatabaseVersion {
+enum Column : int { DatabaseVersionId, Version, Revision, Patch, ColumnCount };
+inline constexpr ColumnDescriptor Columns[] = {
+    {"database_version_id", ColumnType::Integer},
+    {"version", ColumnType::Text},
+    {"revision", ColumnType::Text},
+    {"patch", ColumnType::Text},
+};
+inline constexpr TableDescriptor Table{"database_version", Columns};
+static_assert(Table.columnCount == ColumnCount);
+} // namespace DatabaseVersion
+
+/*!
+    \brief All tables of the schema
+   */
+inline constexpr const TableDescriptor *Tables[] = {
+    &Account::Table, &ChipCard::Table, &ChipCardDoor::Table,
+    &ChipCardProfile::Table, &ChipCardProfileDoor::Table, &CityName::Table,
+    &Company::Table, &Computer::Table, &ComputerSoftware::Table,
+    &Department::Table, &DeviceName::Table, &DeviceType::Table,
+    &Document::Table, &EmployeeAccount::Table, &Employee::Table,
+    &EmployeeDocument::Table, &Fax::Table, &Function::Table, &Inventory::Table,
+    &Manufacturer::Table, &Mobile::Table, &OS::Table, &Phone::Table,
+    &Place::Table, &Printer::Table, &Processor::Table, &Software::Table,
+    &SystemData::Table, &Title::Table, &ZipCity::Table, &ZipCode::Table,
+    &DatabaseVersion::Table
+};
+} // namespace Model::Schema
@@ -0,0 +1,130 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QCoreApplication>
+#include <QSqlDatabase>
+#include <QString>
+#include <QVector>
+
+#include "statementcache.h"
+
+#include "jmbdemodels_export.h"
+
+namespace Model {
+/*!
+    \class SearchIndex
+    \brief Ranked full text search over employees, devices and documents
+    \details The table search_index holds one entry per row of
+             - employee: first and last name, business and home mail address
+             - computer: network name, serial number and service tag
+             - printer: network name and serial number
+             - software: name and version
+             - document: name
+             The id of an entry is the primary key of the row * 8 + Kind.
+             Triggers on the source tables update the entry of a row when
+             the row is written, so the index never needs a full rebuild.
+
+             On SQLite the index is a FTS5 table ranked with bm25(), on
+             PostgreSQL a tsvector column with a GIN index ranked with
+             ts_rank(). Every word of the search text is a prefix, so the
+             search can answer a type-ahead field.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+class SearchIndex {
+  Q_DECLARE_TR_FUNCTIONS(SearchIndex)
+
+public:
+  /*!
+      \enum Kind
+      \brief The table of a hit; All searches all tables
+   */
+  enum class Kind { All = 0, Employee, Computer, Printer, Software, Document };
+
+  /*!
+      \struct Hit
+      \brief One row that matches the search text
+   */
+  struct Hit {
+    Kind kind{Kind::All};
+    qint64 id{0};
+    QString title;
+    double rank{0.0};
+  };
+
+  /*!
+      \fn SearchIndex(const QSqlDatabase &db)
+
+      \brief Constructor for the SearchIndex
+      \param db - The connection of the index, used from its thread
+   */
+  explicit JMBDEMODELS_EXPORT SearchIndex(const QSqlDatabase &db);
+
+  /*!
+      \fn auto ensure() -> bool
+
+      \brief Create the index and its triggers if they are missing
+      \details A new index is filled from the tables at once. Existing
+               databases get the index on their first start.
+   */
+  JMBDEMODELS_EXPORT auto ensure() -> bool;
+
+  /*!
+      \fn auto rebuild() -> bool
+
+      \brief Fill the index again from all source tables
+   */
+  JMBDEMODELS_EXPORT auto rebuild() -> bool;
+
+  /*!
+      \fn auto search(const QString &text, Kind kind = Kind::All,
+                      int limit = 20) -> QVector<Hit>
+
+      \brief The best matching rows, the best one first
+      \param text - The words to search; each word matches as a prefix
+      \param kind - Only hits of this table, or of all
+      \param limit - The maximal number of hits
+   */
+  JMBDEMODELS_EXPORT auto search(const QString &text, Kind kind = Kind::All,
+                                 int limit = 20) -> QVector<Hit>;
+
+  /*!
+      \fn auto lastError() const -> QString
+
+      \brief The error of the last call, empty if it succeeded
+   */
+  JMBDEMODELS_EXPORT auto lastError() const -> QString { return m_error; }
+
+  /*!
+      \fn static auto matchExpression(const QString &text, bool postgres)
+                -> QString
+
+      \brief The FTS5 MATCH or tsquery expression for the search text
+      \details Only the letters and digits of the text are used, so the
+               text can't inject query syntax.
+   */
+  static JMBDEMODELS_EXPORT auto matchExpression(const QString &text,
+                                                 bool postgres) -> QString;
+
+private:
+  /*!
+      \brief Run the statements of a script of the resources
+   */
+  auto runScript(const QString &fileName) -> bool;
+
+  auto isPostgres() const -> bool;
+
+  QSqlDatabase m_db;
+  StatementCache m_statements;
+  QString m_error;
+};
+} // namespace Model
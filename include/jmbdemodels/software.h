@@ -37,11 +37,13 @@ class Software : public CommonData {
 
 public:
   /*!
-      \fn Software()
+      \fn Software(const QSharedPointer<Model::DataContext> &dataContext = {})
 
       \brief Constructor for the Software
+      \param dataContext - The DataContext to use, the shared one if null
    */
-  explicit JMBDEMODELS_EXPORT Software();
+  explicit JMBDEMODELS_EXPORT
+  Software(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn  ~Software();
@@ -50,78 +52,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~Software() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn int SoftwareIdIndex()
 
@@ -130,7 +61,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getSoftwareIdIndex() const {
-    return m_SoftwareIdIndex;
+    return this->getFieldIndex(Schema::Software::SoftwareId);
   }
 
   /*!
@@ -140,7 +71,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getNameIndex() const { return m_NameIndex; }
+  JMBDEMODELS_EXPORT int getNameIndex() const {
+    return this->getFieldIndex(Schema::Software::Name);
+  }
 
   /*!
      \fn int VersionIndex()
@@ -149,7 +82,9 @@ public:
 
      Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getVersionIndex() const { return m_VersionIndex; }
+  JMBDEMODELS_EXPORT int getVersionIndex() const {
+    return this->getFieldIndex(Schema::Software::Version);
+  }
 
   /*!
     \fn int RevisionIndex()
@@ -158,7 +93,9 @@ public:
 
     Returns the value of the index
  */
-  JMBDEMODELS_EXPORT int getRevisionIndex() const { return m_RevisionIndex; }
+  JMBDEMODELS_EXPORT int getRevisionIndex() const {
+    return this->getFieldIndex(Schema::Software::Revision);
+  }
 
   /*!
      \fn int FixIndex()
@@ -167,7 +104,9 @@ public:
 
      Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getFixIndex() const { return m_FixIndex; }
+  JMBDEMODELS_EXPORT int getFixIndex() const {
+    return this->getFieldIndex(Schema::Software::Fix);
+  }
 
   /*!
     \fn  int LastUpdateIndex()
@@ -177,71 +116,7 @@ public:
     Returns the value of the index
  */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::Software::LastUpdate);
   }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("software");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-      \brief holds an initialised pointer to the Relationmodel
-      \sa QSqlRelationalTableModel
-   */
-  QSqlRelationalTableModel *m_model{nullptr};
-
-  /*!
-     \brief holds an initialised pointer to the ItemSelectioModel
-     \sa QItemSelectionModel
-  */
-  QItemSelectionModel *m_selectionModel{nullptr};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-     \var int m_SoftwareIdIndex
-     \brief The value of the SoftwareId
-  */
-  int m_SoftwareIdIndex{0};
-
-  /*!
-     \var int m_NameIndex
-     \brief The value of the Name
-  */
-  int m_NameIndex{0};
-
-  /*!
-     \var int m_VersionIndex
-     \brief The value of the Version
-  */
-  int m_VersionIndex{0};
-
-  /*!
-     \var int m_RevisionIndex
-     \brief The value of the Revision
-  */
-  int m_RevisionIndex{0};
-
-  /*!
-     \var int m_FixIndex
-     \brief The value of the Fix
-  */
-  int m_FixIndex{0};
-
-  /*!
-      \var int m_LastUpdateIndex
-      \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
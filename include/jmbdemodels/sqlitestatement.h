@@ -0,0 +1,297 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QSqlDatabase>
+#include <QString>
+#include <QStringList>
+#include <QVariant>
+#include <QVector>
+#include <QtGlobal>
+
+#include <functional>
+
+#include "resultset.h"
+
+#include "jmbdemodels_export.h"
+
+namespace Model {
+/*!
+    \class SqliteStatement
+    \brief A statement that runs directly on the SQLite handle of a connection
+    \details QSqlQuery copies every column of every row into a QVariant. This
+             class steps the sqlite3 statement itself and reads the columns
+             as plain values, which RowReader uses for large reads.
+
+             It is only available when the library is built with
+             WITH_SQLITE3 and the connection uses the QSQLITE driver; check
+             isSupported() first. The statement must be used from the thread
+             that owns the connection.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+class SqliteStatement {
+public:
+  /*!
+      \fn static auto isSupported(const QSqlDatabase &db) -> bool
+
+      \brief true if the connection is an open SQLite database and the
+             library is built with WITH_SQLITE3
+   */
+  static JMBDEMODELS_EXPORT auto isSupported(const QSqlDatabase &db) -> bool;
+
+  /*!
+      \fn SqliteStatement(const QSqlDatabase &db, const QString &sql)
+
+      \brief Prepare the sql on the SQLite handle of the connection
+   */
+  JMBDEMODELS_EXPORT SqliteStatement(const QSqlDatabase &db,
+                                     const QString &sql);
+
+  /*!
+      \fn ~SqliteStatement()
+
+      \brief Finalize the statement
+   */
+  JMBDEMODELS_EXPORT ~SqliteStatement();
+
+  SqliteStatement(const SqliteStatement &) = delete;
+  auto operator=(const SqliteStatement &) -> SqliteStatement & = delete;
+
+  /*!
+      \fn auto isValid() const -> bool
+
+      \brief true if the statement is prepared
+   */
+  JMBDEMODELS_EXPORT auto isValid() const -> bool {
+    return m_statement != nullptr;
+  }
+
+  /*!
+      \fn auto bind(int index, const QVariant &value) -> bool
+
+      \brief Bind the value to the placeholder, the first one is 0
+   */
+  JMBDEMODELS_EXPORT auto bind(int index, const QVariant &value) -> bool;
+
+  /*!
+      \fn auto next() -> bool
+
+      \brief Step to the next row
+
+      \return false at the end of the rows or on an error, see lastError()
+   */
+  JMBDEMODELS_EXPORT auto next() -> bool;
+
+  /*!
+      \fn auto lastError() const -> QString
+
+      \brief The error of the last call, empty if it succeeded
+   */
+  JMBDEMODELS_EXPORT auto lastError() const -> QString { return m_error; }
+
+  JMBDEMODELS_EXPORT auto isNull(int column) const -> bool;
+  JMBDEMODELS_EXPORT auto toInt64(int column) const -> qint64;
+  JMBDEMODELS_EXPORT auto toDouble(int column) const -> double;
+  JMBDEMODELS_EXPORT auto toString(int column) const -> QString;
+  JMBDEMODELS_EXPORT auto toByteArray(int column) const -> QByteArray;
+
+private:
+  /*!
+      \brief Take the error message of the connection
+   */
+  void setError();
+
+  void *m_handle{nullptr};
+  void *m_statement{nullptr};
+  QString m_error;
+};
+
+/*!
+    \class SqliteBlob
+    \brief Incremental I/O on one BLOB value of a SQLite database
+    \details Opens the value with sqlite3_blob_open(), so it can be read and
+             written in chunks without loading it completely. The size of a
+             value can't change; write zeroblob(size) first to resize it.
+
+             Like SqliteStatement it is only available with WITH_SQLITE3 on
+             a QSQLITE connection.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+class SqliteBlob {
+public:
+  /*!
+      \fn SqliteBlob(const QSqlDatabase &db, const QString &table,
+                     const QString &column, qint64 rowId,
+                     bool writable = false)
+
+      \brief Open the value of the column in the row with the rowid
+   */
+  JMBDEMODELS_EXPORT SqliteBlob(const QSqlDatabase &db, const QString &table,
+                                const QString &column, qint64 rowId,
+                                bool writable = false);
+
+  /*!
+      \fn ~SqliteBlob()
+
+      \brief Close the value
+   */
+  JMBDEMODELS_EXPORT ~SqliteBlob();
+
+  SqliteBlob(const SqliteBlob &) = delete;
+  auto operator=(const SqliteBlob &) -> SqliteBlob & = delete;
+
+  JMBDEMODELS_EXPORT auto isValid() const -> bool { return m_blob != nullptr; }
+
+  /*!
+      \fn auto size() const -> int
+
+      \brief The size of the value in bytes
+   */
+  JMBDEMODELS_EXPORT auto size() const -> int;
+
+  /*!
+      \fn auto read(int offset, char *data, int length) -> bool
+
+      \brief Read length bytes from offset into data
+   */
+  JMBDEMODELS_EXPORT auto read(int offset, char *data, int length) -> bool;
+
+  /*!
+      \fn auto write(int offset, const char *data, int length) -> bool
+
+      \brief Write length bytes of data at offset
+   */
+  JMBDEMODELS_EXPORT auto write(int offset, const char *data, int length)
+      -> bool;
+
+  JMBDEMODELS_EXPORT auto lastError() const -> QString { return m_error; }
+
+private:
+  void setError();
+
+  void *m_handle{nullptr};
+  void *m_blob{nullptr};
+  QString m_error;
+};
+
+/*!
+    \class SqliteUpdateHook
+    \brief Collects the rows written on one SQLite connection
+    \details Installs sqlite3_update_hook() and keeps the rowids of the
+             inserted, updated and deleted rows until the transaction ends.
+             A commit hands them over and calls committed(), a rollback drops
+             them. The hooks run inside sqlite3_step(), so committed() must
+             not use the connection; queue the work instead.
+
+             Above getRowLimit() rows of a table only the table is kept, so
+             a bulk load doesn't queue a change for every row.
+
+             Only writes on this connection are seen. Like SqliteStatement it
+             is only available with WITH_SQLITE3 on a QSQLITE connection.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+class SqliteUpdateHook {
+public:
+  /*!
+      \struct Change
+      \brief One written row
+   */
+  struct Change {
+    QString table;
+    qint64 rowId{0};
+    RowOperation operation{RowOperation::Update};
+  };
+
+  /*!
+      \struct Committed
+      \brief The written rows, and the tables with too many rows to list
+   */
+  struct Committed {
+    QVector<Change> rows;
+    QStringList tables;
+  };
+
+  /*!
+      \fn SqliteUpdateHook(const QSqlDatabase &db,
+                           std::function<void()> committed)
+
+      \brief Install the hooks on the connection
+   */
+  JMBDEMODELS_EXPORT SqliteUpdateHook(const QSqlDatabase &db,
+                                      std::function<void()> committed);
+
+  /*!
+      \fn ~SqliteUpdateHook()
+
+      \brief Remove the hooks
+   */
+  JMBDEMODELS_EXPORT ~SqliteUpdateHook();
+
+  SqliteUpdateHook(const SqliteUpdateHook &) = delete;
+  auto operator=(const SqliteUpdateHook &) -> SqliteUpdateHook & = delete;
+
+  JMBDEMODELS_EXPORT auto isValid() const -> bool {
+    return m_handle != nullptr;
+  }
+
+  /*!
+      \fn auto takeCommitted() -> Committed
+
+      \brief The rows of the committed transactions since the last call
+   */
+  JMBDEMODELS_EXPORT auto takeCommitted() -> Committed;
+
+  /*!
+      \fn void setRowLimit(int rows)
+
+      \brief Keep at most rows changes per table, 256 by default
+   */
+  JMBDEMODELS_EXPORT void setRowLimit(int rows) { m_rowLimit = qMax(0, rows); }
+
+  JMBDEMODELS_EXPORT auto getRowLimit() const -> int { return m_rowLimit; }
+
+private:
+  /*!
+      \brief The changes of one table; the rows are dropped on overflow
+   */
+  struct TableChanges {
+    QByteArray name;
+    QString table;
+    QVector<Change> rows;
+    bool overflow{false};
+  };
+
+  static auto find(QVector<TableChanges> &tables, const char *name)
+      -> TableChanges &;
+  void merge(TableChanges &into, const TableChanges &from) const;
+
+  static void onUpdate(void *self, int operation, const char *database,
+                       const char *table, long long rowId);
+  static auto onCommit(void *self) -> int;
+  static void onRollback(void *self);
+
+  void *m_handle{nullptr};
+  std::function<void()> m_committed;
+  QVector<TableChanges> m_pending;
+  QVector<TableChanges> m_done;
+  int m_rowLimit{256};
+};
+} // namespace Model
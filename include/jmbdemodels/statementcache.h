@@ -0,0 +1,121 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QCache>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QString>
+
+#include "jmbdemodels_export.h"
+
+namespace Model {
+/*!
+    \class StatementCache
+    \brief A least recently used cache of prepared statements
+    \details The statements are prepared once for one connection and then
+             only bound and executed again. The key names the statement,
+             e.g. the table and the set of columns of an INSERT.
+             The cache is not thread safe; use one per connection.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+class StatementCache {
+public:
+  /*!
+      \fn StatementCache(int capacity = 64)
+
+      \brief Constructor for the StatementCache
+      \param capacity - The maximum number of prepared statements
+   */
+  explicit JMBDEMODELS_EXPORT StatementCache(int capacity = 64);
+
+  /*!
+      \fn auto prepare(const QSqlDatabase &db, const QString &key,
+                       const QString &sql) -> QSqlQuery *
+
+      \brief Get the prepared statement for the key
+      \details On a miss the statement is prepared with the sql and stored.
+               The least recently used statement is dropped when the cache
+               is full. The returned query belongs to the cache and is valid
+               until the next call.
+
+      \return the prepared query, nullptr if the statement can't be prepared
+   */
+  JMBDEMODELS_EXPORT auto prepare(const QSqlDatabase &db, const QString &key,
+                                  const QString &sql) -> QSqlQuery *;
+
+  /*!
+      \fn void clear()
+
+      \brief Drop all prepared statements, e.g. when the connection changes
+   */
+  JMBDEMODELS_EXPORT void clear();
+
+  /*!
+      \fn void setCapacity(int capacity)
+
+      \brief Set the maximum number of prepared statements, at least one
+   */
+  JMBDEMODELS_EXPORT void setCapacity(int capacity);
+
+  /*!
+      \fn auto getCapacity() const -> int
+
+      \brief Get the maximum number of prepared statements
+   */
+  JMBDEMODELS_EXPORT auto getCapacity() const -> int {
+    return static_cast<int>(m_statements.maxCost());
+  }
+
+  /*!
+      \fn auto getSize() const -> int
+
+      \brief Get the number of prepared statements in the cache
+   */
+  JMBDEMODELS_EXPORT auto getSize() const -> int {
+    return static_cast<int>(m_statements.size());
+  }
+
+  /*!
+      \fn auto getHits() const -> quint64
+
+      \brief Get the number of calls that found a prepared statement
+   */
+  JMBDEMODELS_EXPORT auto getHits() const -> quint64 { return m_hits; }
+
+  /*!
+      \fn auto getMisses() const -> quint64
+
+      \brief Get the number of calls that had to prepare the statement
+   */
+  JMBDEMODELS_EXPORT auto getMisses() const -> quint64 { return m_misses; }
+
+private:
+  /*!
+      \var QCache<QString, QSqlQuery> m_statements
+      \brief The prepared statements, QCache drops the least recently used
+   */
+  QCache<QString, QSqlQuery> m_statements;
+
+  /*!
+      \var quint64 m_hits
+      \brief The number of cache hits
+   */
+  quint64 m_hits{0};
+
+  /*!
+      \var quint64 m_misses
+      \brief The number of cache misses
+   */
+  quint64 m_misses{0};
+};
+} // namespace Model
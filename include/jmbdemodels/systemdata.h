@@ -40,8 +40,10 @@ public:
       \fn  SystemData()
 
       \brief Constructor for the  SystemData
+      \param dataContext - The DataContext to use, the shared one if null
    */
-  explicit JMBDEMODELS_EXPORT SystemData();
+  explicit JMBDEMODELS_EXPORT
+  SystemData(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn  ~SystemData() override;
@@ -50,78 +52,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~SystemData() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn  int SystemDataIdIndex()
 
@@ -130,7 +61,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getSystemDataIdIndex() const {
-    return m_SystemDataIdIndex;
+    return this->getFieldIndex(Schema::SystemData::SystemDataId);
   }
 
   /*!
@@ -140,7 +71,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getNameIndex() const { return m_NameIndex; }
+  JMBDEMODELS_EXPORT int getNameIndex() const {
+    return this->getFieldIndex(Schema::SystemData::Name);
+  }
 
   /*!
       \fn  int LocalIndex()
@@ -149,7 +82,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getLocalIndex() const { return m_LocalIndex; }
+  JMBDEMODELS_EXPORT int getLocalIndex() const {
+    return this->getFieldIndex(Schema::SystemData::Local);
+  }
 
   /*!
       \fn  int CompanyIdIndex()
@@ -158,7 +93,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getCompanyIdIndex() const { return m_CompanyIdIndex; }
+  JMBDEMODELS_EXPORT int getCompanyIdIndex() const {
+    return this->getFieldIndex(Schema::SystemData::CompanyId);
+  }
 
   /*!
       \fn  int LastUpdateIndex()
@@ -168,53 +105,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::SystemData::LastUpdate);
   }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("system_data");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-      \var int m_SystemDataIdIndex
-      \brief The value of the SystemDataIdIndex
-   */
-  int m_SystemDataIdIndex{0};
-
-  /*!
-     \var int m_NameIndex
-     \brief The value of the NameIndex
-  */
-  int m_NameIndex{0};
-
-  /*!
-     \var int m_LocalIndex
-     \brief The value of the LocalIndex
-  */
-  int m_LocalIndex{0};
-
-  /*!
-     \var int m_CompanyIdIndex
-     \brief The value of the CompanyIdIndex
-  */
-  int m_CompanyIdIndex{0};
-
-  /*!
-      \var int m_LastUpdateIndex
-      \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
@@ -0,0 +1,82 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace Model {
+/*!
+    \enum ColumnType
+    \brief The type of a column as declared in the schema
+   */
+enum class ColumnType { Integer, Real, Boolean, Text, Date, DateTime, Blob };
+
+/*!
+    \struct ColumnDescriptor
+    \brief The description of one column of a table
+    \details references is the table the column points to, or nullptr if the
+             column is no foreign key. The referenced column is the primary
+             key of that table.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+struct ColumnDescriptor {
+  const char *name;
+  ColumnType type;
+  const char *references{nullptr};
+};
+
+/*!
+    \struct TableDescriptor
+    \brief The description of a table, known at compile time
+    \details The columns are in the order of the CREATE TABLE statement. The
+             first column is the primary key.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+struct TableDescriptor {
+  template <std::size_t N>
+  constexpr TableDescriptor(const char *tableName,
+                            const ColumnDescriptor (&tableColumns)[N])
+      : name(tableName), columns(tableColumns), columnCount(N) {}
+
+  /*!
+      \fn constexpr auto indexOf(std::string_view column) const -> int
+      \brief The position of the column in the descriptor
+
+      \return the position or -1 if the table has no such column
+   */
+  constexpr auto indexOf(std::string_view column) const -> int {
+    for (std::size_t i = 0; i < columnCount; ++i) {
+      if (column == columns[i].name) {
+        return static_cast<int>(i);
+      }
+    }
+    return -1;
+  }
+
+  /*!
+      \fn constexpr auto primaryKey() const -> const ColumnDescriptor &
+      \brief The primary key of the table
+   */
+  constexpr auto primaryKey() const -> const ColumnDescriptor & {
+    return columns[0];
+  }
+
+  const char *name;
+  const ColumnDescriptor *columns;
+  std::size_t columnCount;
+};
+} // namespace Model
@@ -37,11 +37,13 @@ class Title : public CommonData {
 
 public:
   /*!
-      \fn Title()
+      \fn Title(const QSharedPointer<Model::DataContext> &dataContext = {})
 
       \brief Constructor for the Title
+      \param dataContext - The DataContext to use, the shared one if null
    */
-  explicit JMBDEMODELS_EXPORT Title();
+  explicit JMBDEMODELS_EXPORT
+  Title(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn  ~Title();
@@ -50,78 +52,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~Title() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn  int TitleIdIndex()
 
@@ -129,7 +60,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getTitleIdIndex() const { return m_TitleIdIndex; }
+  JMBDEMODELS_EXPORT int getTitleIdIndex() const {
+    return this->getFieldIndex(Schema::Title::TitleId);
+  }
 
   /*!
     \fn  int NameIndex()
@@ -138,7 +71,9 @@ public:
 
     Returns the value of the index
  */
-  JMBDEMODELS_EXPORT int getNameIndex() const { return m_NameIndex; }
+  JMBDEMODELS_EXPORT int getNameIndex() const {
+    return this->getFieldIndex(Schema::Title::Name);
+  }
 
   /*!
     \fn  int FromDateIndex()
@@ -147,7 +82,9 @@ public:
 
     Returns the value of the index
  */
-  JMBDEMODELS_EXPORT int getFromDateIndex() const { return m_FromDateIndex; }
+  JMBDEMODELS_EXPORT int getFromDateIndex() const {
+    return this->getFieldIndex(Schema::Title::FromDate);
+  }
 
   /*!
       \fn  int LastUpdateIndex()
@@ -157,43 +94,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::Title::LastUpdate);
   }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("title");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-      \var int m_TitleIdIndex
-      \brief The value of the TitleIdIndex
-   */
-  int m_TitleIdIndex{0};
-
-  /*!
-      \var int m_NameIndex
-      \brief The value of the NameIndex
-   */
-  int m_NameIndex{0};
-
-  /*!
-      \var int m_FromDateIndex
-      \brief The value of the FromDateIndex
-   */
-  int m_FromDateIndex{0};
-
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
@@ -0,0 +1,113 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QCoreApplication>
+#include <QSqlDatabase>
+#include <QString>
+
+#include "jmbdemodels_export.h"
+
+namespace Model {
+/*!
+    \class Transaction
+    \brief A transaction on a connection, or a savepoint inside the
+           transaction that is already open on it
+    \details The open transactions are counted per connection name. The
+             outermost Transaction sends BEGIN and COMMIT, every inner one
+             a SAVEPOINT and RELEASE, so commit() of an inner Transaction
+             never commits the work of the outer one and rollback() undoes
+             only its own statements.
+
+             QSQLITE refuses a second BEGIN, a transaction opened with
+             QSqlDatabase::transaction() is therefore joined with a
+             savepoint too. PostgreSQL only warns about it and can't tell
+             either, so the application opens its own transactions with a
+             Transaction as well:
+
+             \code
+             Transaction transaction(context->getDatabase());
+             context->insertBatch(QStringLiteral("employee"), rows);
+             transaction.rollback(); // no row remains
+             \endcode
+
+             A Transaction that is neither committed nor rolled back is
+             rolled back by the destructor.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+class Transaction {
+  Q_DECLARE_TR_FUNCTIONS(Transaction)
+
+public:
+  /*!
+      \fn explicit Transaction(const QSqlDatabase &db)
+
+      \brief Begin a transaction, or a savepoint if one is open
+      \param db - The connection, used from its thread
+   */
+  explicit JMBDEMODELS_EXPORT Transaction(const QSqlDatabase &db);
+
+  JMBDEMODELS_EXPORT ~Transaction();
+
+  Transaction(const Transaction &) = delete;
+  auto operator=(const Transaction &) -> Transaction & = delete;
+
+  /*!
+      \fn auto isActive() const -> bool
+
+      \brief True until commit() or rollback(), false if the driver has no
+             transactions or BEGIN failed
+   */
+  JMBDEMODELS_EXPORT auto isActive() const -> bool { return m_active; }
+
+  /*!
+      \fn auto isNested() const -> bool
+
+      \brief True for a savepoint inside a transaction of the caller
+   */
+  JMBDEMODELS_EXPORT auto isNested() const -> bool {
+    return !m_savepoint.isEmpty();
+  }
+
+  /*!
+      \fn auto commit() -> bool
+
+      \brief COMMIT, or RELEASE the savepoint
+      \details A failed commit is rolled back.
+   */
+  JMBDEMODELS_EXPORT auto commit() -> bool;
+
+  /*!
+      \fn void rollback()
+
+      \brief ROLLBACK, or ROLLBACK TO the savepoint
+   */
+  JMBDEMODELS_EXPORT void rollback();
+
+  JMBDEMODELS_EXPORT auto lastError() const -> QString { return m_error; }
+
+  /*!
+      \fn static auto depth(const QSqlDatabase &db) -> int
+
+      \brief The number of active Transactions on the connection
+   */
+  static JMBDEMODELS_EXPORT auto depth(const QSqlDatabase &db) -> int;
+
+private:
+  void finish();
+
+  QSqlDatabase m_db;
+  QString m_savepoint;
+  QString m_error;
+  bool m_active{false};
+};
+} // namespace Model
@@ -35,11 +35,13 @@ namespace Model {
 class ZipCity : public CommonData {
 public:
   /*!
-      \fn ZipCity()
+      \fn ZipCity(const QSharedPointer<Model::DataContext> &dataContext = {})
 
       \brief Constructor for the ZipCity
+      \param dataContext - The DataContext to use, the shared one if null
    */
-  explicit JMBDEMODELS_EXPORT ZipCity();
+  explicit JMBDEMODELS_EXPORT
+  ZipCity(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn  ~ZipCity();
@@ -48,78 +50,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~ZipCity() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn  int ZipCityIdIndex()
 
@@ -127,7 +58,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getZipCityIdIndex() const { return m_ZipCityIdIndex; }
+  JMBDEMODELS_EXPORT int getZipCityIdIndex() const {
+    return this->getFieldIndex(Schema::ZipCity::ZipCityId);
+  }
 
   /*!
       \fn  int ZipCodeIdIndex()
@@ -136,7 +69,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getZipCodeIdIndex() const { return m_ZipCodeIdIndex; }
+  JMBDEMODELS_EXPORT int getZipCodeIdIndex() const {
+    return this->getFieldIndex(Schema::ZipCity::ZipCodeId);
+  }
 
   /*!
      \fn  int CityIdIndex()
@@ -145,7 +80,9 @@ public:
 
      Returns the value of the index
   */
-  JMBDEMODELS_EXPORT int getCityIdIndex() const { return m_CityIdIndex; }
+  JMBDEMODELS_EXPORT int getCityIdIndex() const {
+    return this->getFieldIndex(Schema::ZipCity::CityId);
+  }
 
   /*!
       \fn  int LastUpdateIndex()
@@ -155,47 +92,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::ZipCity::LastUpdate);
   }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("zip_city");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-      \var int m_ZipCityIdIndex
-      \brief The value of the ZipCityIdIndex
-   */
-  int m_ZipCityIdIndex{0};
-
-  /*!
-      \var int m_ZipCodeIdIndex
-      \brief The value of the ZipCodeIdIndex
-   */
-  int m_ZipCodeIdIndex{0};
-
-  /*!
-      \var int m_CityIdIndex
-      \brief The value of the CityIdIndex
-   */
-  int m_CityIdIndex{0};
-
-  /*!
-      \var int m_LastUpdateIndex
-      \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
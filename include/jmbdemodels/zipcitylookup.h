@@ -0,0 +1,127 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <QCoreApplication>
+#include <QSqlDatabase>
+#include <QString>
+#include <QVector>
+
+#include <memory>
+#include <vector>
+
+#include "jmbdemodels_export.h"
+
+namespace Model {
+/*!
+    \class ZipCityLookup
+    \brief The zip codes and cities of zip_city in memory, for address forms
+    \details The entries of zip_city are joined with zip_code and city_name
+             once and kept in arrays sorted by id, by code and by the case
+             folded city name. A lookup is a binary search; the prefix
+             searches for autocompletion return the entries from the first
+             match on.
+
+             A lookup never changes after it is built. shared() returns the
+             lookup of the process; reload() builds a new one and swaps it
+             in atomically, readers keep the old one until they let it go.
+    \author Jürgen Mülbert
+    \since 0.7
+    \version 0.7
+    \date 25.12.2021
+    \copyright GPL-3.0-or-later
+    */
+class ZipCityLookup {
+  Q_DECLARE_TR_FUNCTIONS(ZipCityLookup)
+
+public:
+  /*!
+      \struct Entry
+      \brief One row of zip_city with its code and city name
+   */
+  struct Entry {
+    qint64 zipCityId{0};
+    qint64 zipCodeId{0};
+    qint64 cityId{0};
+    QString code;
+    QString city;
+  };
+
+  ZipCityLookup() = default;
+
+  /*!
+      \fn static auto build(const QSqlDatabase &db, QString *error = nullptr)
+                -> std::shared_ptr<const ZipCityLookup>
+
+      \brief Read zip_code, city_name and zip_city into a new lookup
+      \return the lookup, nullptr on an error
+   */
+  static JMBDEMODELS_EXPORT auto build(const QSqlDatabase &db,
+                                       QString *error = nullptr)
+      -> std::shared_ptr<const ZipCityLookup>;
+
+  /*!
+      \fn static auto shared() -> std::shared_ptr<const ZipCityLookup>
+
+      \brief The lookup of the process, empty until the first reload()
+   */
+  static JMBDEMODELS_EXPORT auto shared()
+      -> std::shared_ptr<const ZipCityLookup>;
+
+  /*!
+      \fn static auto reload(const QSqlDatabase &db) -> bool
+
+      \brief Build a new lookup and make it the shared one
+      \details On an error the shared lookup is kept.
+   */
+  static JMBDEMODELS_EXPORT auto reload(const QSqlDatabase &db) -> bool;
+
+  /*!
+      \fn auto size() const -> int
+
+      \brief The number of entries
+   */
+  JMBDEMODELS_EXPORT auto size() const -> int {
+    return static_cast<int>(m_entries.size());
+  }
+
+  /*!
+      \fn auto find(qint64 zipCityId) const -> const Entry *
+
+      \brief The entry of a zip_city_id, e.g. of an employee
+      \return the entry, nullptr if there is none
+   */
+  JMBDEMODELS_EXPORT auto find(qint64 zipCityId) const -> const Entry *;
+
+  /*!
+      \fn auto byCode(const QString &prefix, int limit = 20) const
+                -> QVector<Entry>
+
+      \brief The entries whose zip code starts with prefix, sorted by code
+   */
+  JMBDEMODELS_EXPORT auto byCode(const QString &prefix, int limit = 20) const
+      -> QVector<Entry>;
+
+  /*!
+      \fn auto byCity(const QString &prefix, int limit = 20) const
+                -> QVector<Entry>
+
+      \brief The entries whose city starts with prefix, ignoring the case,
+             sorted by city
+   */
+  JMBDEMODELS_EXPORT auto byCity(const QString &prefix, int limit = 20) const
+      -> QVector<Entry>;
+
+private:
+  // The entries sorted by zipCityId, and positions sorted by code and city
+  std::vector<Entry> m_entries;
+  std::vector<QString> m_cityKeys;
+  std::vector<int> m_byCode;
+  std::vector<int> m_byCity;
+};
+} // namespace Model
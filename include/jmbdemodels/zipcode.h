@@ -35,11 +35,13 @@ namespace Model {
 class ZipCode : public CommonData {
 public:
   /*!
-      \fn ZipCode()
+      \fn ZipCode(const QSharedPointer<Model::DataContext> &dataContext = {})
 
       \brief Constructor for the ZipCode
+      \param dataContext - The DataContext to use, the shared one if null
    */
-  explicit JMBDEMODELS_EXPORT ZipCode();
+  explicit JMBDEMODELS_EXPORT
+  ZipCode(const QSharedPointer<Model::DataContext> &dataContext = {});
 
   /*!
       \fn  ~ZipCode();
@@ -48,78 +50,7 @@ public:
    */
   JMBDEMODELS_EXPORT ~ZipCode() {}
 
-  // implement the virtuals
-
-  /*!
-      \fn virtual void setIndexes()
-      \brief Set the fieldindexes from the datafieldnames of the db.
-   */
-  virtual JMBDEMODELS_EXPORT void setIndexes() final;
-
-  /*!
-      \fn virtual JMBDEMODELS_EXPORT auto initializeRelationalModel() ->
-     QSqlRelationalTableModel* final \brief set the QSqlRelationalTableModel for
-     the DataModel \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeRelationalModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeInputDataModel() -> QSqlRelationalTableModel*
-     fina \brief Initialize the InputDataModel
-
-       \return The QSqlRelationalTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeInputDataModel()
-      -> QSqlRelationalTableModel * final;
-
-  /*!
-      \fn virtual auto initializeViewModel() -> QSqlTableModel* final
-      \brief Initialize the ViewModel
-
-      \return QSqlTableModel
-   */
-  virtual JMBDEMODELS_EXPORT auto initializeViewModel()
-      -> QSqlTableModel * final;
-
-  /*!
-      \fn virtual auto initializeListModel() -> QSqlTableModel* final
-      \brief Initiallize the list Model for select one dataset
-  */
-  virtual JMBDEMODELS_EXPORT auto initializeListModel()
-      -> QSqlTableModel * final;
-
-  /*!
-   * \fn virtual auto generateTableString(const QString& header) -> QString
-   final \brief generateTableString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateTableString(const QString &header)
-      -> QString final;
-
-  /*!
-      \fn virtual auto generateFormularString(const QString& header) -> QString
-     final \brief generateFormularString
-
-      \return a QString with the generated Table for Output
-   */
-  virtual JMBDEMODELS_EXPORT auto generateFormularString(const QString &header)
-      -> QString final;
-
   // Getter
-  /*!
-   * \brief getTableName
-   * \return
-   */
-  JMBDEMODELS_EXPORT auto getTableName() const -> QString {
-    return this->m_tableName;
-  }
-  /*!
-      \fn auot getDB() const -> QSqlDatabase
-   */
-  JMBDEMODELS_EXPORT auto getDB() const -> QSqlDatabase { return this->m_db; }
-
   /*!
       \fn  int ZipCodeIdIndex()
 
@@ -127,7 +58,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getZipCodeIdIndex() const { return m_ZipCodeIdIndex; }
+  JMBDEMODELS_EXPORT int getZipCodeIdIndex() const {
+    return this->getFieldIndex(Schema::ZipCode::ZipCodeId);
+  }
 
   /*!
       \fn  int CodeIndex()
@@ -136,7 +69,9 @@ public:
 
       Returns the value of the index
    */
-  JMBDEMODELS_EXPORT int getCodeIndex() const { return m_CodeIndex; }
+  JMBDEMODELS_EXPORT int getCodeIndex() const {
+    return this->getFieldIndex(Schema::ZipCode::Code);
+  }
 
   /*!
       \fn  int LastUpdateIndex()
@@ -146,41 +81,7 @@ public:
       Returns the value of the index
    */
   JMBDEMODELS_EXPORT int getLastUpdateIndex() const {
-    return m_LastUpdateIndex;
+    return this->getFieldIndex(Schema::ZipCode::LastUpdate);
   }
-
-private:
-  /*!
-      \brief The Tablename in the database \e is const
-   */
-  const QString m_tableName = QLatin1String("zip_code");
-
-  /*!
-   * @ brief m_db
-   */
-  QSqlDatabase m_db = {};
-
-  /*!
-   * @brief DataContext
-   */
-  Model::DataContext *m_dataContext = {};
-
-  /*!
-      \var int m_ZipCodeIdIndex
-      \brief The value of the ZipCodeIdIndex
-   */
-  int m_ZipCodeIdIndex{0};
-
-  /*!
-     \var int m_CodeIndex
-     \brief The value of the CodeIndex
-  */
-  int m_CodeIndex{0};
-
-  /*!
-      \var int m_LastUpdateIndex
-      \brief The value of the LastUpdateIndex
-  */
-  int m_LastUpdateIndex{0};
 };
 } // namespace Model
@@ -0,0 +1,390 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "jmbdemodels/accessresolver.h"
+
+#include <QtAlgorithms>
+
+#include <algorithm>
+
+#include "jmbdemodels/rowmapper.h"
+
+namespace {
+auto linkKey(int profile, int door) -> quint64 {
+  return (quint64(quint32(profile)) << 32) | quint32(door);
+}
+
+/*!
+    \brief Append the ids of the set bits of the bitmap
+ */
+void appendIds(const Model::Bitmap &bits, const std::vector<qint64> &ids,
+               QVector<qint64> &result) {
+  const auto &words = bits.words();
+  for (std::size_t i = 0; i < words.size(); ++i) {
+    auto word = words[i];
+    while (word != 0) {
+      const auto bit = qCountTrailingZeroBits(word);
+      result.append(ids[i * 64 + bit]);
+      word &= word - 1;
+    }
+  }
+}
+} // namespace
+
+auto Model::AccessResolver::load(const QSqlDatabase &db) -> bool {
+  RowReader<ChipCardDoorRow> doorReader(db);
+  RowReader<ChipCardProfileRow> profileReader(db);
+  RowReader<ChipCardProfileDoorRow> linkReader(db);
+  RowReader<ChipCardRow> cardReader(db);
+
+  const auto doors = doorReader.select();
+  const auto profiles = profileReader.select();
+  const auto links = linkReader.select();
+  const auto cards = cardReader.select();
+
+  QString error;
+  for (const auto &reader :
+       {doorReader.lastError(), profileReader.lastError(),
+        linkReader.lastError(), cardReader.lastError()}) {
+    if (error.isEmpty()) {
+      error = reader;
+    }
+  }
+
+  QWriteLocker locker(&this->m_lock);
+  this->m_error = error;
+  if (!error.isEmpty()) {
+    return false;
+  }
+
+  this->clear();
+  for (const auto &door : doors) {
+    this->doorSlot(door.chipCardDoorId);
+  }
+  for (const auto &profile : profiles) {
+    this->profileSlot(profile.chipCardProfileId);
+    if (profile.chipCardDoorId) {
+      this->m_profileOwnDoors.insert(profile.chipCardProfileId,
+                                     *profile.chipCardDoorId);
+      this->link(profile.chipCardProfileId, *profile.chipCardDoorId);
+    }
+  }
+  for (const auto &link : links) {
+    if (link.chipCardProfileId && link.chipCardDoorId) {
+      this->m_profileDoorRows.insert(
+          link.chipCardProfileDoorId,
+          qMakePair(*link.chipCardProfileId, *link.chipCardDoorId));
+      this->link(*link.chipCardProfileId, *link.chipCardDoorId);
+    }
+  }
+  for (const auto &card : cards) {
+    this->setCardLocked(card);
+  }
+  return true;
+}
+
+auto Model::AccessResolver::lastError() const -> QString {
+  QReadLocker locker(&this->m_lock);
+  return this->m_error;
+}
+
+auto Model::AccessResolver::canOpen(qint64 cardId, qint64 doorId) const
+    -> bool {
+  QReadLocker locker(&this->m_lock);
+
+  const auto card = this->m_cards.constFind(cardId);
+  const auto door = this->m_doorSlots.constFind(doorId);
+  if (card == this->m_cards.cend() || door == this->m_doorSlots.cend()) {
+    return false;
+  }
+  if (card->door == *door) {
+    return true;
+  }
+  return card->profile >= 0 &&
+         this->m_profileDoors[card->profile].test(std::size_t(*door));
+}
+
+auto Model::AccessResolver::doorsOf(qint64 cardId) const -> QVector<qint64> {
+  QReadLocker locker(&this->m_lock);
+  QVector<qint64> doors;
+
+  const auto card = this->m_cards.constFind(cardId);
+  if (card == this->m_cards.cend()) {
+    return doors;
+  }
+
+  if (card->profile >= 0) {
+    appendIds(this->m_profileDoors[card->profile], this->m_doorIds, doors);
+  }
+  if (card->door >= 0 &&
+      (card->profile < 0 ||
+       !this->m_profileDoors[card->profile].test(std::size_t(card->door)))) {
+    doors.append(this->m_doorIds[card->door]);
+  }
+  return doors;
+}
+
+auto Model::AccessResolver::profilesFor(qint64 doorId) const
+    -> QVector<qint64> {
+  QReadLocker locker(&this->m_lock);
+  QVector<qint64> profiles;
+
+  const auto door = this->m_doorSlots.constFind(doorId);
+  if (door != this->m_doorSlots.cend()) {
+    appendIds(this->m_doorProfiles[*door], this->m_profileIds, profiles);
+  }
+  return profiles;
+}
+
+auto Model::AccessResolver::cardsFor(qint64 doorId) const -> QVector<qint64> {
+  QReadLocker locker(&this->m_lock);
+  QVector<qint64> cards;
+
+  const auto door = this->m_doorSlots.constFind(doorId);
+  if (door == this->m_doorSlots.cend()) {
+    return cards;
+  }
+
+  QVector<qint64> profiles;
+  appendIds(this->m_doorProfiles[*door], this->m_profileIds, profiles);
+  for (const auto profileId : profiles) {
+    for (const auto cardId :
+         this->m_profileCards[this->m_profileSlots.value(profileId)]) {
+      cards.append(cardId);
+    }
+  }
+  for (const auto cardId : this->m_doorCards[*door]) {
+    cards.append(cardId);
+  }
+
+  // A card with the door in its profile and as its own door
+  std::sort(cards.begin(), cards.end());
+  cards.erase(std::unique(cards.begin(), cards.end()), cards.end());
+  return cards;
+}
+
+void Model::AccessResolver::setDoor(const ChipCardDoorRow &door) {
+  QWriteLocker locker(&this->m_lock);
+  this->doorSlot(door.chipCardDoorId);
+}
+
+void Model::AccessResolver::removeDoor(qint64 doorId) {
+  QWriteLocker locker(&this->m_lock);
+
+  const auto door = this->m_doorSlots.value(doorId, -1);
+  if (door < 0) {
+    return;
+  }
+
+  QVector<qint64> profiles;
+  appendIds(this->m_doorProfiles[door], this->m_profileIds, profiles);
+  for (const auto profileId : profiles) {
+    const auto profile = this->m_profileSlots.value(profileId);
+    this->m_profileDoors[profile].set(std::size_t(door), false);
+    this->m_links.remove(linkKey(profile, door));
+  }
+  this->m_doorProfiles[door] = Bitmap(this->m_profileIds.size());
+
+  for (auto it = this->m_profileDoorRows.begin();
+       it != this->m_profileDoorRows.end();) {
+    it = it->second == doorId ? this->m_profileDoorRows.erase(it) : ++it;
+  }
+  for (auto it = this->m_profileOwnDoors.begin();
+       it != this->m_profileOwnDoors.end();) {
+    it = it.value() == doorId ? this->m_profileOwnDoors.erase(it) : ++it;
+  }
+  for (const auto cardId : this->m_doorCards[door]) {
+    this->m_cards[cardId].door = -1;
+  }
+  this->m_doorCards[door].clear();
+
+  this->m_doorIds[door] = 0;
+  this->m_doorSlots.remove(doorId);
+}
+
+void Model::AccessResolver::setProfile(const ChipCardProfileRow &profile) {
+  QWriteLocker locker(&this->m_lock);
+
+  const auto id = profile.chipCardProfileId;
+  this->profileSlot(id);
+
+  if (this->m_profileOwnDoors.contains(id)) {
+    this->unlink(id, this->m_profileOwnDoors.take(id));
+  }
+  if (profile.chipCardDoorId) {
+    this->m_profileOwnDoors.insert(id, *profile.chipCardDoorId);
+    this->link(id, *profile.chipCardDoorId);
+  }
+}
+
+void Model::AccessResolver::removeProfile(qint64 profileId) {
+  QWriteLocker locker(&this->m_lock);
+
+  const auto profile = this->m_profileSlots.value(profileId, -1);
+  if (profile < 0) {
+    return;
+  }
+
+  QVector<qint64> doors;
+  appendIds(this->m_profileDoors[profile], this->m_doorIds, doors);
+  for (const auto doorId : doors) {
+    const auto door = this->m_doorSlots.value(doorId);
+    this->m_doorProfiles[door].set(std::size_t(profile), false);
+    this->m_links.remove(linkKey(profile, door));
+  }
+  this->m_profileDoors[profile] = Bitmap(this->m_doorIds.size());
+
+  for (auto it = this->m_profileDoorRows.begin();
+       it != this->m_profileDoorRows.end();) {
+    it = it->first == profileId ? this->m_profileDoorRows.erase(it) : ++it;
+  }
+  this->m_profileOwnDoors.remove(profileId);
+  for (const auto cardId : this->m_profileCards[profile]) {
+    this->m_cards[cardId].profile = -1;
+  }
+  this->m_profileCards[profile].clear();
+
+  this->m_profileIds[profile] = 0;
+  this->m_profileSlots.remove(profileId);
+}
+
+void Model::AccessResolver::setProfileDoor(
+    const ChipCardProfileDoorRow &link) {
+  QWriteLocker locker(&this->m_lock);
+
+  const auto id = link.chipCardProfileDoorId;
+  if (this->m_profileDoorRows.contains(id)) {
+    const auto old = this->m_profileDoorRows.take(id);
+    this->unlink(old.first, old.second);
+  }
+  if (link.chipCardProfileId && link.chipCardDoorId) {
+    this->m_profileDoorRows.insert(
+        id, qMakePair(*link.chipCardProfileId, *link.chipCardDoorId));
+    this->link(*link.chipCardProfileId, *link.chipCardDoorId);
+  }
+}
+
+void Model::AccessResolver::removeProfileDoor(qint64 linkId) {
+  QWriteLocker locker(&this->m_lock);
+
+  if (this->m_profileDoorRows.contains(linkId)) {
+    const auto old = this->m_profileDoorRows.take(linkId);
+    this->unlink(old.first, old.second);
+  }
+}
+
+void Model::AccessResolver::setCard(const ChipCardRow &card) {
+  QWriteLocker locker(&this->m_lock);
+  this->setCardLocked(card);
+}
+
+void Model::AccessResolver::removeCard(qint64 cardId) {
+  QWriteLocker locker(&this->m_lock);
+  this->removeCardLocked(cardId);
+}
+
+void Model::AccessResolver::clear() {
+  this->m_doorSlots.clear();
+  this->m_doorIds.clear();
+  this->m_profileSlots.clear();
+  this->m_profileIds.clear();
+  this->m_profileDoors.clear();
+  this->m_doorProfiles.clear();
+  this->m_links.clear();
+  this->m_profileDoorRows.clear();
+  this->m_profileOwnDoors.clear();
+  this->m_cards.clear();
+  this->m_profileCards.clear();
+  this->m_doorCards.clear();
+}
+
+auto Model::AccessResolver::doorSlot(qint64 doorId) -> int {
+  const auto found = this->m_doorSlots.constFind(doorId);
+  if (found != this->m_doorSlots.cend()) {
+    return *found;
+  }
+
+  const auto slot = static_cast<int>(this->m_doorIds.size());
+  this->m_doorSlots.insert(doorId, slot);
+  this->m_doorIds.push_back(doorId);
+  this->m_doorProfiles.emplace_back(this->m_profileIds.size());
+  this->m_doorCards.emplace_back();
+  for (auto &doors : this->m_profileDoors) {
+    doors.append(false);
+  }
+  return slot;
+}
+
+auto Model::AccessResolver::profileSlot(qint64 profileId) -> int {
+  const auto found = this->m_profileSlots.constFind(profileId);
+  if (found != this->m_profileSlots.cend()) {
+    return *found;
+  }
+
+  const auto slot = static_cast<int>(this->m_profileIds.size());
+  this->m_profileSlots.insert(profileId, slot);
+  this->m_profileIds.push_back(profileId);
+  this->m_profileDoors.emplace_back(this->m_doorIds.size());
+  this->m_profileCards.emplace_back();
+  for (auto &profiles : this->m_doorProfiles) {
+    profiles.append(false);
+  }
+  return slot;
+}
+
+void Model::AccessResolver::link(qint64 profileId, qint64 doorId) {
+  const auto profile = this->profileSlot(profileId);
+  const auto door = this->doorSlot(doorId);
+
+  if (this->m_links[linkKey(profile, door)]++ == 0) {
+    this->m_profileDoors[profile].set(std::size_t(door));
+    this->m_doorProfiles[door].set(std::size_t(profile));
+  }
+}
+
+void Model::AccessResolver::unlink(qint64 profileId, qint64 doorId) {
+  const auto profile = this->m_profileSlots.value(profileId, -1);
+  const auto door = this->m_doorSlots.value(doorId, -1);
+  if (profile < 0 || door < 0) {
+    return;
+  }
+
+  // Several rows can link the same profile and door
+  const auto key = linkKey(profile, door);
+  auto count = this->m_links.find(key);
+  if (count == this->m_links.end() || --(*count) > 0) {
+    return;
+  }
+  this->m_links.erase(count);
+  this->m_profileDoors[profile].set(std::size_t(door), false);
+  this->m_doorProfiles[door].set(std::size_t(profile), false);
+}
+
+void Model::AccessResolver::setCardLocked(const ChipCardRow &card) {
+  this->removeCardLocked(card.chipCardId);
+
+  Card entry;
+  if (card.chipCardProfileId) {
+    entry.profile = this->profileSlot(*card.chipCardProfileId);
+    this->m_profileCards[entry.profile].insert(card.chipCardId);
+  }
+  if (card.chipCardDoorId) {
+    entry.door = this->doorSlot(*card.chipCardDoorId);
+    this->m_doorCards[entry.door].insert(card.chipCardId);
+  }
+  this->m_cards.insert(card.chipCardId, entry);
+}
+
+void Model::AccessResolver::removeCardLocked(qint64 cardId) {
+  const auto card = this->m_cards.take(cardId);
+  if (card.profile >= 0) {
+    this->m_profileCards[card.profile].remove(cardId);
+  }
+  if (card.door >= 0) {
+    this->m_doorCards[card.door].remove(cardId);
+  }
+}
@@ -7,100 +7,6 @@
 
 #include "jmbdemodels/account.h"
 
-Model::Account::Account() {
-  this->m_dataContext = new Model::DataContext();
-  this->m_db = m_dataContext->getDatabase();
-
-  // Set the Model
-  this->m_model = new QSqlRelationalTableModel(this, this->m_db);
-  this->m_model->setTable(this->m_tableName);
-  this->m_model->setEditStrategy(QSqlTableModel::OnManualSubmit);
-
-  setIndexes();
-}
-
-void Model::Account::setIndexes() {
-  m_AccountIdIndex = this->m_model->fieldIndex(QLatin1String("account_id"));
-  m_UserNameIndex = this->m_model->fieldIndex(QLatin1String("user_name"));
-  m_PasswordIndex = this->m_model->fieldIndex(QLatin1String("password"));
-  m_SystemDataIdIndex =
-      this->m_model->fieldIndex(QLatin1String("system_data_id"));
-  m_LastUpdateIndex = this->m_model->fieldIndex(QLatin1String("last_update"));
-}
-
-auto Model::Account::initializeRelationalModel() -> QSqlRelationalTableModel * {
-  this->m_model = new QSqlRelationalTableModel(this, this->m_db);
-
-  this->m_model->setTable(this->m_tableName);
-  this->m_model->setEditStrategy(QSqlTableModel::OnManualSubmit);
-
-  this->m_model->select();
-
-  return this->m_model;
-}
-
-auto Model::Account::initializeInputDataModel() -> QSqlRelationalTableModel * {
-  this->m_model = new QSqlRelationalTableModel(this, this->m_db);
-
-  this->m_model->setTable(this->m_tableName);
-
-  return this->m_model;
-}
-
-auto Model::Account::initializeViewModel() -> QSqlTableModel * {
-  this->m_model->select();
-
-  return this->m_model;
-}
-
-auto Model::Account::initializeListModel() -> QSqlTableModel * {
-  auto *listModel = new QSqlTableModel(this, this->m_db);
-  listModel->setTable(this->m_tableName);
-  listModel->setEditStrategy(QSqlTableModel::OnManualSubmit);
-  listModel->select();
-
-  return listModel;
-}
-
-auto Model::Account::generateTableString(const QString &header) -> QString {
-  QString outString;
-
-  qDebug() << "Header:" << header
-           << "( Columns: " << this->m_model->columnCount()
-           << " Rows: " << this->m_model->rowCount() << " )";
-
-  QList<int> set;
-
-  // Document Title
-  outString = QLatin1String("<h1>");
-  outString += header;
-  outString += QLatin1String("</h1>");
-  outString += QLatin1String("<hr />");
-  outString +=
-      QLatin1String(R"(<table width="100%" cellspacing="0" class="tbl">)");
-  outString += QLatin1String("<thead> <tr>");
-
-  for (const auto i : set) {
-    outString += QLatin1String("<th>");
-    outString.append(m_model->headerData(i, Qt::Horizontal).toString());
-    outString += QLatin1String("</th>");
-  }
-
-  return outString;
-}
-
-auto Model::Account::generateFormularString(const QString &header) -> QString {
-  QString outString;
-
-  qDebug() << "Header:" << header
-           << "( Columns: " << this->m_model->columnCount()
-           << " Rows: " << this->m_model->rowCount() << " )";
-
-  // Document Title
-  outString = QLatin1String("<h1>");
-  outString += header;
-  outString += QLatin1String("</h1>");
-  outString += QLatin1String("<hr />");
-
-  return outString;
-}
+Model::Account::Account(
+    const QSharedPointer<Model::DataContext> &dataContext)
+    : CommonData(Schema::Account::Table, dataContext) {}
@@ -0,0 +1,172 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "jmbdemodels/blobstream.h"
+
+#include <QByteArray>
+#include <QSqlError>
+#include <QSqlQuery>
+
+#include <limits>
+
+#include "jmbdemodels/sqlitestatement.h"
+#include "jmbdemodels/transaction.h"
+
+Model::BlobStream::BlobStream(const QSqlDatabase &db,
+                              const TableDescriptor &table, int column)
+    : m_db(db), m_table(&table),
+      m_column(QLatin1String(table.columns[column].name)),
+      m_key(QLatin1String(table.primaryKey().name)) {}
+
+auto Model::BlobStream::size(qint64 id) -> qint64 {
+  QSqlQuery query(this->m_db);
+  query.setForwardOnly(true);
+  query.prepare(QStringLiteral("SELECT %1(%2) FROM %3 WHERE %4 = ?")
+                    .arg(QLatin1String(this->isPostgres() ? "octet_length"
+                                                          : "length"),
+                         this->m_column, QLatin1String(this->m_table->name),
+                         this->m_key));
+  query.addBindValue(id);
+
+  if (!query.exec()) {
+    this->m_error = query.lastError().text();
+    return -1;
+  }
+  if (!query.next()) {
+    this->m_error = tr("Die Zeile %1 gibt es nicht").arg(id);
+    return -1;
+  }
+  this->m_error.clear();
+  return query.value(0).toLongLong();
+}
+
+auto Model::BlobStream::read(qint64 id, QIODevice *device) -> qint64 {
+  const auto total = this->size(id);
+  if (total <= 0) {
+    return total;
+  }
+
+  qint64 written = 0;
+  if (SqliteStatement::isSupported(this->m_db)) {
+    SqliteBlob blob(this->m_db, QLatin1String(this->m_table->name),
+                    this->m_column, id);
+    QByteArray chunk;
+    while (blob.isValid() && written < blob.size()) {
+      chunk.resize(
+          int(qMin<qint64>(this->m_chunkSize, blob.size() - written)));
+      if (!blob.read(int(written), chunk.data(), chunk.size())) {
+        break;
+      }
+      if (device->write(chunk) != chunk.size()) {
+        this->m_error = device->errorString();
+        return -1;
+      }
+      written += chunk.size();
+    }
+    if (!blob.lastError().isEmpty()) {
+      this->m_error = blob.lastError();
+      return -1;
+    }
+    return written;
+  }
+
+  // substr() and substring() count from 1
+  QSqlQuery query(this->m_db);
+  query.setForwardOnly(true);
+  query.prepare(
+      QString(QLatin1String(this->isPostgres()
+                                ? "SELECT substring(%1 from ? for ?) FROM %2 "
+                                  "WHERE %3 = ?"
+                                : "SELECT substr(%1, ?, ?) FROM %2 "
+                                  "WHERE %3 = ?"))
+          .arg(this->m_column, QLatin1String(this->m_table->name),
+               this->m_key));
+
+  while (written < total) {
+    query.bindValue(0, written + 1);
+    query.bindValue(1, this->m_chunkSize);
+    query.bindValue(2, id);
+    if (!query.exec() || !query.next()) {
+      this->m_error = query.lastError().text();
+      return -1;
+    }
+
+    const auto chunk = query.value(0).toByteArray();
+    query.finish();
+    if (chunk.isEmpty()) {
+      break;
+    }
+    if (device->write(chunk) != chunk.size()) {
+      this->m_error = device->errorString();
+      return -1;
+    }
+    written += chunk.size();
+  }
+  return written;
+}
+
+auto Model::BlobStream::write(qint64 id, QIODevice *device, qint64 size)
+    -> bool {
+  if (size < 0 && !device->isSequential()) {
+    size = device->size() - device->pos();
+  }
+
+  const auto table = QLatin1String(this->m_table->name);
+  QSqlQuery query(this->m_db);
+
+  if (SqliteStatement::isSupported(this->m_db) && size >= 0 &&
+      size <= std::numeric_limits<int>::max()) {
+    Transaction transaction(this->m_db);
+
+    // The blob gets its final size first, then the chunks are written
+    query.prepare(
+        QStringLiteral("UPDATE %1 SET %2 = zeroblob(?) WHERE %3 = ?")
+            .arg(table, this->m_column, this->m_key));
+    query.addBindValue(size);
+    query.addBindValue(id);
+    auto ok = query.exec() && query.numRowsAffected() == 1;
+    this->m_error = ok ? QString() : query.lastError().text();
+
+    if (ok && size > 0) {
+      SqliteBlob blob(this->m_db, table, this->m_column, id, true);
+      qint64 offset = 0;
+      ok = blob.isValid();
+      while (ok && offset < size) {
+        const auto chunk =
+            device->read(qMin<qint64>(this->m_chunkSize, size - offset));
+        ok = !chunk.isEmpty() &&
+             blob.write(int(offset), chunk.constData(), chunk.size());
+        offset += chunk.size();
+      }
+      if (!ok) {
+        this->m_error = blob.lastError().isEmpty() ? device->errorString()
+                                                   : blob.lastError();
+      }
+    }
+
+    if (!ok) {
+      transaction.rollback();
+      return false;
+    }
+    return !transaction.isActive() || transaction.commit();
+  }
+
+  query.prepare(QStringLiteral("UPDATE %1 SET %2 = ? WHERE %3 = ?")
+                    .arg(table, this->m_column, this->m_key));
+  query.addBindValue(size < 0 ? device->readAll() : device->read(size));
+  query.addBindValue(id);
+  if (!query.exec() || query.numRowsAffected() != 1) {
+    this->m_error = query.lastError().text();
+    return false;
+  }
+  this->m_error.clear();
+  return true;
+}
+
+auto Model::BlobStream::isPostgres() const -> bool {
+  return this->m_db.driverName() == QLatin1String("QPSQL");
+}
@@ -0,0 +1,339 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "jmbdemodels/changenotifier.h"
+
+#include <QFile>
+#include <QPair>
+#include <QSqlError>
+#include <QSqlQuery>
+
+#include "jmbdemodels/datacontext.h"
+#include "jmbdemodels/schema.h"
+
+namespace {
+const auto channel = QLatin1String("jmbde_change");
+
+auto isSchemaTable(const QString &name) -> bool {
+  for (const auto *table : Model::Schema::Tables) {
+    if (name == QLatin1String(table->name)) {
+      return true;
+    }
+  }
+  return false;
+}
+} // namespace
+
+Model::ChangeNotifier::ChangeNotifier(DataContext *context)
+    : QObject(context), m_context(context) {
+  qRegisterMetaType<Model::RowOperation>();
+
+  this->m_delay.setSingleShot(true);
+  this->m_delay.setInterval(100);
+  connect(&this->m_delay, &QTimer::timeout, this, &ChangeNotifier::refresh);
+
+  // A full refresh that was held back runs at the end of the pause
+  this->m_fullRefresh.setSingleShot(true);
+  this->m_fullRefresh.setInterval(5000);
+  connect(&this->m_fullRefresh, &QTimer::timeout, this, [this]() {
+    if (this->m_fullRefreshPending) {
+      this->m_fullRefreshPending = false;
+      this->refreshAll();
+    }
+  });
+
+  // A replaced file is dropped by the watcher, it is added again
+  connect(&this->m_watcher, &QFileSystemWatcher::fileChanged, this,
+          [this]() {
+            this->watchFiles();
+            this->m_delay.start();
+          });
+
+  this->attach();
+}
+
+Model::ChangeNotifier::~ChangeNotifier() { this->detach(); }
+
+void Model::ChangeNotifier::attach() {
+  if (this->m_hook) {
+    return;
+  }
+
+  // The hook runs inside the write, the signals are sent afterwards
+  this->m_hook = std::make_unique<SqliteUpdateHook>(
+      this->m_context->getDatabase(), [this]() {
+        QTimer::singleShot(0, this, [this]() { this->emitCommitted(); });
+      });
+  if (!this->m_hook->isValid()) {
+    this->m_hook.reset();
+    return;
+  }
+  this->m_hook->setRowLimit(this->m_rowLimit);
+}
+
+void Model::ChangeNotifier::setRowLimit(int rows) {
+  this->m_rowLimit = qMax(0, rows);
+  if (this->m_hook) {
+    this->m_hook->setRowLimit(this->m_rowLimit);
+  }
+}
+
+void Model::ChangeNotifier::detach() {
+  this->stop();
+  this->m_hook.reset();
+}
+
+auto Model::ChangeNotifier::start() -> bool {
+  if (this->m_active) {
+    return true;
+  }
+
+  const auto db = this->m_context->getDatabase();
+  if (db.driverName() == QLatin1String("QPSQL")) {
+    auto *driver = db.driver();
+    if (!driver->subscribeToNotification(channel)) {
+      qWarning() << tr("LISTEN %1 ist fehlgeschlagen: %2")
+                        .arg(channel, driver->lastError().text());
+      return false;
+    }
+    connect(driver,
+            QOverload<const QString &, QSqlDriver::NotificationSource,
+                      const QVariant &>::of(&QSqlDriver::notification),
+            this, &ChangeNotifier::notification);
+    this->m_active = true;
+    return true;
+  }
+
+  if (db.driverName() != QLatin1String("QSQLITE") ||
+      db.databaseName().isEmpty() ||
+      db.databaseName() == QLatin1String(":memory:")) {
+    return false;
+  }
+
+  // Only rows stamped after now are new to this process
+  const auto now = QDateTime::currentDateTimeUtc();
+  for (const auto *table : Schema::Tables) {
+    if (table->indexOf("last_update") >= 0) {
+      this->m_watermarks.insert(QLatin1String(table->name), now);
+    }
+  }
+  this->m_dataVersion = this->dataVersion();
+  this->m_active = true;
+  this->watchFiles();
+  return true;
+}
+
+void Model::ChangeNotifier::stop() {
+  if (!this->m_active) {
+    return;
+  }
+  this->m_active = false;
+  this->m_delay.stop();
+  this->m_fullRefresh.stop();
+  this->m_fullRefreshPending = false;
+
+  const auto files = this->m_watcher.files();
+  if (!files.isEmpty()) {
+    this->m_watcher.removePaths(files);
+  }
+
+  const auto db = this->m_context->getDatabase();
+  if (db.driverName() == QLatin1String("QPSQL") && db.isOpen()) {
+    auto *driver = db.driver();
+    disconnect(driver, nullptr, this, nullptr);
+    driver->unsubscribeFromNotification(channel);
+  }
+}
+
+void Model::ChangeNotifier::refresh() {
+  if (!this->m_active || this->m_watermarks.isEmpty()) {
+    return;
+  }
+
+  // data_version only moves for the commits of other connections
+  const auto version = this->dataVersion();
+  if (version == this->m_dataVersion) {
+    return;
+  }
+  this->m_dataVersion = version;
+
+  bool found = false;
+  for (const auto *table : Schema::Tables) {
+    const auto name = QLatin1String(table->name);
+    auto it = this->m_watermarks.find(name);
+    if (it == this->m_watermarks.end()) {
+      continue;
+    }
+
+    // Many rows, e.g. a bulk load, are reported as the table
+    const auto stamped = this->stampedSince(name, it.value());
+    if (stamped.first == 0) {
+      continue;
+    }
+    found = true;
+    if (stamped.first > this->m_rowLimit) {
+      it.value() = stamped.second;
+      emit tableChanged(name);
+      continue;
+    }
+
+    const auto changes = this->m_context->changesSince(*table, it.value());
+    if (!changes.rows.isValid()) {
+      continue;
+    }
+    it.value() = changes.watermark;
+    for (const auto &row : changes.rows.rows) {
+      emit rowChanged(changes.table, row.first().toLongLong(),
+                      RowOperation::Update);
+    }
+    for (const auto rowId : changes.deleted) {
+      emit rowChanged(changes.table, rowId, RowOperation::Delete);
+    }
+  }
+
+  // Another process committed, but neither a new last_update nor a delete
+  // shows what: it wrote last_update itself (DataGenerator does) or a
+  // table without one. Every table is selected again, at most once per
+  // getFullRefreshInterval().
+  if (!found) {
+    if (this->m_fullRefresh.isActive()) {
+      this->m_fullRefreshPending = true;
+    } else {
+      this->refreshAll();
+    }
+  }
+}
+
+void Model::ChangeNotifier::refreshAll() {
+  this->m_fullRefresh.start();
+  for (const auto *table : Schema::Tables) {
+    emit tableChanged(QLatin1String(table->name));
+  }
+}
+
+auto Model::ChangeNotifier::stampedSince(const QString &table,
+                                         const QDateTime &since) const
+    -> QPair<qint64, QDateTime> {
+  // SQLite keeps the timestamps as ISO text in UTC
+  const auto watermark = since.toUTC().toString(Qt::ISODateWithMs);
+  qint64 count = 0;
+  QDateTime newest = since;
+
+  QSqlQuery query(this->m_context->getDatabase());
+  const auto read = [&]() {
+    if (query.exec() && query.next()) {
+      count += query.value(0).toLongLong();
+      const auto timestamp = QDateTime::fromString(query.value(1).toString(),
+                                                   Qt::ISODateWithMs);
+      if (timestamp.isValid() && timestamp > newest) {
+        newest = timestamp;
+      }
+    }
+  };
+
+  query.prepare(QStringLiteral("SELECT count(*), max(last_update) FROM %1 "
+                               "WHERE last_update > ?")
+                    .arg(table));
+  query.addBindValue(watermark);
+  read();
+
+  query.prepare(QStringLiteral("SELECT count(*), max(deleted_at) FROM "
+                               "deleted_row WHERE table_name = ? AND "
+                               "deleted_at > ?"));
+  query.addBindValue(table);
+  query.addBindValue(watermark);
+  read();
+
+  return qMakePair(count, newest);
+}
+
+void Model::ChangeNotifier::emitCommitted() {
+  if (!this->m_hook) {
+    return;
+  }
+
+  const auto committed = this->m_hook->takeCommitted();
+
+  // A table with too many rows is reported once
+  for (const auto &table : committed.tables) {
+    if (isSchemaTable(table)) {
+      emit tableChanged(table);
+    }
+  }
+
+  // One signal per row: the trigger of last_update turns an insert into
+  // an insert and an update, a delete wins over everything
+  QHash<QPair<QString, qint64>, int> seen;
+  QVector<SqliteUpdateHook::Change> changes;
+  for (const auto &change : committed.rows) {
+    if (!isSchemaTable(change.table)) {
+      continue;
+    }
+
+    const auto key = qMakePair(change.table, change.rowId);
+    const auto it = seen.constFind(key);
+    if (it == seen.cend()) {
+      seen.insert(key, changes.size());
+      changes.append(change);
+      continue;
+    }
+
+    auto &first = changes[it.value()];
+    if (change.operation == RowOperation::Delete) {
+      first.operation = RowOperation::Delete;
+    } else if (first.operation == RowOperation::Delete) {
+      first.operation = RowOperation::Update;
+    }
+  }
+
+  for (const auto &change : changes) {
+    emit rowChanged(change.table, change.rowId, change.operation);
+  }
+}
+
+void Model::ChangeNotifier::watchFiles() {
+  if (!this->m_active) {
+    return;
+  }
+
+  const auto path = this->m_context->getDatabase().databaseName();
+  const auto watched = this->m_watcher.files();
+  for (const auto &file : {path, path + QLatin1String("-wal")}) {
+    if (!watched.contains(file) && QFile::exists(file)) {
+      this->m_watcher.addPath(file);
+    }
+  }
+}
+
+void Model::ChangeNotifier::notification(const QString &name,
+                                         QSqlDriver::NotificationSource,
+                                         const QVariant &payload) {
+  if (name != channel) {
+    return;
+  }
+
+  // <table>:<INSERT|UPDATE|DELETE>:<key>
+  const auto parts = payload.toString().split(QLatin1Char(':'));
+  if (parts.size() != 3) {
+    return;
+  }
+
+  const auto operation = parts.at(1) == QLatin1String("INSERT")
+                             ? RowOperation::Insert
+                         : parts.at(1) == QLatin1String("DELETE")
+                             ? RowOperation::Delete
+                             : RowOperation::Update;
+  emit rowChanged(parts.at(0), parts.at(2).toLongLong(), operation);
+}
+
+auto Model::ChangeNotifier::dataVersion() const -> qint64 {
+  QSqlQuery query(this->m_context->getDatabase());
+  if (query.exec(QStringLiteral("PRAGMA data_version")) && query.next()) {
+    return query.value(0).toLongLong();
+  }
+  return -1;
+}
@@ -0,0 +1,454 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "jmbdemodels/columnarsnapshot.h"
+
+#include <QHash>
+#include <QSqlError>
+#include <QSqlQuery>
+
+#include "jmbdemodels/sqlitestatement.h"
+
+namespace {
+constexpr std::size_t wordCount(std::size_t bits) { return (bits + 63) / 64; }
+
+/*!
+    \brief Build a bitmap from a predicate over the row index
+
+    The inner loop fills one word without branches, which lets the compiler
+    vectorize the comparison.
+ */
+template <typename Predicate>
+auto makeBitmap(std::size_t rows, Predicate predicate) -> Model::Bitmap {
+  Model::Bitmap bitmap(rows);
+  for (std::size_t base = 0; base < rows; base += 64) {
+    const std::size_t end = qMin<std::size_t>(rows - base, 64);
+    quint64 word = 0;
+    for (std::size_t j = 0; j < end; ++j) {
+      word |= quint64(predicate(base + j) ? 1 : 0) << j;
+    }
+    bitmap.setWord(base >> 6, word);
+  }
+  return bitmap;
+}
+
+/*!
+    \brief QSqlQuery with the accessors of SqliteStatement
+ */
+class QueryRow {
+public:
+  explicit QueryRow(const QSqlQuery &query) : m_query(query) {}
+
+  auto isNull(int column) const -> bool { return m_query.isNull(column); }
+  auto toInt64(int column) const -> qint64 {
+    return m_query.value(column).toLongLong();
+  }
+  auto toDouble(int column) const -> double {
+    return m_query.value(column).toDouble();
+  }
+  auto toString(int column) const -> QString {
+    const auto value = m_query.value(column);
+    if (value.userType() == QMetaType::QDateTime) {
+      return value.toDateTime().toString(Qt::ISODateWithMs);
+    }
+    if (value.userType() == QMetaType::QDate) {
+      return value.toDate().toString(Qt::ISODate);
+    }
+    return value.toString();
+  }
+
+private:
+  const QSqlQuery &m_query;
+};
+
+/*!
+    \brief The dictionaries of one column while the snapshot is read
+ */
+struct Dictionary {
+  QHash<QString, quint32> strings;
+  QHash<qint64, quint32> keys;
+};
+
+template <typename Source>
+void appendRow(std::vector<Model::ColumnarSnapshot::Column> &columns,
+               std::vector<Dictionary> &dictionaries, const Source &row) {
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    auto &column = columns[i];
+    if (!column.loaded) {
+      continue;
+    }
+
+    const int index = static_cast<int>(i);
+    const bool null = row.isNull(index);
+    column.nulls.append(null);
+
+    switch (column.type) {
+    case Model::ColumnType::Integer:
+      if (column.foreignKey) {
+        quint32 code = 0;
+        if (!null) {
+          const auto key = row.toInt64(index);
+          auto it = dictionaries[i].keys.constFind(key);
+          if (it == dictionaries[i].keys.cend()) {
+            column.keys.push_back(key);
+            code = static_cast<quint32>(column.keys.size());
+            dictionaries[i].keys.insert(key, code);
+          } else {
+            code = it.value();
+          }
+        }
+        column.codes.push_back(code);
+      } else {
+        column.integers.push_back(null ? 0 : row.toInt64(index));
+      }
+      break;
+    case Model::ColumnType::Real:
+      column.reals.push_back(null ? 0.0 : row.toDouble(index));
+      break;
+    case Model::ColumnType::Boolean:
+      column.booleans.append(!null && row.toInt64(index) != 0);
+      break;
+    case Model::ColumnType::Text: {
+      quint32 code = 0;
+      if (!null) {
+        const auto text = row.toString(index);
+        auto it = dictionaries[i].strings.constFind(text);
+        if (it == dictionaries[i].strings.cend()) {
+          column.strings.append(text);
+          code = static_cast<quint32>(column.strings.size());
+          dictionaries[i].strings.insert(text, code);
+        } else {
+          code = it.value();
+        }
+      }
+      column.codes.push_back(code);
+      break;
+    }
+    case Model::ColumnType::Date:
+      column.integers.push_back(
+          null ? 0
+               : QDate::fromString(row.toString(index), Qt::ISODate)
+                     .toJulianDay());
+      break;
+    case Model::ColumnType::DateTime:
+      column.integers.push_back(
+          null ? 0
+               : QDateTime::fromString(row.toString(index), Qt::ISODateWithMs)
+                     .toMSecsSinceEpoch());
+      break;
+    case Model::ColumnType::Blob:
+      break;
+    }
+  }
+}
+} // namespace
+
+Model::Bitmap::Bitmap(std::size_t size, bool value)
+    : m_words(wordCount(size), value ? ~quint64(0) : quint64(0)),
+      m_size(size) {
+  if (value && (size & 63) != 0) {
+    m_words.back() &= (quint64(1) << (size & 63)) - 1;
+  }
+}
+
+void Model::Bitmap::append(bool value) {
+  if ((this->m_size & 63) == 0) {
+    this->m_words.push_back(0);
+  }
+  ++this->m_size;
+  this->set(this->m_size - 1, value);
+}
+
+auto Model::Bitmap::count() const -> std::size_t {
+  std::size_t bits = 0;
+  for (const auto word : this->m_words) {
+    bits += static_cast<std::size_t>(qPopulationCount(word));
+  }
+  return bits;
+}
+
+auto Model::Bitmap::operator&=(const Bitmap &other) -> Bitmap & {
+  const auto words = qMin(this->m_words.size(), other.m_words.size());
+  for (std::size_t i = 0; i < words; ++i) {
+    this->m_words[i] &= other.m_words[i];
+  }
+  for (std::size_t i = words; i < this->m_words.size(); ++i) {
+    this->m_words[i] = 0;
+  }
+  return *this;
+}
+
+auto Model::Bitmap::operator|=(const Bitmap &other) -> Bitmap & {
+  const auto words = qMin(this->m_words.size(), other.m_words.size());
+  for (std::size_t i = 0; i < words; ++i) {
+    this->m_words[i] |= other.m_words[i];
+  }
+  return *this;
+}
+
+auto Model::Bitmap::operator~() const -> Bitmap {
+  Bitmap result(*this);
+  for (auto &word : result.m_words) {
+    word = ~word;
+  }
+  if ((result.m_size & 63) != 0) {
+    result.m_words.back() &= (quint64(1) << (result.m_size & 63)) - 1;
+  }
+  return result;
+}
+
+auto Model::operator&(Bitmap left, const Bitmap &right) -> Bitmap {
+  left &= right;
+  return left;
+}
+
+auto Model::operator|(Bitmap left, const Bitmap &right) -> Bitmap {
+  left |= right;
+  return left;
+}
+
+auto Model::ColumnarSnapshot::fromTable(const QSqlDatabase &db,
+                                        const TableDescriptor &table,
+                                        const QString &where,
+                                        const QVariantList &binds)
+    -> ColumnarSnapshot {
+  ColumnarSnapshot snapshot;
+  std::vector<Dictionary> dictionaries(table.columnCount);
+
+  QStringList columns;
+  for (std::size_t i = 0; i < table.columnCount; ++i) {
+    const auto &descriptor = table.columns[i];
+
+    Column column;
+    column.name = QLatin1String(descriptor.name);
+    column.type = descriptor.type;
+    column.foreignKey = descriptor.type == ColumnType::Integer &&
+                        descriptor.references != nullptr;
+    column.loaded = descriptor.type != ColumnType::Blob;
+    snapshot.m_columns.push_back(std::move(column));
+
+    // Keep the positions of the descriptor, but don't read the blobs
+    columns.append(descriptor.type == ColumnType::Blob
+                       ? QLatin1String("NULL")
+                       : QLatin1String(descriptor.name));
+  }
+
+  auto sql = QLatin1String("SELECT ") + columns.join(QLatin1Char(',')) +
+             QLatin1String(" FROM ") + QLatin1String(table.name);
+  if (!where.isEmpty()) {
+    sql += QLatin1String(" WHERE ") + where;
+  }
+
+  if (SqliteStatement::isSupported(db)) {
+    SqliteStatement statement(db, sql);
+    for (int i = 0; statement.isValid() && i < binds.size(); ++i) {
+      statement.bind(i, binds.at(i));
+    }
+    while (statement.next()) {
+      appendRow(snapshot.m_columns, dictionaries, statement);
+      ++snapshot.m_rows;
+    }
+    snapshot.m_error = statement.lastError();
+    return snapshot;
+  }
+
+  QSqlQuery query(db);
+  query.setForwardOnly(true);
+  if (!query.prepare(sql)) {
+    snapshot.m_error = query.lastError().text();
+    return snapshot;
+  }
+  for (int i = 0; i < binds.size(); ++i) {
+    query.bindValue(i, binds.at(i));
+  }
+  if (!query.exec()) {
+    snapshot.m_error = query.lastError().text();
+    return snapshot;
+  }
+
+  const QueryRow row(query);
+  while (query.next()) {
+    appendRow(snapshot.m_columns, dictionaries, row);
+    ++snapshot.m_rows;
+  }
+
+  return snapshot;
+}
+
+auto Model::ColumnarSnapshot::value(int column, std::size_t row) const
+    -> QVariant {
+  const auto &data = this->column(column);
+  if (!data.loaded || row >= this->m_rows || data.nulls.test(row)) {
+    return QVariant();
+  }
+
+  switch (data.type) {
+  case ColumnType::Integer:
+    if (data.foreignKey) {
+      return data.keys[data.codes[row] - 1];
+    }
+    return data.integers[row];
+  case ColumnType::Real:
+    return data.reals[row];
+  case ColumnType::Boolean:
+    return data.booleans.test(row);
+  case ColumnType::Text:
+    return data.strings.at(static_cast<int>(data.codes[row]) - 1);
+  case ColumnType::Date:
+    return QDate::fromJulianDay(data.integers[row]);
+  case ColumnType::DateTime:
+    return QDateTime::fromMSecsSinceEpoch(data.integers[row]);
+  case ColumnType::Blob:
+    break;
+  }
+  return QVariant();
+}
+
+auto Model::ColumnarSnapshot::isNull(int column) const -> Bitmap {
+  const auto &data = this->column(column);
+  return data.loaded ? data.nulls : this->all();
+}
+
+auto Model::ColumnarSnapshot::isTrue(int column) const -> Bitmap {
+  const auto &data = this->column(column);
+  if (data.type != ColumnType::Boolean) {
+    return Bitmap(this->m_rows);
+  }
+  return data.booleans;
+}
+
+auto Model::ColumnarSnapshot::equals(int column, qint64 value) const
+    -> Bitmap {
+  const auto &data = this->column(column);
+
+  if (data.foreignKey) {
+    quint32 code = 0;
+    for (std::size_t i = 0; i < data.keys.size(); ++i) {
+      if (data.keys[i] == value) {
+        code = static_cast<quint32>(i + 1);
+        break;
+      }
+    }
+    if (code == 0) {
+      return Bitmap(this->m_rows);
+    }
+    const auto *codes = data.codes.data();
+    return makeBitmap(this->m_rows,
+                      [codes, code](std::size_t i) { return codes[i] == code; });
+  }
+
+  if (data.type != ColumnType::Integer) {
+    return Bitmap(this->m_rows);
+  }
+  const auto *values = data.integers.data();
+  return makeBitmap(this->m_rows,
+                    [values, value](std::size_t i) {
+                      return values[i] == value;
+                    }) &
+         ~data.nulls;
+}
+
+auto Model::ColumnarSnapshot::equals(int column, const QString &value) const
+    -> Bitmap {
+  const auto &data = this->column(column);
+  if (data.type != ColumnType::Text) {
+    return Bitmap(this->m_rows);
+  }
+
+  const auto code = static_cast<quint32>(data.strings.indexOf(value) + 1);
+  if (code == 0) {
+    return Bitmap(this->m_rows);
+  }
+  const auto *codes = data.codes.data();
+  return makeBitmap(this->m_rows,
+                    [codes, code](std::size_t i) { return codes[i] == code; });
+}
+
+auto Model::ColumnarSnapshot::between(int column, qint64 low,
+                                      qint64 high) const -> Bitmap {
+  const auto &data = this->column(column);
+  if (data.integers.size() != this->m_rows) {
+    return Bitmap(this->m_rows);
+  }
+
+  const auto *values = data.integers.data();
+  return makeBitmap(this->m_rows,
+                    [values, low, high](std::size_t i) {
+                      return values[i] >= low && values[i] <= high;
+                    }) &
+         ~data.nulls;
+}
+
+auto Model::ColumnarSnapshot::between(int column, const QDate &low,
+                                      const QDate &high) const -> Bitmap {
+  if (this->column(column).type == ColumnType::DateTime) {
+    return this->between(column, low.startOfDay().toMSecsSinceEpoch(),
+                         high.endOfDay().toMSecsSinceEpoch());
+  }
+  return this->between(column, low.toJulianDay(), high.toJulianDay());
+}
+
+auto Model::ColumnarSnapshot::countBy(int column,
+                                      const Bitmap &selection) const
+    -> QVector<QPair<QVariant, qint64>> {
+  const auto &data = this->column(column);
+  QVector<QPair<QVariant, qint64>> groups;
+  if (!data.isDictionary()) {
+    return groups;
+  }
+
+  const auto dictionarySize = data.foreignKey
+                                  ? data.keys.size()
+                                  : static_cast<std::size_t>(data.strings.size());
+  std::vector<qint64> counts(dictionarySize + 1, 0);
+
+  const auto *codes = data.codes.data();
+  if (selection.isEmpty()) {
+    for (std::size_t i = 0; i < this->m_rows; ++i) {
+      ++counts[codes[i]];
+    }
+  } else {
+    for (std::size_t i = 0; i < this->m_rows; ++i) {
+      counts[codes[i]] += selection.test(i) ? 1 : 0;
+    }
+  }
+
+  for (std::size_t code = 0; code < counts.size(); ++code) {
+    if (counts[code] == 0) {
+      continue;
+    }
+    QVariant key;
+    if (code > 0) {
+      key = data.foreignKey
+                ? QVariant(data.keys[code - 1])
+                : QVariant(data.strings.at(static_cast<int>(code) - 1));
+    }
+    groups.append(qMakePair(key, counts[code]));
+  }
+  return groups;
+}
+
+auto Model::ColumnarSnapshot::sum(int column, const Bitmap &selection) const
+    -> double {
+  const auto &data = this->column(column);
+  const auto rows = selection.isEmpty() ? this->all() : selection;
+  const auto valid = rows & ~data.nulls;
+
+  double total = 0.0;
+  if (data.type == ColumnType::Real) {
+    const auto *values = data.reals.data();
+    for (std::size_t i = 0; i < this->m_rows; ++i) {
+      total += valid.test(i) ? values[i] : 0.0;
+    }
+  } else if (data.type == ColumnType::Integer && !data.foreignKey) {
+    const auto *values = data.integers.data();
+    for (std::size_t i = 0; i < this->m_rows; ++i) {
+      total += valid.test(i) ? static_cast<double>(values[i]) : 0.0;
+    }
+  }
+  return total;
+}
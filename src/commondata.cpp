@@ -7,6 +7,328 @@
 
 #include "jmbdemodels/commondata.h"
 
+#include <QBuffer>
+#include <QTimer>
+
+#include <string_view>
+
+#include "jmbdemodels/changenotifier.h"
+
+namespace {
+QMutex &indexCacheMutex() {
+  static QMutex mutex;
+  return mutex;
+}
+
+QHash<QString, QVector<int>> &indexCache() {
+  static QHash<QString, QVector<int>> indexes;
+  return indexes;
+}
+
+/*!
+    \brief Select the BLOB columns or not, if the model can leave them out
+ */
+void setLoadBlobs(QSqlTableModel *model, bool load) {
+  auto *lazyModel = qobject_cast<Model::LazyBlobTableModel *>(model);
+  if (lazyModel != nullptr) {
+    lazyModel->setLoadBlobs(load);
+  }
+}
+
+/*!
+    \brief The descriptor of a table of the schema, nullptr if there is none
+ */
+auto schemaTable(const char *name) -> const Model::TableDescriptor * {
+  if (name == nullptr) {
+    return nullptr;
+  }
+  for (const auto *table : Model::Schema::Tables) {
+    if (std::string_view(table->name) == name) {
+      return table;
+    }
+  }
+  return nullptr;
+}
+
+/*!
+    \brief The column that shows a row of the table in a relation: name, the
+           first text column or the primary key
+ */
+auto displayColumn(const Model::TableDescriptor &table) -> QString {
+  if (table.indexOf("name") >= 0) {
+    return QStringLiteral("name");
+  }
+  for (std::size_t i = 1; i < table.columnCount; ++i) {
+    if (table.columns[i].type == Model::ColumnType::Text) {
+      return QLatin1String(table.columns[i].name);
+    }
+  }
+  return QLatin1String(table.primaryKey().name);
+}
+} // namespace
+
+Model::CommonData::CommonData(
+    const TableDescriptor &table,
+    const QSharedPointer<Model::DataContext> &dataContext)
+    : m_table(&table) {
+  this->m_dataContext =
+      dataContext.isNull() ? Model::DataContext::shared() : dataContext;
+  this->m_db = this->m_dataContext->getDatabase();
+
+  // Set the Model
+  this->resetModel(this->getTableName());
+  this->m_model->setEditStrategy(QSqlTableModel::OnManualSubmit);
+
+  this->setIndexes();
+
+  auto *notifier = this->m_dataContext->notifier();
+  connect(notifier, &ChangeNotifier::rowChanged, this,
+          &CommonData::refreshRow);
+  connect(notifier, &ChangeNotifier::tableChanged, this,
+          [this](const QString &table) {
+            this->refreshRow(table, 0, RowOperation::Insert);
+          });
+}
+
+void Model::CommonData::refreshRow(const QString &table, qint64 rowId,
+                                   Model::RowOperation operation) {
+  auto *model = this->m_model;
+  if (model == nullptr || table != model->tableName() || model->isDirty() ||
+      !model->query().isActive()) {
+    return;
+  }
+
+  // The inserts and deletes of one commit are selected once, after the
+  // signals of the commit
+  if (this->m_selectQueued) {
+    return;
+  }
+  if (operation != RowOperation::Update) {
+    this->m_selectQueued = true;
+    QTimer::singleShot(0, this, [this]() {
+      this->m_selectQueued = false;
+      auto *model = this->m_model;
+      if (model != nullptr && !model->isDirty() &&
+          model->query().isActive()) {
+        model->select();
+      }
+    });
+    return;
+  }
+
+  // Only the fetched rows can be stale
+  const auto key = this->getFieldIndex(
+      this->m_table->indexOf(this->m_table->primaryKey().name));
+  if (key < 0) {
+    return;
+  }
+  if (!this->m_rowByKeyValid) {
+    this->m_rowByKey.clear();
+    this->m_rowByKey.reserve(model->rowCount());
+    for (int row = 0; row < model->rowCount(); ++row) {
+      this->m_rowByKey.insert(
+          model->data(model->index(row, key)).toLongLong(), row);
+    }
+    this->m_rowByKeyValid = true;
+  }
+
+  const auto row = this->m_rowByKey.value(rowId, -1);
+  if (row >= 0) {
+    model->selectRow(row);
+  }
+}
+
+void Model::CommonData::setIndexes() {
+  const auto key = QStringLiteral("%1|%2|%3")
+                       .arg(this->m_db.connectionName(),
+                            this->m_db.databaseName(), this->getTableName());
+
+  QMutexLocker locker(&indexCacheMutex());
+
+  auto it = indexCache().constFind(key);
+  if (it != indexCache().cend()) {
+    this->m_indexes = it.value();
+    return;
+  }
+
+  // The model orders its fields like the record of the table
+  const auto record = this->m_db.record(this->getTableName());
+
+  QVector<int> indexes(static_cast<int>(this->m_table->columnCount));
+  for (int i = 0; i < indexes.size(); ++i) {
+    indexes[i] = record.indexOf(QLatin1String(this->m_table->columns[i].name));
+  }
+  this->m_indexes = indexes;
+
+  if (!record.isEmpty()) {
+    indexCache().insert(key, indexes);
+  }
+}
+
+void Model::CommonData::clearIndexCache() {
+  QMutexLocker locker(&indexCacheMutex());
+  indexCache().clear();
+}
+
+auto Model::CommonData::initializeRelationalModel()
+    -> QSqlRelationalTableModel * {
+  this->resetModel(this->getTableName());
+  this->m_model->setEditStrategy(QSqlTableModel::OnManualSubmit);
+  setLoadBlobs(this->m_model, true);
+
+  // The foreign keys of the descriptor show the referenced row, a row
+  // without one is kept
+  this->m_model->setJoinMode(QSqlRelationalTableModel::LeftJoin);
+  for (std::size_t i = 0; i < this->m_table->columnCount; ++i) {
+    const auto *referenced = schemaTable(this->m_table->columns[i].references);
+    const auto index = this->getFieldIndex(static_cast<int>(i));
+    if (referenced == nullptr || index < 0 ||
+        this->m_db.record(QLatin1String(referenced->name)).isEmpty()) {
+      continue;
+    }
+    this->m_model->setRelation(
+        index, QSqlRelation(QLatin1String(referenced->name),
+                            QLatin1String(referenced->primaryKey().name),
+                            displayColumn(*referenced)));
+  }
+
+  this->m_model->select();
+
+  return this->m_model;
+}
+
+auto Model::CommonData::initializeInputDataModel()
+    -> QSqlRelationalTableModel * {
+  this->resetModel(this->getTableName());
+  setLoadBlobs(this->m_model, true);
+
+  return this->m_model;
+}
+
+auto Model::CommonData::initializeViewModel() -> QSqlTableModel * {
+  setLoadBlobs(this->m_model, false);
+  this->m_model->select();
+
+  return this->m_model;
+}
+
+auto Model::CommonData::initializeListModel() -> QSqlTableModel * {
+  auto *listModel = this->resetListModel(this->getTableName());
+  listModel->select();
+
+  return listModel;
+}
+
+auto Model::CommonData::generateTableString(const QString &header)
+    -> QString {
+  QBuffer buffer;
+  buffer.open(QIODevice::WriteOnly);
+  this->writeReport(&buffer, ReportWriter::Format::Html, header);
+
+  return QString::fromUtf8(buffer.data());
+}
+
+auto Model::CommonData::generateFormularString(const QString &header)
+    -> QString {
+  QString outString;
+
+  // Document Title
+  outString = QLatin1String("<h1>");
+  outString += header.toHtmlEscaped();
+  outString += QLatin1String("</h1>");
+  outString += QLatin1String("<hr />");
+
+  return outString;
+}
+
+auto Model::CommonData::writeReport(QIODevice *device,
+                                    ReportWriter::Format format,
+                                    const QString &header,
+                                    const QString &where,
+                                    const QVariantList &binds) -> bool {
+  QStringList columns;
+  QStringList labels;
+  for (std::size_t i = 0; i < this->m_table->columnCount; ++i) {
+    const auto &column = this->m_table->columns[i];
+    if (column.type == ColumnType::Blob) {
+      continue;
+    }
+    columns.append(QLatin1String(column.name));
+
+    // The header of the model, if a view has set one
+    const auto index = this->getFieldIndex(static_cast<int>(i));
+    labels.append(index >= 0 && this->m_model != nullptr
+                      ? this->m_model->headerData(index, Qt::Horizontal)
+                            .toString()
+                      : columns.last());
+  }
+
+  Cursor rows(this->m_db, this->selectStatement(where, Blobs::Skip), binds,
+              this->m_dataContext->getFetchSize());
+  if (!rows.isValid()) {
+    qWarning() << tr("Fehler beim Lesen der Tabelle ") << this->getTableName()
+               << " : " << rows.lastError();
+    return false;
+  }
+
+  ReportWriter writer(device, format);
+  writer.begin(header, format == ReportWriter::Format::Html ? labels : columns);
+
+  QVariantList values;
+  values.reserve(columns.size());
+  while (rows.next()) {
+    values.clear();
+    for (int i = 0; i < columns.size(); ++i) {
+      values.append(rows.value(i));
+    }
+    writer.writeRow(values);
+  }
+
+  return writer.finish() && rows.isValid();
+}
+
+auto Model::CommonData::readBlob(int column, qint64 id, QIODevice *device)
+    -> qint64 {
+  BlobStream blob(this->m_db, *this->m_table, column);
+  const auto size = blob.read(id, device);
+  if (size < 0) {
+    qWarning() << tr("Fehler beim Lesen der Daten aus ")
+               << this->getTableName() << " : " << blob.lastError();
+  }
+  return size;
+}
+
+auto Model::CommonData::writeBlob(int column, qint64 id, QIODevice *device,
+                                  qint64 size) -> bool {
+  BlobStream blob(this->m_db, *this->m_table, column);
+  if (!blob.write(id, device, size)) {
+    qWarning() << tr("Fehler beim Schreiben der Daten in ")
+               << this->getTableName() << " : " << blob.lastError();
+    return false;
+  }
+  return true;
+}
+
+auto Model::CommonData::selectStatement(const QString &where,
+                                        Blobs blobs) const -> QString {
+  QStringList columns;
+  for (std::size_t i = 0; i < this->m_table->columnCount; ++i) {
+    const auto &column = this->m_table->columns[i];
+    if (column.type != ColumnType::Blob || blobs == Blobs::Select) {
+      columns.append(QLatin1String(column.name));
+    } else if (blobs == Blobs::AsNull) {
+      columns.append(QLatin1String("NULL AS ") + QLatin1String(column.name));
+    }
+  }
+
+  auto sql = QLatin1String("SELECT ") + columns.join(QLatin1Char(',')) +
+             QLatin1String(" FROM ") + QLatin1String(this->m_table->name);
+  if (!where.isEmpty()) {
+    sql += QLatin1String(" WHERE ") + where;
+  }
+  return sql;
+}
+
 auto Model::CommonData::createSheet() -> QTextDocument * {
   auto *document = new QTextDocument;
 
@@ -37,3 +359,280 @@ auto Model::CommonData::setOutFormularStyle() -> QString {
 
   return css;
 }
+
+auto Model::CommonData::selectAsync() -> QFuture<ResultSet> {
+  // The BLOB values stay in the database, like in the list models
+  const auto sql =
+      this->selectStatement(this->m_model->filter(), Blobs::AsNull);
+
+  auto future = this->m_dataContext->execAsync(sql);
+
+  auto *watcher = new QFutureWatcher<ResultSet>(this);
+  connect(watcher, &QFutureWatcher<ResultSet>::finished, this,
+          [this, watcher]() {
+            const auto resultSet = watcher->result();
+            watcher->deleteLater();
+
+            if (!resultSet.isValid()) {
+              qWarning() << tr("Fehler beim Lesen der Tabelle ")
+                         << this->m_model->tableName() << " : "
+                         << resultSet.error;
+            }
+
+            this->beginResetModel();
+            this->m_resultSet = resultSet;
+            this->m_hasResultSet = true;
+            this->m_roleNames.clear();
+            this->endResetModel();
+
+            emit this->selectFinished();
+          });
+  watcher->setFuture(future);
+
+  return future;
+}
+
+void Model::CommonData::setModel(QSqlRelationalTableModel *model) {
+  if (this->m_model == model) {
+    return;
+  }
+
+  this->beginResetModel();
+
+  if (this->m_model != nullptr) {
+    disconnect(this->m_model, nullptr, this, nullptr);
+  }
+
+  this->m_model = model;
+  this->m_roleNames.clear();
+  this->m_rowByKeyValid = false;
+  this->m_hasResultSet = false;
+  this->m_resultSet = ResultSet();
+
+  if (model != nullptr) {
+    connect(model, &QAbstractItemModel::modelAboutToBeReset, this,
+            [this]() { this->beginResetModel(); });
+    connect(model, &QAbstractItemModel::modelReset, this, [this]() {
+      this->m_roleNames.clear();
+      this->m_rowByKeyValid = false;
+      this->m_hasResultSet = false;
+      this->m_resultSet = ResultSet();
+      this->endResetModel();
+    });
+    connect(model, &QAbstractItemModel::rowsAboutToBeInserted, this,
+            [this](const QModelIndex &, int first, int last) {
+              if (!this->m_hasResultSet) {
+                this->beginInsertRows(QModelIndex(), first, last);
+              }
+            });
+    connect(model, &QAbstractItemModel::rowsInserted, this, [this]() {
+      this->m_rowByKeyValid = false;
+      if (!this->m_hasResultSet) {
+        this->endInsertRows();
+      }
+    });
+    connect(model, &QAbstractItemModel::rowsAboutToBeRemoved, this,
+            [this](const QModelIndex &, int first, int last) {
+              if (!this->m_hasResultSet) {
+                this->beginRemoveRows(QModelIndex(), first, last);
+              }
+            });
+    connect(model, &QAbstractItemModel::rowsRemoved, this, [this]() {
+      this->m_rowByKeyValid = false;
+      if (!this->m_hasResultSet) {
+        this->endRemoveRows();
+      }
+    });
+    connect(model, &QAbstractItemModel::dataChanged, this,
+            [this](const QModelIndex &topLeft, const QModelIndex &bottomRight,
+                   const QVector<int> &roles) {
+              if (this->m_hasResultSet) {
+                return;
+              }
+              emit this->dataChanged(
+                  this->index(topLeft.row(), topLeft.column()),
+                  this->index(bottomRight.row(), bottomRight.column()),
+                  roles);
+            });
+    connect(model, &QAbstractItemModel::headerDataChanged, this,
+            &QAbstractItemModel::headerDataChanged);
+    connect(model, &QAbstractItemModel::layoutChanged, this, [this]() {
+      this->m_rowByKeyValid = false;
+      emit this->layoutChanged();
+    });
+  }
+
+  this->endResetModel();
+}
+
+auto Model::CommonData::rowCount(const QModelIndex &parent) const -> int {
+  if (parent.isValid()) {
+    return 0;
+  }
+  if (this->m_hasResultSet) {
+    return static_cast<int>(this->m_resultSet.rows.size());
+  }
+  return this->m_model != nullptr ? this->m_model->rowCount() : 0;
+}
+
+auto Model::CommonData::columnCount(const QModelIndex &parent) const -> int {
+  if (parent.isValid()) {
+    return 0;
+  }
+  if (this->m_hasResultSet) {
+    return static_cast<int>(this->m_resultSet.columns.size());
+  }
+  return this->m_model != nullptr ? this->m_model->columnCount() : 0;
+}
+
+auto Model::CommonData::data(const QModelIndex &index, int role) const
+    -> QVariant {
+  if (!index.isValid() || index.row() >= this->rowCount()) {
+    return QVariant();
+  }
+
+  int column = index.column();
+  if (role > Qt::UserRole) {
+    column = role - Qt::UserRole - 1;
+    role = Qt::DisplayRole;
+  } else if (role != Qt::DisplayRole && role != Qt::EditRole) {
+    return QVariant();
+  }
+
+  if (column < 0 || column >= this->columnCount()) {
+    return QVariant();
+  }
+
+  if (this->m_hasResultSet) {
+    return this->m_resultSet.rows.at(index.row()).value(column);
+  }
+
+  return this->m_model->data(this->m_model->index(index.row(), column), role);
+}
+
+auto Model::CommonData::headerData(int section, Qt::Orientation orientation,
+                                   int role) const -> QVariant {
+  if (this->m_hasResultSet) {
+    if (orientation == Qt::Horizontal && role == Qt::DisplayRole) {
+      return this->m_resultSet.columns.value(section);
+    }
+  } else if (this->m_model != nullptr) {
+    return this->m_model->headerData(section, orientation, role);
+  }
+  return QAbstractTableModel::headerData(section, orientation, role);
+}
+
+auto Model::CommonData::canFetchMore(const QModelIndex &parent) const -> bool {
+  if (parent.isValid() || this->m_hasResultSet || this->m_model == nullptr) {
+    return false;
+  }
+  return this->m_model->canFetchMore();
+}
+
+void Model::CommonData::fetchMore(const QModelIndex &parent) {
+  if (parent.isValid() || this->m_hasResultSet || this->m_model == nullptr) {
+    return;
+  }
+
+  // The rows signals of the model announce the new rows to the views
+  this->m_model->fetchMore();
+}
+
+auto Model::CommonData::roleNames() const -> QHash<int, QByteArray> {
+  if (this->m_roleNames.isEmpty()) {
+    this->m_roleNames = QAbstractTableModel::roleNames();
+
+    if (this->m_hasResultSet) {
+      for (int i = 0; i < this->m_resultSet.columns.size(); ++i) {
+        this->m_roleNames.insert(Qt::UserRole + 1 + i,
+                                 this->m_resultSet.columns.at(i).toUtf8());
+      }
+    } else if (this->m_model != nullptr) {
+      // The model names a relation column after the display column
+      const auto record = this->m_db.record(this->m_model->tableName());
+      for (int i = 0; i < record.count(); ++i) {
+        this->m_roleNames.insert(Qt::UserRole + 1 + i,
+                                 record.fieldName(i).toUtf8());
+      }
+    }
+  }
+  return this->m_roleNames;
+}
+
+auto Model::CommonData::release() -> bool {
+  bool released = true;
+
+  // setTable() would drop the pending changes without a word
+  if (this->m_model != nullptr && this->m_model->isDirty()) {
+    qWarning() << tr("Ungespeicherte Änderungen, das Modell bleibt geladen: ")
+               << this->getTableName();
+    released = false;
+  } else if (this->m_model != nullptr) {
+    QHash<int, QSqlRelation> relations;
+    for (int i = 0; i < this->m_model->columnCount(); ++i) {
+      const auto relation = this->m_model->relation(i);
+      if (relation.isValid()) {
+        relations.insert(i, relation);
+      }
+    }
+    const auto filter = this->m_model->filter();
+
+    // setTable() clears the query and with it the cached rows
+    this->m_model->setTable(this->m_model->tableName());
+
+    for (auto it = relations.cbegin(); it != relations.cend(); ++it) {
+      this->m_model->setRelation(it.key(), it.value());
+    }
+    this->m_model->setFilter(filter);
+  }
+
+  if (this->m_listModel != nullptr && this->m_listModel->isDirty()) {
+    qWarning() << tr("Ungespeicherte Änderungen, das Modell bleibt geladen: ")
+               << this->getTableName();
+    released = false;
+  } else if (this->m_listModel != nullptr) {
+    const auto filter = this->m_listModel->filter();
+    this->m_listModel->setTable(this->m_listModel->tableName());
+    this->m_listModel->setFilter(filter);
+  }
+
+  if (this->m_hasResultSet) {
+    this->beginResetModel();
+    this->m_resultSet = ResultSet();
+    this->m_hasResultSet = false;
+    this->m_roleNames.clear();
+    this->endResetModel();
+  }
+
+  return released;
+}
+
+auto Model::CommonData::resetModel(const QString &tableName)
+    -> QSqlRelationalTableModel * {
+  if (this->m_model == nullptr) {
+    this->setModel(
+        new LazyBlobTableModel(*this->m_table, this, this->m_db));
+  }
+
+  // Same state as a new model: no pending changes and the default strategy
+  this->m_model->revertAll();
+  this->m_model->setEditStrategy(QSqlTableModel::OnRowChange);
+  setLoadBlobs(this->m_model, false);
+  this->m_model->setTable(tableName);
+
+  return this->m_model;
+}
+
+auto Model::CommonData::resetListModel(const QString &tableName)
+    -> QSqlTableModel * {
+  if (this->m_listModel == nullptr) {
+    this->m_listModel =
+        new LazyBlobTableModel(*this->m_table, this, this->m_db);
+  }
+
+  this->m_listModel->revertAll();
+  this->m_listModel->setTable(tableName);
+  this->m_listModel->setEditStrategy(QSqlTableModel::OnManualSubmit);
+
+  return this->m_listModel;
+}
@@ -0,0 +1,295 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "jmbdemodels/connectionpool.h"
+
+#include <QDebug>
+#include <QSqlError>
+#include <QSqlQuery>
+
+Model::ConnectionPool::ConnectionPool(const QSqlDatabase &master,
+                                      QObject *parent)
+    : QObject(parent), m_master(master),
+      m_maxConnections(QThread::idealThreadCount()) {
+  connect(&this->m_idleTimer, &QTimer::timeout, this,
+          [this]() { this->closeIdleConnections(this->m_idleTimeout); });
+  this->m_idleTimer.start(qMax(1000, this->m_idleTimeout / 2));
+}
+
+Model::ConnectionPool::~ConnectionPool() {
+  QMutexLocker locker(&this->m_mutex);
+
+  auto clones = this->m_stale;
+  for (auto it = this->m_connections.cbegin(); it != this->m_connections.cend();
+       ++it) {
+    if (it->useCount > 0) {
+      qWarning() << tr("Datenbankverbindung wird noch benutzt: ")
+                 << it->db.connectionName();
+    }
+    clones.insert(it.key(), it.value());
+  }
+  this->m_connections.clear();
+  this->m_stale.clear();
+
+  // Only the thread of a clone may remove it, when it finishes
+  for (auto it = clones.cbegin(); it != clones.cend(); ++it) {
+    disconnect(it->finished);
+    const auto name = it->db.connectionName();
+    connect(
+        it.key(), &QThread::finished, it.key(),
+        [name]() { QSqlDatabase::removeDatabase(name); },
+        Qt::DirectConnection);
+  }
+}
+
+auto Model::ConnectionPool::acquire(int timeout) -> QSqlDatabase {
+  auto *thread = QThread::currentThread();
+
+  // The owning thread works with the master connection itself
+  if (thread == this->thread()) {
+    return this->m_master;
+  }
+
+  QMutexLocker locker(&this->m_mutex);
+
+  // A clone that lost its slot is closed here, on its own thread
+  if (this->m_stale.contains(thread)) {
+    this->closeConnection(thread);
+  }
+
+  auto it = this->m_connections.find(thread);
+  if (it != this->m_connections.end()) {
+    ++it->useCount;
+    return it->db;
+  }
+
+  const auto deadline = timeout < 0
+                            ? QDeadlineTimer(QDeadlineTimer::Forever)
+                            : QDeadlineTimer(static_cast<qint64>(timeout));
+
+  while (this->m_maxConnections > 0 &&
+         this->m_connections.size() >= this->m_maxConnections) {
+    if (this->closeOldestIdle()) {
+      break;
+    }
+
+    ++this->m_waiting;
+    const bool woken = this->m_slotFree.wait(&this->m_mutex, deadline);
+    --this->m_waiting;
+
+    if (!woken) {
+      qWarning() << tr("Keine freie Datenbankverbindung nach ") << timeout
+                 << tr(" ms. Maximum: ") << this->m_maxConnections;
+      return {};
+    }
+  }
+
+  const auto name = QStringLiteral("%1_pool_%2")
+                        .arg(this->m_master.connectionName())
+                        .arg(++this->m_serial);
+
+  Connection connection;
+  // By name, the master itself belongs to the thread of the pool
+  connection.db =
+      QSqlDatabase::cloneDatabase(this->m_master.connectionName(), name);
+  if (!connection.db.open()) {
+    qCritical() << tr("Fehler beim öffnen der Datenbank : ")
+                << connection.db.lastError().text() << name;
+    connection.db = QSqlDatabase();
+    QSqlDatabase::removeDatabase(name);
+    return {};
+  }
+  for (const auto &statement : qAsConst(this->m_initStatements)) {
+    QSqlQuery query(connection.db);
+    if (!query.exec(statement)) {
+      qWarning() << tr("Fehler beim Ausführen von ") << statement << " : "
+                 << query.lastError().text();
+    }
+  }
+
+  connection.useCount = 1;
+  connection.finished = connect(
+      thread, &QThread::finished, this,
+      [this, thread]() { this->threadFinished(thread); },
+      Qt::DirectConnection);
+
+  this->m_connections.insert(thread, connection);
+
+  qDebug() << tr("Neue Datenbankverbindung für Thread : ") << name;
+
+  return connection.db;
+}
+
+void Model::ConnectionPool::release() {
+  auto *thread = QThread::currentThread();
+
+  if (thread == this->thread()) {
+    return;
+  }
+
+  QMutexLocker locker(&this->m_mutex);
+
+  auto it = this->m_connections.find(thread);
+  if (it == this->m_connections.end() || it->useCount == 0) {
+    qWarning() << tr("Freigabe einer nicht belegten Datenbankverbindung");
+    return;
+  }
+
+  if (--it->useCount == 0) {
+    it->idleSince.start();
+
+    // Give the slot to a waiting thread right away
+    if (it->stale || this->m_waiting > 0 || this->m_idleTimeout == 0) {
+      this->closeConnection(thread);
+    }
+  }
+}
+
+void Model::ConnectionPool::setMaster(const QSqlDatabase &master) {
+  QMutexLocker locker(&this->m_mutex);
+
+  this->m_master = master;
+
+  const auto threads = this->m_connections.keys();
+  for (auto *thread : threads) {
+    if (this->m_connections.value(thread).useCount == 0) {
+      this->dropConnection(thread);
+    } else {
+      // Closed by release()
+      this->m_connections[thread].stale = true;
+    }
+  }
+}
+
+void Model::ConnectionPool::setInitStatements(const QStringList &statements) {
+  QMutexLocker locker(&this->m_mutex);
+  this->m_initStatements = statements;
+}
+
+void Model::ConnectionPool::setMaxConnections(int maxConnections) {
+  QMutexLocker locker(&this->m_mutex);
+  this->m_maxConnections = maxConnections;
+  this->m_slotFree.wakeAll();
+}
+
+auto Model::ConnectionPool::getMaxConnections() const -> int {
+  QMutexLocker locker(&this->m_mutex);
+  return this->m_maxConnections;
+}
+
+void Model::ConnectionPool::setIdleTimeout(int msecs) {
+  QMutexLocker locker(&this->m_mutex);
+  this->m_idleTimeout = msecs;
+
+  if (msecs > 0) {
+    this->m_idleTimer.start(qMax(1000, msecs / 2));
+  } else {
+    this->m_idleTimer.stop();
+  }
+}
+
+auto Model::ConnectionPool::getIdleTimeout() const -> int {
+  QMutexLocker locker(&this->m_mutex);
+  return this->m_idleTimeout;
+}
+
+auto Model::ConnectionPool::getOpenConnections() const -> int {
+  QMutexLocker locker(&this->m_mutex);
+  return static_cast<int>(this->m_connections.size());
+}
+
+void Model::ConnectionPool::closeIdleConnections(int minIdleTime) {
+  QMutexLocker locker(&this->m_mutex);
+
+  const auto threads = this->m_connections.keys();
+  for (auto *thread : threads) {
+    const auto &connection = this->m_connections[thread];
+    if (connection.useCount == 0 &&
+        connection.idleSince.elapsed() >= minIdleTime) {
+      this->dropConnection(thread);
+    }
+  }
+}
+
+void Model::ConnectionPool::closeConnection(QThread *thread) {
+  Q_ASSERT(thread == QThread::currentThread());
+
+  auto connection = this->m_connections.contains(thread)
+                        ? this->m_connections.take(thread)
+                        : this->m_stale.take(thread);
+  disconnect(connection.finished);
+
+  const auto name = connection.db.connectionName();
+  connection.db.close();
+  connection.db = QSqlDatabase();
+  QSqlDatabase::removeDatabase(name);
+
+  qDebug() << tr("Datenbankverbindung geschlossen : ") << name;
+
+  this->m_slotFree.wakeOne();
+}
+
+void Model::ConnectionPool::dropConnection(QThread *thread) {
+  if (thread == QThread::currentThread()) {
+    this->closeConnection(thread);
+    return;
+  }
+
+  auto connection = this->m_connections.take(thread);
+  connection.stale = true;
+  qDebug() << tr("Datenbankverbindung wird von ihrem Thread geschlossen : ")
+           << connection.db.connectionName();
+  this->m_stale.insert(thread, connection);
+
+  this->m_slotFree.wakeOne();
+}
+
+auto Model::ConnectionPool::closeOldestIdle() -> bool {
+  QThread *oldest = nullptr;
+  qint64 oldestIdle = -1;
+
+  for (auto it = this->m_connections.cbegin(); it != this->m_connections.cend();
+       ++it) {
+    if (it->useCount == 0 && it->idleSince.elapsed() > oldestIdle) {
+      oldest = it.key();
+      oldestIdle = it->idleSince.elapsed();
+    }
+  }
+
+  if (oldest == nullptr) {
+    return false;
+  }
+
+  this->dropConnection(oldest);
+  return true;
+}
+
+void Model::ConnectionPool::threadFinished(QThread *thread) {
+  QMutexLocker locker(&this->m_mutex);
+
+  while (this->m_connections.contains(thread) ||
+         this->m_stale.contains(thread)) {
+    this->closeConnection(thread);
+  }
+}
+
+Model::PooledConnection::PooledConnection(ConnectionPool *pool, int timeout)
+    : m_pool(pool) {
+  if (this->m_pool != nullptr) {
+    this->m_db = this->m_pool->acquire(timeout);
+    this->m_acquired = this->m_db.isValid();
+  }
+}
+
+Model::PooledConnection::~PooledConnection() {
+  // Drop the reference before the pool may close the connection
+  this->m_db = QSqlDatabase();
+
+  if (this->m_acquired) {
+    this->m_pool->release();
+  }
+}
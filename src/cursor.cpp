@@ -0,0 +1,150 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "jmbdemodels/cursor.h"
+
+#include <QDebug>
+#include <QSqlDriver>
+#include <QSqlError>
+#include <QSqlField>
+
+#include <atomic>
+
+#include "jmbdemodels/transaction.h"
+
+Model::Cursor::Cursor(const QSqlDatabase &db, const QString &sql,
+                      const QVariantList &binds, int fetchSize)
+    : m_db(db), m_query(db), m_fetchSize(qMax(0, fetchSize)) {
+  this->m_query.setForwardOnly(true);
+
+  if (this->m_fetchSize > 0 &&
+      this->m_db.driverName() == QLatin1String("QPSQL")) {
+    static std::atomic<quint64> counter{0};
+    this->m_cursorName = QStringLiteral("jmbde_cursor_%1").arg(++counter);
+
+    // A cursor without HOLD lives only inside a transaction. In the
+    // transaction of the caller it outlives the commit of the caller.
+    auto declare = QLatin1String(" NO SCROLL CURSOR FOR ");
+    if (Transaction::depth(this->m_db) > 0) {
+      declare = QLatin1String(" NO SCROLL CURSOR WITH HOLD FOR ");
+    } else {
+      this->m_transaction = std::make_unique<Transaction>(this->m_db);
+    }
+
+    if (!this->m_query.exec(QLatin1String("DECLARE ") + this->m_cursorName +
+                            declare + this->inlineBinds(sql, binds))) {
+      this->m_error = this->m_query.lastError().text();
+      this->m_cursorName.clear();
+      this->close();
+      return;
+    }
+
+    // The first next() fetches the first block
+    this->m_fetched = this->m_fetchSize;
+    return;
+  }
+
+  if (!this->m_query.prepare(sql)) {
+    this->m_error = this->m_query.lastError().text();
+    this->m_closed = true;
+    return;
+  }
+  for (int i = 0; i < binds.size(); ++i) {
+    this->m_query.bindValue(i, binds.at(i));
+  }
+  if (!this->m_query.exec()) {
+    this->m_error = this->m_query.lastError().text();
+    this->m_closed = true;
+  }
+}
+
+Model::Cursor::~Cursor() { this->close(); }
+
+auto Model::Cursor::next() -> bool {
+  if (this->m_closed) {
+    return false;
+  }
+
+  if (this->m_cursorName.isEmpty()) {
+    if (!this->m_query.next()) {
+      return false;
+    }
+    ++this->m_rows;
+    return true;
+  }
+
+  while (!this->m_query.next()) {
+    // A short block was the last one
+    if (this->m_fetched < this->m_fetchSize || !this->fetch()) {
+      return false;
+    }
+  }
+  ++this->m_fetched;
+  ++this->m_rows;
+  return true;
+}
+
+void Model::Cursor::close() {
+  if (this->m_closed) {
+    return;
+  }
+  this->m_closed = true;
+  this->m_query.finish();
+
+  if (!this->m_cursorName.isEmpty()) {
+    QSqlQuery query(this->m_db);
+    if (!query.exec(QLatin1String("CLOSE ") + this->m_cursorName)) {
+      qWarning() << tr("Fehler beim Schließen des Cursors ")
+                 << query.lastError().text();
+    }
+  }
+  if (this->m_transaction) {
+    this->m_transaction->commit();
+    this->m_transaction.reset();
+  }
+}
+
+auto Model::Cursor::fetch() -> bool {
+  this->m_fetched = 0;
+  if (!this->m_query.exec(QStringLiteral("FETCH FORWARD %1 FROM %2")
+                              .arg(this->m_fetchSize)
+                              .arg(this->m_cursorName))) {
+    this->m_error = this->m_query.lastError().text();
+    return false;
+  }
+  return true;
+}
+
+auto Model::Cursor::inlineBinds(const QString &sql,
+                                const QVariantList &binds) const -> QString {
+  const auto *driver = this->m_db.driver();
+
+  QString result;
+  result.reserve(sql.size());
+  int bind = 0;
+  bool quoted = false;
+
+  for (const auto c : sql) {
+    if (c == QLatin1Char('\'')) {
+      quoted = !quoted;
+    }
+    if (c != QLatin1Char('?') || quoted || bind >= binds.size()) {
+      result += c;
+      continue;
+    }
+
+    const auto &value = binds.at(bind++);
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    QSqlField field(QString(), value.metaType());
+#else
+    QSqlField field(QString(), value.type());
+#endif
+    field.setValue(value);
+    result += driver->formatValue(field);
+  }
+  return result;
+}
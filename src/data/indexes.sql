@@ -0,0 +1,144 @@
+-- Indexes for the foreign keys and the lookup columns.
+-- Every statement is idempotent, so the script also upgrades
+-- existing databases. It is migration 0001, each index is built on
+-- its own:
+-- migrate: online
+
+CREATE INDEX IF NOT EXISTS idx_account_system_data_id ON account (system_data_id);
+CREATE INDEX IF NOT EXISTS idx_account_user_name ON account (user_name);
+
+CREATE INDEX IF NOT EXISTS idx_chip_card_chip_card_door_id ON chip_card (chip_card_door_id);
+CREATE INDEX IF NOT EXISTS idx_chip_card_chip_card_profile_id ON chip_card (chip_card_profile_id);
+CREATE INDEX IF NOT EXISTS idx_chip_card_employee_id ON chip_card (employee_id);
+CREATE INDEX IF NOT EXISTS idx_chip_card_number ON chip_card (number);
+
+CREATE INDEX IF NOT EXISTS idx_chip_card_door_place_id ON chip_card_door (place_id);
+CREATE INDEX IF NOT EXISTS idx_chip_card_door_department_id ON chip_card_door (department_id);
+CREATE INDEX IF NOT EXISTS idx_chip_card_door_employee_id ON chip_card_door (employee_id);
+CREATE INDEX IF NOT EXISTS idx_chip_card_door_number ON chip_card_door (number);
+
+CREATE INDEX IF NOT EXISTS idx_chip_card_profile_chip_card_door_id ON chip_card_profile (chip_card_door_id);
+CREATE INDEX IF NOT EXISTS idx_chip_card_profile_employee_id ON chip_card_profile (employee_id);
+CREATE INDEX IF NOT EXISTS idx_chip_card_profile_number ON chip_card_profile (number);
+
+CREATE INDEX IF NOT EXISTS idx_chip_card_profile_door_chip_card_profile_id_chip_card_door_id ON chip_card_profile_door (chip_card_profile_id, chip_card_door_id);
+CREATE INDEX IF NOT EXISTS idx_chip_card_profile_door_chip_card_door_id ON chip_card_profile_door (chip_card_door_id);
+
+CREATE INDEX IF NOT EXISTS idx_city_name_name ON city_name (name);
+
+CREATE INDEX IF NOT EXISTS idx_company_employee_id ON company (employee_id);
+CREATE INDEX IF NOT EXISTS idx_company_name ON company (name);
+
+CREATE INDEX IF NOT EXISTS idx_computer_device_name_id ON computer (device_name_id);
+CREATE INDEX IF NOT EXISTS idx_computer_device_type_id ON computer (device_type_id);
+CREATE INDEX IF NOT EXISTS idx_computer_employee_id ON computer (employee_id);
+CREATE INDEX IF NOT EXISTS idx_computer_place_id ON computer (place_id);
+CREATE INDEX IF NOT EXISTS idx_computer_department_id ON computer (department_id);
+CREATE INDEX IF NOT EXISTS idx_computer_manufacturer_id ON computer (manufacturer_id);
+CREATE INDEX IF NOT EXISTS idx_computer_inventory_id ON computer (inventory_id);
+CREATE INDEX IF NOT EXISTS idx_computer_processor_id ON computer (processor_id);
+CREATE INDEX IF NOT EXISTS idx_computer_os_id ON computer (os_id);
+CREATE INDEX IF NOT EXISTS idx_computer_computer_software_id ON computer (computer_software_id);
+CREATE INDEX IF NOT EXISTS idx_computer_printer_id ON computer (printer_id);
+CREATE INDEX IF NOT EXISTS idx_computer_serial_number ON computer (serial_number);
+CREATE INDEX IF NOT EXISTS idx_computer_network_name ON computer (network_name);
+
+CREATE INDEX IF NOT EXISTS idx_computer_software_computer_id_software_id ON computer_software (computer_id, software_id);
+CREATE INDEX IF NOT EXISTS idx_computer_software_software_id ON computer_software (software_id);
+
+CREATE INDEX IF NOT EXISTS idx_department_printer_id ON department (printer_id);
+CREATE INDEX IF NOT EXISTS idx_department_fax_id ON department (fax_id);
+CREATE INDEX IF NOT EXISTS idx_department_name ON department (name);
+
+CREATE INDEX IF NOT EXISTS idx_device_name_name ON device_name (name);
+
+CREATE INDEX IF NOT EXISTS idx_device_type_name ON device_type (name);
+
+CREATE INDEX IF NOT EXISTS idx_document_name ON document (name);
+
+CREATE INDEX IF NOT EXISTS idx_employee_account_employe_id ON employee_account (employe_id);
+CREATE INDEX IF NOT EXISTS idx_employee_account_account_id ON employee_account (account_id);
+
+CREATE INDEX IF NOT EXISTS idx_employee_title_id ON employee (title_id);
+CREATE INDEX IF NOT EXISTS idx_employee_zip_city_id ON employee (zip_city_id);
+CREATE INDEX IF NOT EXISTS idx_employee_department_id ON employee (department_id);
+CREATE INDEX IF NOT EXISTS idx_employee_function_id ON employee (function_id);
+CREATE INDEX IF NOT EXISTS idx_employee_computer_id ON employee (computer_id);
+CREATE INDEX IF NOT EXISTS idx_employee_printer_id ON employee (printer_id);
+CREATE INDEX IF NOT EXISTS idx_employee_phone_id ON employee (phone_id);
+CREATE INDEX IF NOT EXISTS idx_employee_mobile_id ON employee (mobile_id);
+CREATE INDEX IF NOT EXISTS idx_employee_fax_id ON employee (fax_id);
+CREATE INDEX IF NOT EXISTS idx_employee_employee_account_id ON employee (employee_account_id);
+CREATE INDEX IF NOT EXISTS idx_employee_employee_document_id ON employee (employee_document_id);
+CREATE INDEX IF NOT EXISTS idx_employee_chip_card_id ON employee (chip_card_id);
+CREATE INDEX IF NOT EXISTS idx_employee_last_name_first_name ON employee (last_name, first_name);
+CREATE INDEX IF NOT EXISTS idx_employee_employee_nr ON employee (employee_nr);
+
+CREATE INDEX IF NOT EXISTS idx_employee_document_employe_id ON employee_document (employe_id);
+CREATE INDEX IF NOT EXISTS idx_employee_document_document_id ON employee_document (document_id);
+
+CREATE INDEX IF NOT EXISTS idx_fax_device_name_id ON fax (device_name_id);
+CREATE INDEX IF NOT EXISTS idx_fax_device_type_id ON fax (device_type_id);
+CREATE INDEX IF NOT EXISTS idx_fax_employee_id ON fax (employee_id);
+CREATE INDEX IF NOT EXISTS idx_fax_place_id ON fax (place_id);
+CREATE INDEX IF NOT EXISTS idx_fax_department_id ON fax (department_id);
+CREATE INDEX IF NOT EXISTS idx_fax_manufacturer_id ON fax (manufacturer_id);
+CREATE INDEX IF NOT EXISTS idx_fax_inventory_id ON fax (inventory_id);
+CREATE INDEX IF NOT EXISTS idx_fax_serial_number ON fax (serial_number);
+CREATE INDEX IF NOT EXISTS idx_fax_number ON fax (number);
+
+CREATE INDEX IF NOT EXISTS idx_function_name ON function (name);
+
+CREATE INDEX IF NOT EXISTS idx_inventory_number ON inventory (number);
+
+CREATE INDEX IF NOT EXISTS idx_manufacturer_zip_city_id ON manufacturer (zip_city_id);
+CREATE INDEX IF NOT EXISTS idx_manufacturer_name ON manufacturer (name);
+
+CREATE INDEX IF NOT EXISTS idx_mobile_device_name_id ON mobile (device_name_id);
+CREATE INDEX IF NOT EXISTS idx_mobile_device_type_id ON mobile (device_type_id);
+CREATE INDEX IF NOT EXISTS idx_mobile_employe_id ON mobile (employe_id);
+CREATE INDEX IF NOT EXISTS idx_mobile_place_id ON mobile (place_id);
+CREATE INDEX IF NOT EXISTS idx_mobile_department_id ON mobile (department_id);
+CREATE INDEX IF NOT EXISTS idx_mobile_manufacturer_id ON mobile (manufacturer_id);
+CREATE INDEX IF NOT EXISTS idx_mobile_inventory_id ON mobile (inventory_id);
+CREATE INDEX IF NOT EXISTS idx_mobile_serial_number ON mobile (serial_number);
+CREATE INDEX IF NOT EXISTS idx_mobile_number ON mobile (number);
+
+CREATE INDEX IF NOT EXISTS idx_os_name ON os (name);
+
+CREATE INDEX IF NOT EXISTS idx_phone_device_name_id ON phone (device_name_id);
+CREATE INDEX IF NOT EXISTS idx_phone_device_type_id ON phone (device_type_id);
+CREATE INDEX IF NOT EXISTS idx_phone_employe_id ON phone (employe_id);
+CREATE INDEX IF NOT EXISTS idx_phone_place_id ON phone (place_id);
+CREATE INDEX IF NOT EXISTS idx_phone_department_id ON phone (department_id);
+CREATE INDEX IF NOT EXISTS idx_phone_manufacturer_id ON phone (manufacturer_id);
+CREATE INDEX IF NOT EXISTS idx_phone_inventory_id ON phone (inventory_id);
+CREATE INDEX IF NOT EXISTS idx_phone_serial_number ON phone (serial_number);
+CREATE INDEX IF NOT EXISTS idx_phone_number ON phone (number);
+
+CREATE INDEX IF NOT EXISTS idx_place_name ON place (name);
+
+CREATE INDEX IF NOT EXISTS idx_printer_device_name_id ON printer (device_name_id);
+CREATE INDEX IF NOT EXISTS idx_printer_device_type_id ON printer (device_type_id);
+CREATE INDEX IF NOT EXISTS idx_printer_employe_id ON printer (employe_id);
+CREATE INDEX IF NOT EXISTS idx_printer_place_id ON printer (place_id);
+CREATE INDEX IF NOT EXISTS idx_printer_department_id ON printer (department_id);
+CREATE INDEX IF NOT EXISTS idx_printer_manufacturer_id ON printer (manufacturer_id);
+CREATE INDEX IF NOT EXISTS idx_printer_inventory_id ON printer (inventory_id);
+CREATE INDEX IF NOT EXISTS idx_printer_computer_id ON printer (computer_id);
+CREATE INDEX IF NOT EXISTS idx_printer_serial_number ON printer (serial_number);
+CREATE INDEX IF NOT EXISTS idx_printer_network_name ON printer (network_name);
+
+CREATE INDEX IF NOT EXISTS idx_processor_name ON processor (name);
+
+CREATE INDEX IF NOT EXISTS idx_software_name ON software (name);
+
+CREATE INDEX IF NOT EXISTS idx_system_data_company_id ON system_data (company_id);
+CREATE INDEX IF NOT EXISTS idx_system_data_name ON system_data (name);
+
+CREATE INDEX IF NOT EXISTS idx_title_name ON title (name);
+
+CREATE INDEX IF NOT EXISTS idx_zip_city_zip_code_id_city_id ON zip_city (zip_code_id, city_id);
+CREATE INDEX IF NOT EXISTS idx_zip_city_city_id ON zip_city (city_id);
+
+CREATE INDEX IF NOT EXISTS idx_zip_code_code ON zip_code (code);
@@ -86,7 +86,7 @@ CREATE TABLE computer_software (
 );
 CREATE TABLE department (
     department_id INTEGER PRIMARY KEY,
-    name (50),
+    name VARCHAR(50),
     priority INTEGER,
     printer_id INTEGER,
     fax_id INTEGER,
@@ -155,7 +155,7 @@ CREATE TABLE employee_document (
 CREATE TABLE fax (
     fax_id INTEGER PRIMARY KEY,
     device_name_id INTEGER,
-    serial_number (20),
+    serial_number VARCHAR(20),
     number VARCHAR(50),
     pin VARCHAR(10),
     active BOOLEAN,
@@ -311,4 +311,4 @@ CREATE TABLE database_version (
 );
 --First insertions
 INSERT INTO database_version
-VALUES(1, "0", "90", "0");
+VALUES(1, '0', '90', '0');
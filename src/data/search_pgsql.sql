@@ -0,0 +1,97 @@
+-- Full text search over employees, devices, software and documents.
+-- The id of an entry is the primary key of the row * 8 + the kind:
+-- 1 employee, 2 computer, 3 printer, 4 software, 5 document.
+-- The triggers keep the index up to date row by row.
+
+CREATE TABLE IF NOT EXISTS search_index (
+    id BIGINT PRIMARY KEY,
+    title TEXT,
+    body TEXT,
+    document TSVECTOR GENERATED ALWAYS AS (
+        setweight(to_tsvector('simple', coalesce(title, '')), 'A') ||
+        setweight(to_tsvector('simple', coalesce(body, '')), 'B')) STORED
+);
+CREATE INDEX IF NOT EXISTS idx_search_index_document ON search_index USING GIN (document);
+
+CREATE OR REPLACE FUNCTION search_index_employee() RETURNS trigger AS $$
+BEGIN
+    IF TG_OP <> 'INSERT' THEN
+        DELETE FROM search_index WHERE id = OLD.employee_id * 8 + 1;
+    END IF;
+    IF TG_OP <> 'DELETE' THEN
+        INSERT INTO search_index (id, title, body)
+        VALUES (NEW.employee_id * 8 + 1,
+                concat_ws(' ', NEW.first_name, NEW.last_name),
+                concat_ws(' ', NEW.business_mail_address, NEW.home_mail_address));
+    END IF;
+    RETURN NULL;
+END;
+$$ LANGUAGE plpgsql;
+DROP TRIGGER IF EXISTS search_index_employee ON employee;
+CREATE TRIGGER search_index_employee AFTER INSERT OR UPDATE OR DELETE ON employee
+    FOR EACH ROW EXECUTE FUNCTION search_index_employee();
+
+CREATE OR REPLACE FUNCTION search_index_computer() RETURNS trigger AS $$
+BEGIN
+    IF TG_OP <> 'INSERT' THEN
+        DELETE FROM search_index WHERE id = OLD.computer_id * 8 + 2;
+    END IF;
+    IF TG_OP <> 'DELETE' THEN
+        INSERT INTO search_index (id, title, body)
+        VALUES (NEW.computer_id * 8 + 2, NEW.network_name,
+                concat_ws(' ', NEW.serial_number, NEW.service_tag));
+    END IF;
+    RETURN NULL;
+END;
+$$ LANGUAGE plpgsql;
+DROP TRIGGER IF EXISTS search_index_computer ON computer;
+CREATE TRIGGER search_index_computer AFTER INSERT OR UPDATE OR DELETE ON computer
+    FOR EACH ROW EXECUTE FUNCTION search_index_computer();
+
+CREATE OR REPLACE FUNCTION search_index_printer() RETURNS trigger AS $$
+BEGIN
+    IF TG_OP <> 'INSERT' THEN
+        DELETE FROM search_index WHERE id = OLD.printer_id * 8 + 3;
+    END IF;
+    IF TG_OP <> 'DELETE' THEN
+        INSERT INTO search_index (id, title, body)
+        VALUES (NEW.printer_id * 8 + 3, NEW.network_name, NEW.serial_number);
+    END IF;
+    RETURN NULL;
+END;
+$$ LANGUAGE plpgsql;
+DROP TRIGGER IF EXISTS search_index_printer ON printer;
+CREATE TRIGGER search_index_printer AFTER INSERT OR UPDATE OR DELETE ON printer
+    FOR EACH ROW EXECUTE FUNCTION search_index_printer();
+
+CREATE OR REPLACE FUNCTION search_index_software() RETURNS trigger AS $$
+BEGIN
+    IF TG_OP <> 'INSERT' THEN
+        DELETE FROM search_index WHERE id = OLD.software_id * 8 + 4;
+    END IF;
+    IF TG_OP <> 'DELETE' THEN
+        INSERT INTO search_index (id, title, body)
+        VALUES (NEW.software_id * 8 + 4, NEW.name, NEW.version);
+    END IF;
+    RETURN NULL;
+END;
+$$ LANGUAGE plpgsql;
+DROP TRIGGER IF EXISTS search_index_software ON software;
+CREATE TRIGGER search_index_software AFTER INSERT OR UPDATE OR DELETE ON software
+    FOR EACH ROW EXECUTE FUNCTION search_index_software();
+
+CREATE OR REPLACE FUNCTION search_index_document() RETURNS trigger AS $$
+BEGIN
+    IF TG_OP <> 'INSERT' THEN
+        DELETE FROM search_index WHERE id = OLD.document_id * 8 + 5;
+    END IF;
+    IF TG_OP <> 'DELETE' THEN
+        INSERT INTO search_index (id, title, body)
+        VALUES (NEW.document_id * 8 + 5, NEW.name, NULL);
+    END IF;
+    RETURN NULL;
+END;
+$$ LANGUAGE plpgsql;
+DROP TRIGGER IF EXISTS search_index_document ON document;
+CREATE TRIGGER search_index_document AFTER INSERT OR UPDATE OR DELETE ON document
+    FOR EACH ROW EXECUTE FUNCTION search_index_document();
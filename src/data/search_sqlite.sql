@@ -0,0 +1,101 @@
+-- Full text search over employees, devices, software and documents.
+-- The rowid of an entry is the primary key of the row * 8 + the kind:
+-- 1 employee, 2 computer, 3 printer, 4 software, 5 document.
+-- The triggers keep the index up to date row by row.
+
+CREATE VIRTUAL TABLE IF NOT EXISTS search_index USING fts5 (
+    title,
+    body,
+    tokenize = 'unicode61 remove_diacritics 2',
+    prefix = '1 2 3'
+);
+
+CREATE TRIGGER IF NOT EXISTS search_employee_insert AFTER INSERT ON employee
+BEGIN
+    INSERT INTO search_index (rowid, title, body)
+    VALUES (NEW.employee_id * 8 + 1,
+            coalesce(NEW.first_name, '') || ' ' || coalesce(NEW.last_name, ''),
+            coalesce(NEW.business_mail_address, '') || ' ' || coalesce(NEW.home_mail_address, ''));
+END;
+CREATE TRIGGER IF NOT EXISTS search_employee_update AFTER UPDATE OF employee_id, first_name, last_name, business_mail_address, home_mail_address ON employee
+BEGIN
+    DELETE FROM search_index WHERE rowid = OLD.employee_id * 8 + 1;
+    INSERT INTO search_index (rowid, title, body)
+    VALUES (NEW.employee_id * 8 + 1,
+            coalesce(NEW.first_name, '') || ' ' || coalesce(NEW.last_name, ''),
+            coalesce(NEW.business_mail_address, '') || ' ' || coalesce(NEW.home_mail_address, ''));
+END;
+CREATE TRIGGER IF NOT EXISTS search_employee_delete AFTER DELETE ON employee
+BEGIN
+    DELETE FROM search_index WHERE rowid = OLD.employee_id * 8 + 1;
+END;
+
+CREATE TRIGGER IF NOT EXISTS search_computer_insert AFTER INSERT ON computer
+BEGIN
+    INSERT INTO search_index (rowid, title, body)
+    VALUES (NEW.computer_id * 8 + 2, coalesce(NEW.network_name, ''),
+            coalesce(NEW.serial_number, '') || ' ' || coalesce(NEW.service_tag, ''));
+END;
+CREATE TRIGGER IF NOT EXISTS search_computer_update AFTER UPDATE OF computer_id, network_name, serial_number, service_tag ON computer
+BEGIN
+    DELETE FROM search_index WHERE rowid = OLD.computer_id * 8 + 2;
+    INSERT INTO search_index (rowid, title, body)
+    VALUES (NEW.computer_id * 8 + 2, coalesce(NEW.network_name, ''),
+            coalesce(NEW.serial_number, '') || ' ' || coalesce(NEW.service_tag, ''));
+END;
+CREATE TRIGGER IF NOT EXISTS search_computer_delete AFTER DELETE ON computer
+BEGIN
+    DELETE FROM search_index WHERE rowid = OLD.computer_id * 8 + 2;
+END;
+
+CREATE TRIGGER IF NOT EXISTS search_printer_insert AFTER INSERT ON printer
+BEGIN
+    INSERT INTO search_index (rowid, title, body)
+    VALUES (NEW.printer_id * 8 + 3, coalesce(NEW.network_name, ''),
+            coalesce(NEW.serial_number, ''));
+END;
+CREATE TRIGGER IF NOT EXISTS search_printer_update AFTER UPDATE OF printer_id, network_name, serial_number ON printer
+BEGIN
+    DELETE FROM search_index WHERE rowid = OLD.printer_id * 8 + 3;
+    INSERT INTO search_index (rowid, title, body)
+    VALUES (NEW.printer_id * 8 + 3, coalesce(NEW.network_name, ''),
+            coalesce(NEW.serial_number, ''));
+END;
+CREATE TRIGGER IF NOT EXISTS search_printer_delete AFTER DELETE ON printer
+BEGIN
+    DELETE FROM search_index WHERE rowid = OLD.printer_id * 8 + 3;
+END;
+
+CREATE TRIGGER IF NOT EXISTS search_software_insert AFTER INSERT ON software
+BEGIN
+    INSERT INTO search_index (rowid, title, body)
+    VALUES (NEW.software_id * 8 + 4, coalesce(NEW.name, ''),
+            coalesce(NEW.version, ''));
+END;
+CREATE TRIGGER IF NOT EXISTS search_software_update AFTER UPDATE OF software_id, name, version ON software
+BEGIN
+    DELETE FROM search_index WHERE rowid = OLD.software_id * 8 + 4;
+    INSERT INTO search_index (rowid, title, body)
+    VALUES (NEW.software_id * 8 + 4, coalesce(NEW.name, ''),
+            coalesce(NEW.version, ''));
+END;
+CREATE TRIGGER IF NOT EXISTS search_software_delete AFTER DELETE ON software
+BEGIN
+    DELETE FROM search_index WHERE rowid = OLD.software_id * 8 + 4;
+END;
+
+CREATE TRIGGER IF NOT EXISTS search_document_insert AFTER INSERT ON document
+BEGIN
+    INSERT INTO search_index (rowid, title, body)
+    VALUES (NEW.document_id * 8 + 5, coalesce(NEW.name, ''), '');
+END;
+CREATE TRIGGER IF NOT EXISTS search_document_update AFTER UPDATE OF document_id, name ON document
+BEGIN
+    DELETE FROM search_index WHERE rowid = OLD.document_id * 8 + 5;
+    INSERT INTO search_index (rowid, title, body)
+    VALUES (NEW.document_id * 8 + 5, coalesce(NEW.name, ''), '');
+END;
+CREATE TRIGGER IF NOT EXISTS search_document_delete AFTER DELETE ON document
+BEGIN
+    DELETE FROM search_index WHERE rowid = OLD.document_id * 8 + 5;
+END;
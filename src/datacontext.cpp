@@ -7,6 +7,53 @@
 
 #include "jmbdemodels/datacontext.h"
 
+#include <QSet>
+#include <QtConcurrent>
+
+#include <algorithm>
+
+#include "jmbdemodels/changenotifier.h"
+#include "jmbdemodels/migrator.h"
+#include "jmbdemodels/schema.h"
+#include "jmbdemodels/searchindex.h"
+#include "jmbdemodels/transaction.h"
+
+/*!
+    \brief Register the SQL scripts of res.qrc; a static library must do it
+           itself, outside of any namespace
+ */
+static auto initResources() -> bool {
+  Q_INIT_RESOURCE(res);
+  return true;
+}
+
+namespace {
+/*!
+    \brief Guards the registry of the shared DataContexts
+ */
+auto sharedContextsMutex() -> QMutex & {
+  static QMutex mutex;
+  return mutex;
+}
+
+/*!
+    \brief The registry of the shared DataContexts, one per database name
+ */
+auto sharedContexts() -> QHash<QString, QWeakPointer<Model::DataContext>> & {
+  static QHash<QString, QWeakPointer<Model::DataContext>> contexts;
+  return contexts;
+}
+
+/*!
+    \brief A change tracking timestamp; SQLite keeps them as ISO text
+ */
+auto toTimestamp(const QVariant &value) -> QDateTime {
+  return value.userType() == QMetaType::QString
+             ? QDateTime::fromString(value.toString(), Qt::ISODateWithMs)
+             : value.toDateTime();
+}
+} // namespace
+
 Model::DataContext::DataContext(QObject *parent)
     : QObject(parent), m_Name(QApplication::applicationName()),
       m_dbType(DBTypes::SQLITE) {
@@ -56,11 +103,33 @@ Model::DataContext::DataContext(QObject *parent, const QString &name,
 
 Model::DataContext::~DataContext() {
   // this->m_db.close();
+  this->m_worker.waitForDone();
+  delete this->m_notifier;
 
   qDebug() << tr("Datenbank geschlossen.");
 }
 
+auto Model::DataContext::shared(const QString &name)
+    -> QSharedPointer<DataContext> {
+  const auto key = name.isEmpty() ? QApplication::applicationName() : name;
+
+  QMutexLocker locker(&sharedContextsMutex());
+  auto &contexts = sharedContexts();
+
+  auto context = contexts.value(key).toStrongRef();
+  if (context.isNull()) {
+    qDebug() << tr("Erzeuge gemeinsamen Datenbank Kontext: ") << key;
+    context = QSharedPointer<DataContext>(new DataContext(nullptr, key));
+    contexts.insert(key, context.toWeakRef());
+  }
+
+  return context;
+}
+
 void Model::DataContext::init() {
+  static const auto resources = initResources();
+  Q_UNUSED(resources)
+
   if (m_dbType == DBTypes::SQLITE) {
     this->setDatabaseConnection();
 
@@ -87,15 +156,55 @@ void Model::DataContext::init() {
     qInfo() << tr("Öffne PostgreSQL Datenbank: ") << this->m_Name
             << tr(" auf dem Server ") << this->m_dbHostName;
 
-    m_db = QSqlDatabase::addDatabase(QLatin1String("QPSQL"));
+    m_db = QSqlDatabase::addDatabase(QLatin1String("QPSQL"), this->m_Name);
     m_db.setHostName(this->m_dbHostName);
+    m_db.setDatabaseName(this->m_Name);
+    m_db.setUserName(this->m_dbUserName);
+    m_db.setPassword(this->m_dbPassWord);
+    if (this->m_dbPort > 0) {
+      m_db.setPort(this->m_dbPort);
+    }
+    if (!m_db.open()) {
+      qCritical() << tr("Fehler beim öffnen der Datenbank : ")
+                  << m_db.lastError().text() << this->m_Name;
+    }
+  }
+
+  // Databases from older versions get the new schema, on every driver
+  if (this->m_db.isOpen()) {
+    Migrator(this->m_db).migrate();
+    SearchIndex(this->m_db).ensure();
+    this->createChangeTracking();
+  }
+
+  this->m_connectionPool = new ConnectionPool(this->m_db, this);
+  if (m_dbType == DBTypes::SQLITE) {
+    this->m_connectionPool->setInitStatements(m_pragmaProfile.statements());
   }
+
+  // One dedicated thread, that keeps its pooled connection
+  this->m_worker.setMaxThreadCount(1);
+  this->m_worker.setExpiryTimeout(-1);
 }
 
 void Model::DataContext::prepareDB() const {
-  QSqlQuery query(this->m_db);
+  // Tables and indexes in one transaction, the scripts join it
+  Transaction transaction(this->m_db);
+
+  if (this->runScript(QLatin1String(":/data/script.sql")) &&
+      this->runScript(QLatin1String(":/data/indexes.sql")) &&
+      (!transaction.isActive() || transaction.commit())) {
+    qDebug() << tr("Datenbank erfolgreich erzeugt");
+    return;
+  }
 
-  QFile file(QLatin1String(":/data/script.sql"));
+  qCritical() << tr("Kritischer Fehler bei der Initialisierung der Datenbank.")
+              << this->m_db.lastError().text() << transaction.lastError();
+  transaction.rollback();
+}
+
+auto Model::DataContext::runScript(const QString &fileName) const -> bool {
+  QFile file(fileName);
 
   if (!file.exists()) {
     qCritical()
@@ -103,7 +212,7 @@ void Model::DataContext::prepareDB() const {
         << tr("Die Datei '") << file.fileName()
         << tr("' zum initialisieren der Datenbank ")
         << tr(" und zum erzeugen der Tabellen konnten nicht gefunden werden.");
-    return;
+    return false;
   }
 
   if (!file.open(QIODevice::ReadOnly)) {
@@ -112,127 +221,198 @@ void Model::DataContext::prepareDB() const {
         << tr("Die Datei '") << file.fileName()
         << tr(" zum initialisieren der Datenbank ")
         << tr("kann nicht geöffnet werden.");
+    return false;
   }
 
-  QString line;
-  QByteArray readLine;
-  QString cleanedLine;
-  QStringList strings;
-
-  while (!file.atEnd()) {
-    bool hasText = false;
-    line = QLatin1String("");
-    strings.clear();
-
-    while (!hasText) {
-      readLine = file.readLine();
-      cleanedLine = QLatin1String(readLine.trimmed());
-      strings = cleanedLine.split(QLatin1String("--"));
-      cleanedLine = strings.at(0);
-      if (!cleanedLine.startsWith(QLatin1String("--")) &&
-          !cleanedLine.startsWith(QLatin1String("DROP")) &&
-          !cleanedLine.isEmpty()) {
-        line += cleanedLine;
-      }
-      if (cleanedLine.endsWith(QLatin1String(";"))) {
-        break;
-      }
-      if (cleanedLine.startsWith(QLatin1String("COMMIT"))) {
-        hasText = true;
-      }
+  const auto statements = splitStatements(QString::fromUtf8(file.readAll()));
+  file.close();
+
+  // The script runs in one transaction of its own, or joins the
+  // transaction of the caller
+  static const QRegularExpression transactionControl(
+      QStringLiteral("^(BEGIN|COMMIT|END)(\\s+TRANSACTION)?$"),
+      QRegularExpression::CaseInsensitiveOption);
+
+  Transaction transaction(this->m_db);
+
+  QSqlQuery query(this->m_db);
+  for (const auto &statement : statements) {
+    if (transactionControl.match(statement).hasMatch()) {
+      continue;
     }
-    if (!line.isEmpty()) {
-      if (!query.exec(line)) {
-        qCritical()
-            << tr("Fehler beim Lesen der Datei zur Datenbank Erzeugung: ")
-            << tr("Fehler in der Zeile <") << line
-            << "> : " << tr("Fehlermeldung: ") << query.lastQuery() << " : "
-            << query.lastError().text();
-      }
-    } else {
-      qCritical() << tr("Fehler beim Lesen der Datei zur Datenbank Erzeugung:")
-                  << tr("Fehler in der Zeile <") << line
-                  << "> : " << tr("Fehlermeldung: ") << query.lastQuery()
-                  << " : " << query.lastError().text();
+
+    if (!query.exec(statement)) {
+      qCritical() << tr("Fehler beim Lesen der Datei zur Datenbank Erzeugung: ")
+                  << file.fileName() << tr(" Fehler in der Anweisung <")
+                  << statement << "> : " << tr("Fehlermeldung: ")
+                  << query.lastError().text();
+      transaction.rollback();
+      return false;
     }
   }
-  file.close();
 
-  qDebug() << tr("Datenbank erfolgreich erzeugt");
+  return !transaction.isActive() || transaction.commit();
 }
 
-auto Model::DataContext::checkDBVersion(const QString &actualVersion,
-                                        const QString &actualRevision
-                                        /* const QString &actualBuild */) const
-    -> bool {
-  QString version;
-  QString revision;
-  QString build;
-  QDateTime lastUpdate;
-  bool retValue = false;
+auto Model::DataContext::splitStatements(const QString &script)
+    -> QStringList {
+  // $$ or $tag$ opens a dollar quoted string of PostgreSQL
+  static const QRegularExpression dollarTag(
+      QStringLiteral("\\G\\$([A-Za-z_][A-Za-z0-9_]*)?\\$"));
 
-  QString queryString(QLatin1String(
-      "SELECT version, revision, patch, last_update FROM database_version"));
-  QSqlQuery query(this->m_db);
+  QStringList statements;
+  QString current;
+  QStringList leadingWords;
+  bool isTrigger = false;
+  int blockDepth = 0;
 
-  qDebug() << tr("Prüfe Datenbank Version ");
+  const auto finishStatement = [&]() {
+    const auto statement = current.trimmed();
+    if (!statement.isEmpty()) {
+      statements.append(statement);
+    }
+    current.clear();
+    leadingWords.clear();
+    isTrigger = false;
+    blockDepth = 0;
+  };
 
-  query.exec(queryString);
+  const auto length = script.size();
+  int i = 0;
+  while (i < length) {
+    const QChar c = script.at(i);
+    const QChar next = i + 1 < length ? script.at(i + 1) : QChar();
 
-  qDebug() << tr("Datenbankabfrage ( %1 ) Rückgabe : %2")
-                  .arg(queryString, query.lastError().text());
+    // Comments are dropped
+    if (c == QLatin1Char('-') && next == QLatin1Char('-')) {
+      while (i < length && script.at(i) != QLatin1Char('\n')) {
+        ++i;
+      }
+      continue;
+    }
+    if (c == QLatin1Char('/') && next == QLatin1Char('*')) {
+      const auto end = script.indexOf(QLatin1String("*/"), i + 2);
+      i = end < 0 ? length : end + 2;
+      current += QLatin1Char(' ');
+      continue;
+    }
 
-  while (query.next()) {
-    version = query.value(0).toString();
-    qDebug() << "Version = " << version;
-    revision = query.value(1).toString();
-    build = query.value(2).toString();
-    lastUpdate = query.value(3).toDateTime();
-  }
+    // Strings and quoted names are copied as they are, a doubled quote
+    // is an escaped quote
+    if (c == QLatin1Char('\'') || c == QLatin1Char('"') ||
+        c == QLatin1Char('`') || c == QLatin1Char('[')) {
+      const QChar close = c == QLatin1Char('[') ? QLatin1Char(']') : c;
+      auto end = i + 1;
+      while (end < length) {
+        if (script.at(end) == close) {
+          if (close != QLatin1Char(']') && end + 1 < length &&
+              script.at(end + 1) == close) {
+            end += 2;
+            continue;
+          }
+          break;
+        }
+        ++end;
+      }
+      end = qMin(end + 1, length);
+      current += script.mid(i, end - i);
+      i = end;
+      continue;
+    }
+
+    if (c == QLatin1Char('$')) {
+      const auto match = dollarTag.match(script, i);
+      if (match.hasMatch()) {
+        const auto tag = match.captured(0);
+        auto end = script.indexOf(tag, i + tag.size());
+        end = end < 0 ? length : end + tag.size();
+        current += script.mid(i, end - i);
+        i = end;
+        continue;
+      }
+    }
 
-  if ((version == actualVersion) && (revision == actualRevision)) {
-    qDebug() << tr("Prüfe Datenbank Version : ") << version << "." << revision
-             << "." << build << tr(" von ") << lastUpdate.toString();
+    // The body of a SQLite trigger has semicolons between BEGIN and END
+    if (c.isLetter() || c == QLatin1Char('_')) {
+      auto end = i + 1;
+      while (end < length && (script.at(end).isLetterOrNumber() ||
+                              script.at(end) == QLatin1Char('_'))) {
+        ++end;
+      }
+      const auto word = script.mid(i, end - i);
+      const auto upperWord = word.toUpper();
 
-    retValue = true;
-  } else {
-    if (version < actualVersion) {
-      qCritical() << tr("Prüfe Datenbank Version : ")
-                  << tr("Datenbank zu alt. Version : ") << version << "  <> "
-                  << actualVersion << "dbVersion : " << revision
-                  << " <> dbRevision : " << actualRevision;
+      // CREATE [TEMP|TEMPORARY] TRIGGER
+      if (leadingWords.size() < 3) {
+        leadingWords.append(upperWord);
+        if (leadingWords.first() == QLatin1String("CREATE") &&
+            upperWord == QLatin1String("TRIGGER")) {
+          isTrigger = true;
+        }
+      }
+
+      if (isTrigger) {
+        if (upperWord == QLatin1String("BEGIN") ||
+            upperWord == QLatin1String("CASE")) {
+          ++blockDepth;
+        } else if (upperWord == QLatin1String("END") && blockDepth > 0) {
+          --blockDepth;
+        }
+      }
+
+      current += word;
+      i = end;
+      continue;
     }
 
-    if (revision < actualRevision) {
-      qCritical() << tr("Prüfe Datenbank Version : ")
-                  << tr("Datenbank zu alt. Version : ") << version << "  <> "
-                  << actualVersion << "dbVersion : " << revision
-                  << " <> dbRevision : " << actualRevision;
+    if (c == QLatin1Char(';') && blockDepth == 0) {
+      finishStatement();
+      ++i;
+      continue;
     }
+
+    current += c;
+    ++i;
   }
+  finishStatement();
 
-  return retValue;
+  return statements;
 }
 
 auto Model::DataContext::checkExistence(const QString &tableName,
                                         const QString &searchId,
                                         const QString &search) -> bool {
-  auto queryStr = QString(QLatin1String("SELECT %1 FROM %2 WHERE %3 = \"%4\""))
-                      .arg(searchId, tableName, searchId, search);
+  if (!isValidIdentifier(tableName) || !isValidIdentifier(searchId)) {
+    qWarning() << tr("Prüfe Datenbank Tabelle <") << tableName << "> auf "
+               << searchId << tr(" : Ungültiger Tabellen- oder Spaltenname");
+    return false;
+  }
 
-  auto query = this->getQuery(queryStr);
+  const auto cacheKey =
+      QLatin1String("EXISTS|") + tableName + QLatin1Char('|') + searchId;
+  const auto queryStr =
+      QString(QLatin1String("SELECT 1 FROM %1 WHERE %2 = ? LIMIT 1"))
+          .arg(tableName, searchId);
 
-  if (query.exec()) {
-    if (query.next()) {
-      return true;
-    }
+  auto *query =
+      this->m_statementCache.prepare(this->m_db, cacheKey, queryStr);
+  if (query == nullptr) {
+    return false;
+  }
+
+  query->bindValue(0, search);
+
+  bool found = false;
+  if (query->exec()) {
+    found = query->next();
   } else {
     qWarning() << tr("Prüfe Datenbank Tabelle <") << tableName << "> auf "
                << searchId << " == " << search
-               << ") : " << query.lastError().text();
+               << ") : " << query->lastError().text();
   }
+  query->finish();
 
-  return false;
+  return found;
 }
 
 auto Model::DataContext::insert(const QString &tableName,
@@ -248,42 +428,730 @@ auto Model::DataContext::insert(const QString &tableName,
     return false;
   }
 
+  if (!isValidIdentifier(tableName)) {
+    qCritical() << tr("Schwerer Fehler: ") << tr("Ungültiger Tabellenname: ")
+                << tableName;
+    return false;
+  }
+  for (auto it = insertData.cbegin(); it != insertData.cend(); ++it) {
+    if (!isValidIdentifier(it.key())) {
+      qCritical() << tr("Schwerer Fehler: ") << tr("Ungültiger Spaltenname: ")
+                  << it.key();
+      return false;
+    }
+  }
+
+  // QVariantMap keeps the keys sorted, so the same set of columns
+  // always gives the same statement
+  const QStringList fields = insertData.keys();
+  const QString columns = fields.join(QLatin1String(","));
+  const QString cacheKey =
+      QLatin1String("INSERT|") + tableName + QLatin1Char('|') + columns;
+
   QStringList strValues;
-  QStringList fields = insertData.keys();
-  QVariantList values = insertData.values();
-  int totalFields = fields.size();
+  const auto totalFields = fields.size();
   for (int i = 0; i < totalFields; ++i) {
     strValues.append(QLatin1String("?"));
   }
 
-  QString sqlQueryString =
+  const QString sqlQueryString =
       QLatin1String("INSERT INTO ") + tableName + QLatin1String(" (") +
-      QString(fields.join(QLatin1String(","))) + QLatin1String(") VALUES(") +
-      QString(strValues.join(QLatin1String(","))) + QLatin1String(")");
-  QSqlQuery query(this->m_db);
-  query.prepare(sqlQueryString);
+      columns + QLatin1String(") VALUES(") +
+      strValues.join(QLatin1String(",")) + QLatin1String(")");
+
+  auto *query =
+      this->m_statementCache.prepare(this->m_db, cacheKey, sqlQueryString);
+
+  if (query == nullptr) {
+    return false;
+  }
+
+  int k = 0;
+  for (auto it = insertData.cbegin(); it != insertData.cend(); ++it) {
+    query->bindValue(k++, it.value());
+  }
+
+  if (!query->exec()) {
+    qWarning() << tr("Fehler beim Einfügen in die Tabelle ") << tableName
+               << " : " << query->lastError().text();
+    return false;
+  }
+
+  return true;
+}
+
+auto Model::DataContext::insertBatch(const QString &tableName,
+                                     const QVector<QVariantMap> &rows,
+                                     int batchSize) const -> BatchResult {
+  BatchResult result;
+
+  if (tableName.isEmpty()) {
+    qCritical() << tr("Schwerer Fehler: ")
+                << tr("Der Tabellename <m_Name> ist leer!");
+    return result;
+  }
+
+  if (rows.isEmpty()) {
+    return result;
+  }
+
+  batchSize = qMax(1, batchSize);
+
+  // Rows with the same columns share one statement. A column missing in a
+  // row keeps its DEFAULT, a NULL of a wider column list would replace it.
+  // The keys of a QVariantMap are sorted, so a group shares its statement
+  // with insert().
+  QVector<QStringList> groupFields;
+  QVector<QVector<int>> groupRows;
+  QHash<QString, int> groupOf;
+  for (int row = 0; row < rows.size(); ++row) {
+    const auto keys = rows.at(row).keys();
+    const auto key = keys.join(QLatin1Char(','));
+    auto it = groupOf.constFind(key);
+    if (it == groupOf.cend()) {
+      it = groupOf.insert(key, static_cast<int>(groupFields.size()));
+      groupFields.append(keys);
+      groupRows.append({});
+    }
+    groupRows[it.value()].append(row);
+  }
+
+  for (int group = 0; group < groupFields.size(); ++group) {
+    this->insertGroup(tableName, rows, groupFields.at(group),
+                      groupRows.at(group), batchSize, result);
+  }
+
+  std::sort(result.failed.begin(), result.failed.end(),
+            [](const BatchResult::RowError &a, const BatchResult::RowError &b) {
+              return a.row < b.row;
+            });
+
+  qDebug() << tr("Tabelle ") << tableName << tr(" : ") << result.succeeded
+           << tr(" Zeilen eingefügt, ") << result.failed.size()
+           << tr(" Fehler");
+
+  return result;
+}
+
+void Model::DataContext::insertGroup(const QString &tableName,
+                                     const QVector<QVariantMap> &rows,
+                                     const QStringList &fields,
+                                     const QVector<int> &group, int batchSize,
+                                     BatchResult &result) const {
+  if (fields.isEmpty()) {
+    for (const auto row : group) {
+      result.failed.append({row, tr("Die Zeile enthält keine Spalten")});
+    }
+    return;
+  }
+
+  bool validNames = isValidIdentifier(tableName);
+  for (const auto &field : fields) {
+    validNames = validNames && isValidIdentifier(field);
+  }
+  if (!validNames) {
+    qCritical() << tr("Schwerer Fehler: ")
+                << tr("Ungültiger Tabellen- oder Spaltenname in ") << tableName
+                << fields;
+    for (const auto row : group) {
+      result.failed.append({row, tr("Ungültiger Tabellen- oder Spaltenname")});
+    }
+    return;
+  }
+
+  const QString columns = fields.join(QLatin1String(","));
+  const QString cacheKey =
+      QLatin1String("INSERT|") + tableName + QLatin1Char('|') + columns;
+
+  QStringList strValues;
+  const auto totalFields = fields.size();
+  for (int i = 0; i < totalFields; ++i) {
+    strValues.append(QLatin1String("?"));
+  }
+
+  const QString sqlQueryString =
+      QLatin1String("INSERT INTO ") + tableName + QLatin1String(" (") +
+      columns + QLatin1String(") VALUES(") +
+      strValues.join(QLatin1String(",")) + QLatin1String(")");
+
+  auto *query =
+      this->m_statementCache.prepare(this->m_db, cacheKey, sqlQueryString);
+
+  if (query == nullptr) {
+    for (const auto row : group) {
+      result.failed.append(
+          {row, tr("Die Abfrage kann nicht vorbereitet werden")});
+    }
+    return;
+  }
+
+  QSqlQuery savepoint(this->m_db);
+
+  for (int first = 0; first < group.size(); first += batchSize) {
+    const int last = qMin(first + batchSize, static_cast<int>(group.size()));
+
+    // Inside a transaction of the caller the batch is a savepoint, its
+    // commit releases the savepoint only
+    Transaction transaction(this->m_db);
+
+    QVector<QVariantList> columnValues(totalFields);
+    for (auto &values : columnValues) {
+      values.reserve(last - first);
+    }
+    for (int position = first; position < last; ++position) {
+      const auto &rowData = rows.at(group.at(position));
+      for (int i = 0; i < totalFields; ++i) {
+        columnValues[i].append(rowData.value(fields.at(i)));
+      }
+    }
+    for (int i = 0; i < totalFields; ++i) {
+      query->bindValue(i, columnValues.at(i));
+    }
+
+    if (query->execBatch()) {
+      if (!transaction.isActive() || transaction.commit()) {
+        result.succeeded += last - first;
+        continue;
+      }
+    } else {
+      qWarning() << tr("Fehler beim Einfügen in die Tabelle ") << tableName
+                 << " : " << query->lastError().text()
+                 << tr(" - schreibe die Zeilen einzeln");
+      transaction.rollback();
+    }
+
+    // Write the rows one by one; a savepoint per row keeps the good rows
+    // (PostgreSQL aborts the whole transaction on the first error)
+    Transaction retry(this->m_db);
+    QVector<int> written;
+    for (int position = first; position < last; ++position) {
+      const auto row = group.at(position);
+      const auto &rowData = rows.at(row);
+      for (int i = 0; i < totalFields; ++i) {
+        query->bindValue(i, rowData.value(fields.at(i)));
+      }
+
+      if (retry.isActive()) {
+        savepoint.exec(QStringLiteral("SAVEPOINT jmbde_batch_row"));
+      }
+
+      if (query->exec()) {
+        written.append(row);
+        if (retry.isActive()) {
+          savepoint.exec(QStringLiteral("RELEASE SAVEPOINT jmbde_batch_row"));
+        }
+      } else {
+        result.failed.append({row, query->lastError().text()});
+        if (retry.isActive()) {
+          savepoint.exec(
+              QStringLiteral("ROLLBACK TO SAVEPOINT jmbde_batch_row"));
+        }
+      }
+    }
+    if (retry.isActive() && !retry.commit()) {
+      for (const auto row : written) {
+        result.failed.append({row, retry.lastError()});
+      }
+      continue;
+    }
+    result.succeeded += static_cast<int>(written.size());
+  }
+
+  query->finish();
+}
+
+auto Model::DataContext::isValidIdentifier(const QString &name) -> bool {
+  static const QRegularExpression identifier(
+      QStringLiteral("^[A-Za-z_][A-Za-z0-9_]*$"));
+
+  return identifier.match(name).hasMatch();
+}
+
+auto Model::DataContext::prepareUpdate(const QString &tableName,
+                                       const QVariantMap &values,
+                                       const QVariantMap &keys) const
+    -> QSqlQuery * {
+  if (!isValidIdentifier(tableName)) {
+    qCritical() << tr("Schwerer Fehler: ") << tr("Ungültiger Tabellenname: ")
+                << tableName;
+    return nullptr;
+  }
+
+  if (values.isEmpty() || keys.isEmpty()) {
+    qCritical() << tr("Schwerer Fehler: ")
+                << tr("Es sind keine Daten oder Schlüssel für die "
+                      "Änderung vorhanden.");
+    return nullptr;
+  }
+
+  QStringList assignments;
+  for (auto it = values.cbegin(); it != values.cend(); ++it) {
+    if (!isValidIdentifier(it.key())) {
+      qCritical() << tr("Schwerer Fehler: ") << tr("Ungültiger Spaltenname: ")
+                  << it.key();
+      return nullptr;
+    }
+    assignments.append(it.key() + QLatin1String(" = ?"));
+  }
+
+  QStringList conditions;
+  for (auto it = keys.cbegin(); it != keys.cend(); ++it) {
+    if (!isValidIdentifier(it.key())) {
+      qCritical() << tr("Schwerer Fehler: ") << tr("Ungültiger Spaltenname: ")
+                  << it.key();
+      return nullptr;
+    }
+    conditions.append(it.key() + QLatin1String(" = ?"));
+  }
+
+  // QVariantMap keeps the keys sorted, so the same columns always give
+  // the same statement
+  const QString cacheKey = QLatin1String("UPDATE|") + tableName +
+                           QLatin1Char('|') + values.keys().join(QLatin1Char(',')) +
+                           QLatin1Char('|') + keys.keys().join(QLatin1Char(','));
+
+  const QString sqlQueryString =
+      QLatin1String("UPDATE ") + tableName + QLatin1String(" SET ") +
+      assignments.join(QLatin1String(", ")) + QLatin1String(" WHERE ") +
+      conditions.join(QLatin1String(" AND "));
+
+  auto *query =
+      this->m_statementCache.prepare(this->m_db, cacheKey, sqlQueryString);
+  if (query == nullptr) {
+    return nullptr;
+  }
 
   int k = 0;
-  for (const QVariant &value : values) {
-    query.bindValue(k++, value);
+  for (auto it = values.cbegin(); it != values.cend(); ++it) {
+    query->bindValue(k++, it.value());
+  }
+  for (auto it = keys.cbegin(); it != keys.cend(); ++it) {
+    query->bindValue(k++, it.value());
+  }
+
+  return query;
+}
+
+auto Model::DataContext::update(const QString &tableName,
+                                const QVariantMap &values,
+                                const QVariantMap &keys) const -> bool {
+  auto *query = this->prepareUpdate(tableName, values, keys);
+  if (query == nullptr) {
+    return false;
+  }
+
+  if (!query->exec()) {
+    qWarning() << tr("Fehler beim Ändern der Tabelle ") << tableName << " : "
+               << query->lastError().text();
+    return false;
+  }
+
+  return true;
+}
+
+auto Model::DataContext::updateBatch(
+    const QString &tableName,
+    const QVector<QPair<QVariantMap, QVariantMap>> &rows) const
+    -> BatchResult {
+  BatchResult result;
+
+  if (rows.isEmpty()) {
+    return result;
+  }
+
+  Transaction transaction(this->m_db);
+  QSqlQuery savepoint(this->m_db);
+  QVector<int> written;
+
+  for (int row = 0; row < rows.size(); ++row) {
+    const auto &entry = rows.at(row);
+
+    auto *query = this->prepareUpdate(tableName, entry.first, entry.second);
+    if (query == nullptr) {
+      result.failed.append({row, tr("Ungültige Änderung")});
+      continue;
+    }
+
+    // A savepoint per entry keeps the others, PostgreSQL would abort
+    // the whole transaction on the first error
+    if (transaction.isActive()) {
+      savepoint.exec(QStringLiteral("SAVEPOINT jmbde_batch_row"));
+    }
+
+    if (query->exec()) {
+      written.append(row);
+      if (transaction.isActive()) {
+        savepoint.exec(QStringLiteral("RELEASE SAVEPOINT jmbde_batch_row"));
+      }
+    } else {
+      result.failed.append({row, query->lastError().text()});
+      if (transaction.isActive()) {
+        savepoint.exec(QStringLiteral("ROLLBACK TO SAVEPOINT jmbde_batch_row"));
+      }
+    }
+  }
+
+  if (transaction.isActive() && !transaction.commit()) {
+    for (const auto row : written) {
+      result.failed.append({row, transaction.lastError()});
+    }
+    return result;
+  }
+
+  result.succeeded = static_cast<int>(written.size());
+
+  return result;
+}
+
+auto Model::DataContext::execAsync(const QString &sql,
+                                   const QVariantList &binds)
+    -> QFuture<ResultSet> {
+  auto *pool = this->m_connectionPool;
+
+  return QtConcurrent::run(&this->m_worker, [pool, sql, binds]() {
+    ResultSet resultSet;
+
+    PooledConnection connection(pool);
+    if (!connection.isValid()) {
+      resultSet.error = tr("Keine Datenbankverbindung für den Worker Thread");
+      return resultSet;
+    }
+
+    QSqlQuery query(connection.database());
+    query.setForwardOnly(true);
+
+    if (!query.prepare(sql)) {
+      resultSet.error = query.lastError().text();
+      return resultSet;
+    }
+
+    for (const auto &value : binds) {
+      query.addBindValue(value);
+    }
+
+    if (!query.exec()) {
+      resultSet.error = query.lastError().text();
+      qWarning() << tr("Fehler bei der Datenbankabfrage ( %1 ) : %2")
+                        .arg(sql, resultSet.error);
+      return resultSet;
+    }
+
+    resultSet.numRowsAffected = query.numRowsAffected();
+    resultSet.lastInsertId = query.lastInsertId();
+
+    if (query.isSelect()) {
+      const auto record = query.record();
+      const auto columnCount = record.count();
+      for (int i = 0; i < columnCount; ++i) {
+        resultSet.columns.append(record.fieldName(i));
+      }
+
+      while (query.next()) {
+        QVariantList row;
+        row.reserve(columnCount);
+        for (int i = 0; i < columnCount; ++i) {
+          row.append(query.value(i));
+        }
+        resultSet.rows.append(row);
+      }
+    }
+
+    return resultSet;
+  });
+}
+
+auto Model::DataContext::createChangeTracking() const -> bool {
+  auto db = this->m_db;
+  const bool postgres = db.driverName() == QLatin1String("QPSQL");
+
+  // The functions, tables, indexes and triggers that are there already. A
+  // DROP or CREATE of a trigger locks its table, only the missing ones are
+  // created.
+  QSet<QString> existing;
+  QSqlQuery query(db);
+  query.setForwardOnly(true);
+  if (!query.exec(
+          postgres
+              ? QStringLiteral(
+                    "SELECT tgname FROM pg_trigger WHERE NOT tgisinternal "
+                    "UNION SELECT c.relname FROM pg_class c JOIN pg_namespace "
+                    "n ON n.oid = c.relnamespace WHERE n.nspname = "
+                    "current_schema() UNION SELECT p.proname FROM pg_proc p "
+                    "JOIN pg_namespace n ON n.oid = p.pronamespace WHERE "
+                    "n.nspname = current_schema()")
+              : QStringLiteral("SELECT name FROM sqlite_master"))) {
+    qWarning() << tr("Fehler beim Erzeugen der Trigger für last_update: ")
+               << query.lastError().text();
+    return false;
+  }
+  while (query.next()) {
+    existing.insert(query.value(0).toString().toLower());
   }
-  return query.exec();
+  query.finish();
+
+  QStringList statements;
+  const auto add = [&existing, &statements](const QString &name,
+                                            const QString &statement) {
+    if (!existing.contains(name)) {
+      statements.append(statement);
+    }
+  };
+
+  if (postgres) {
+    add(QStringLiteral("set_last_update"),
+        QStringLiteral(
+            "CREATE OR REPLACE FUNCTION set_last_update() RETURNS trigger AS "
+            "$$\n"
+            "BEGIN\n"
+            "  IF TG_OP = 'INSERT' AND NEW.last_update IS NOT NULL THEN\n"
+            "    RETURN NEW;\n"
+            "  END IF;\n"
+            "  IF TG_OP = 'UPDATE' AND\n"
+            "     NEW.last_update IS DISTINCT FROM OLD.last_update THEN\n"
+            "    RETURN NEW;\n"
+            "  END IF;\n"
+            "  NEW.last_update := clock_timestamp();\n"
+            "  RETURN NEW;\n"
+            "END;\n"
+            "$$ LANGUAGE plpgsql"));
+
+    // The payload <table>:<INSERT|UPDATE|DELETE>:<key> for ChangeNotifier
+    add(QStringLiteral("notify_change"),
+        QStringLiteral(
+            "CREATE OR REPLACE FUNCTION notify_change() RETURNS trigger AS $$\n"
+            "DECLARE\n"
+            "  data jsonb;\n"
+            "BEGIN\n"
+            "  IF TG_OP = 'DELETE' THEN\n"
+            "    data := to_jsonb(OLD);\n"
+            "  ELSE\n"
+            "    data := to_jsonb(NEW);\n"
+            "  END IF;\n"
+            "  PERFORM pg_notify('jmbde_change', TG_TABLE_NAME || ':' || "
+            "TG_OP\n"
+            "                    || ':' || (data ->> TG_ARGV[0]));\n"
+            "  RETURN NULL;\n"
+            "END;\n"
+            "$$ LANGUAGE plpgsql"));
+
+    add(QStringLiteral("record_delete"),
+        QStringLiteral(
+            "CREATE OR REPLACE FUNCTION record_delete() RETURNS trigger AS $$\n"
+            "BEGIN\n"
+            "  INSERT INTO deleted_row (table_name, row_id, deleted_at)\n"
+            "  VALUES (TG_TABLE_NAME, (to_jsonb(OLD) ->> TG_ARGV[0])::bigint,\n"
+            "          clock_timestamp());\n"
+            "  RETURN NULL;\n"
+            "END;\n"
+            "$$ LANGUAGE plpgsql"));
+  }
+
+  // The keys of deleted rows for the change feed, see purgeDeletedRows()
+  add(QStringLiteral("deleted_row"),
+      QStringLiteral("CREATE TABLE IF NOT EXISTS deleted_row (table_name "
+                     "VARCHAR(64) NOT NULL, row_id BIGINT NOT NULL, "
+                     "deleted_at TIMESTAMP NOT NULL)"));
+  add(QStringLiteral("deleted_row_idx"),
+      QStringLiteral("CREATE INDEX IF NOT EXISTS deleted_row_idx ON "
+                     "deleted_row (table_name, deleted_at)"));
+
+  for (const auto *table : Schema::Tables) {
+    const auto name = QLatin1String(table->name);
+    const auto primaryKey = QLatin1String(table->primaryKey().name);
+    if (postgres) {
+      add(name + QLatin1String("_notify"),
+          QStringLiteral("CREATE TRIGGER %1_notify AFTER INSERT OR UPDATE OR "
+                         "DELETE ON %1 FOR EACH ROW EXECUTE FUNCTION "
+                         "notify_change('%2')")
+              .arg(name, primaryKey));
+      add(name + QLatin1String("_deleted"),
+          QStringLiteral("CREATE TRIGGER %1_deleted AFTER DELETE ON %1 FOR "
+                         "EACH ROW EXECUTE FUNCTION record_delete('%2')")
+              .arg(name, primaryKey));
+    } else {
+      add(name + QLatin1String("_deleted"),
+          QStringLiteral("CREATE TRIGGER IF NOT EXISTS %1_deleted AFTER "
+                         "DELETE ON %1 FOR EACH ROW BEGIN INSERT INTO "
+                         "deleted_row (table_name, row_id, deleted_at) "
+                         "VALUES ('%1', OLD.%2, "
+                         "strftime('%Y-%m-%dT%H:%M:%fZ', 'now')); END")
+              .arg(name, primaryKey));
+    }
+
+    if (table->indexOf("last_update") < 0) {
+      continue;
+    }
+
+    // The change feed reads the rows after a watermark
+    add(name + QLatin1String("_last_update_idx"),
+        QStringLiteral("CREATE INDEX IF NOT EXISTS %1_last_update_idx ON %1 "
+                       "(last_update)")
+            .arg(name));
+
+    if (postgres) {
+      add(name + QLatin1String("_last_update"),
+          QStringLiteral("CREATE TRIGGER %1_last_update BEFORE INSERT OR "
+                         "UPDATE ON %1 FOR EACH ROW EXECUTE FUNCTION "
+                         "set_last_update()")
+              .arg(name));
+      continue;
+    }
+
+    // SQLite can't change NEW, the row is updated after the write. The
+    // update doesn't fire the trigger again, last_update has changed.
+    const auto body =
+        QStringLiteral("BEGIN UPDATE %1 SET last_update = "
+                       "strftime('%Y-%m-%dT%H:%M:%fZ', 'now') "
+                       "WHERE %2 = NEW.%2; END")
+            .arg(name, primaryKey);
+    add(name + QLatin1String("_last_update_insert"),
+        QStringLiteral("CREATE TRIGGER IF NOT EXISTS %1_last_update_insert "
+                       "AFTER INSERT ON %1 FOR EACH ROW "
+                       "WHEN NEW.last_update IS NULL ")
+                .arg(name) +
+            body);
+    add(name + QLatin1String("_last_update_update"),
+        QStringLiteral("CREATE TRIGGER IF NOT EXISTS %1_last_update_update "
+                       "AFTER UPDATE ON %1 FOR EACH ROW "
+                       "WHEN NEW.last_update IS OLD.last_update ")
+                .arg(name) +
+            body);
+  }
+
+  if (statements.isEmpty()) {
+    return true;
+  }
+
+  Transaction transaction(db);
+
+  for (const auto &statement : qAsConst(statements)) {
+    if (!query.exec(statement)) {
+      qWarning() << tr("Fehler beim Erzeugen der Trigger für last_update: ")
+                 << query.lastError().text();
+      transaction.rollback();
+      return false;
+    }
+  }
+
+  return !transaction.isActive() || transaction.commit();
+}
+
+auto Model::DataContext::purgeDeletedRows(int days) const -> bool {
+  QSqlQuery query(this->m_db);
+  const auto purge =
+      this->m_db.driverName() == QLatin1String("QPSQL")
+          ? QStringLiteral("DELETE FROM deleted_row WHERE deleted_at < "
+                           "clock_timestamp() - make_interval(days => %1)")
+          : QStringLiteral("DELETE FROM deleted_row WHERE deleted_at < "
+                           "strftime('%Y-%m-%dT%H:%M:%fZ', 'now', '-%1 days')");
+  if (!query.exec(purge.arg(days))) {
+    qWarning() << tr("Fehler beim Löschen der alten gelöschten Zeilen: ")
+               << query.lastError().text();
+    return false;
+  }
+  return true;
 }
 
-auto Model::DataContext::update(const QString &table, const QString &column,
-                                const QVariant &newValue, const QVariant &op,
-                                const QString &id) const -> bool {
-  auto searchStr = QLatin1String("\"");
-  auto replaceStr = QLatin1String("\"\"");
-  auto newValString = newValue.toString();
-  auto realNewString = newValString.replace(searchStr, replaceStr);
-  auto queryString =
-      QLatin1String("UPDATA %1 SET %2 = \"%3\" WHERE %4 = \"%5\"");
+auto Model::DataContext::notifier() -> ChangeNotifier * {
+  if (this->m_notifier == nullptr) {
+    this->m_notifier = new ChangeNotifier(this);
+  }
+  return this->m_notifier;
+}
+
+auto Model::DataContext::changesSince(const TableDescriptor &table,
+                                      const QDateTime &since) const
+    -> ChangeSet {
+  ChangeSet changes;
+  changes.table = QLatin1String(table.name);
+  changes.watermark = since;
+
+  if (table.indexOf("last_update") < 0) {
+    changes.rows.error =
+        tr("Die Tabelle %1 hat keine Spalte last_update").arg(changes.table);
+    return changes;
+  }
+
+  int watermarkColumn = -1;
+  for (std::size_t i = 0; i < table.columnCount; ++i) {
+    const auto &column = table.columns[i];
+    if (column.type == ColumnType::Blob) {
+      continue;
+    }
+    if (std::string_view(column.name) == "last_update") {
+      watermarkColumn = changes.rows.columns.size();
+    }
+    changes.rows.columns.append(QLatin1String(column.name));
+  }
+
+  // SQLite keeps the timestamps as ISO text in UTC, they sort as text
+  const bool postgres = this->m_db.driverName() == QLatin1String("QPSQL");
+  auto sql = QStringLiteral("SELECT %1 FROM %2")
+                 .arg(changes.rows.columns.join(QLatin1String(", ")),
+                      changes.table);
+  if (since.isValid()) {
+    sql += QLatin1String(" WHERE last_update > ?");
+  }
+  sql += QLatin1String(" ORDER BY last_update");
+
+  QSqlQuery query(this->m_db);
+  query.setForwardOnly(true);
+  query.prepare(sql);
+  if (since.isValid()) {
+    query.addBindValue(postgres ? QVariant(since)
+                                : QVariant(since.toUTC().toString(
+                                      Qt::ISODateWithMs)));
+  }
+
+  if (!query.exec()) {
+    changes.rows.error = query.lastError().text();
+    qWarning() << tr("Fehler bei der Datenbankabfrage ( %1 ) : %2")
+                      .arg(sql, changes.rows.error);
+    return changes;
+  }
+
+  const auto columnCount = changes.rows.columns.size();
+  while (query.next()) {
+    QVariantList row;
+    row.reserve(columnCount);
+    for (int i = 0; i < columnCount; ++i) {
+      row.append(query.value(i));
+    }
+
+    const auto timestamp = toTimestamp(row.at(watermarkColumn));
+    if (timestamp.isValid()) {
+      changes.watermark = timestamp;
+    }
+    changes.rows.rows.append(row);
+  }
+
+  // The triggers of createChangeTracking() keep the deleted keys
+  auto deletedSql = QStringLiteral(
+      "SELECT row_id, deleted_at FROM deleted_row WHERE table_name = ?");
+  if (since.isValid()) {
+    deletedSql += QLatin1String(" AND deleted_at > ?");
+  }
+  deletedSql += QLatin1String(" ORDER BY deleted_at");
+
+  query.prepare(deletedSql);
+  query.addBindValue(changes.table);
+  if (since.isValid()) {
+    query.addBindValue(postgres ? QVariant(since)
+                                : QVariant(since.toUTC().toString(
+                                      Qt::ISODateWithMs)));
+  }
+  if (query.exec()) {
+    while (query.next()) {
+      changes.deleted.append(query.value(0).toLongLong());
+      const auto timestamp = toTimestamp(query.value(1));
+      if (timestamp.isValid() &&
+          (!changes.watermark.isValid() || timestamp > changes.watermark)) {
+        changes.watermark = timestamp;
+      }
+    }
+  }
 
-  auto queryStr =
-      QString(queryString).arg(table, column, realNewString, op.toString(), id);
-  auto query = this->getQuery(queryStr);
-  return query.exec();
+  return changes;
 }
 
 auto Model::DataContext::getQuery(const QString &queryText) -> QSqlQuery {
@@ -305,6 +1173,7 @@ void Model::DataContext::open(const QString &name) {
   }
 
   if (!this->m_db.isOpen()) {
+    this->m_statementCache.clear();
     if (!this->m_db.isValid()) {
       this->m_db = QSqlDatabase::database(name);
     }
@@ -313,14 +1182,44 @@ void Model::DataContext::open(const QString &name) {
                   << this->m_db.lastError().text() << name;
     } else {
       qDebug() << tr("Öffne Datenbank : ") << name;
-      if (m_dbType == DBTypes::SQLITE) {
-        auto query = QSqlQuery(this->m_db);
-        if (!query.exec(QStringLiteral("PRAGMA synchronous=OFF"))) {
-          qCritical() << tr("Fehler beim setzen des Pragma: ")
-                      << tr("Fehlermeldung: ") << query.lastQuery() << " : "
-                      << query.lastError().text();
-        }
+      if (this->m_connectionPool != nullptr) {
+        this->m_connectionPool->setMaster(this->m_db);
       }
+      this->applyPragmaProfile();
+    }
+  }
+}
+
+void Model::DataContext::setPragmaProfile(const PragmaProfile &profile) {
+  this->m_pragmaProfile = profile;
+
+  if (m_dbType != DBTypes::SQLITE) {
+    return;
+  }
+
+  if (this->m_connectionPool != nullptr) {
+    this->m_connectionPool->setInitStatements(profile.statements());
+    // Reopen the idle clones with the new profile
+    this->m_connectionPool->closeIdleConnections();
+  }
+
+  if (this->m_db.isOpen()) {
+    this->applyPragmaProfile();
+  }
+}
+
+void Model::DataContext::applyPragmaProfile() {
+  if (m_dbType != DBTypes::SQLITE) {
+    return;
+  }
+
+  auto query = QSqlQuery(this->m_db);
+  const auto statements = this->m_pragmaProfile.statements();
+  for (const auto &statement : statements) {
+    if (!query.exec(statement)) {
+      qCritical() << tr("Fehler beim setzen des Pragma: ")
+                  << tr("Fehlermeldung: ") << query.lastQuery() << " : "
+                  << query.lastError().text();
     }
   }
 }
@@ -334,16 +1233,27 @@ void Model::DataContext::renameDB(const QString &newName) {
     qDebug() << tr("Ändere den Namen der Datenbank : ") << oldConnection
              << tr(" Neuer Name: ") << this->m_connectionString;
 
+    this->m_statementCache.clear();
+    if (this->m_notifier != nullptr) {
+      this->m_notifier->detach();
+    }
     this->m_db.close();
     QFile f(oldConnection);
     f.rename(this->m_connectionString);
     this->open(newName);
+    if (this->m_notifier != nullptr) {
+      this->m_notifier->attach();
+    }
   }
 }
 
 void Model::DataContext::deleteDB(const QString &dbName) {
   qDebug() << tr("Lösche Datenbank") << dbName;
 
+  this->m_statementCache.clear();
+  if (this->m_notifier != nullptr) {
+    this->m_notifier->detach();
+  }
   this->m_db.close();
 
   // Delete File only by SQLITE Database
@@ -0,0 +1,333 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "jmbdemodels/datagenerator.h"
+
+#include <QDate>
+#include <QDateTime>
+#include <QFuture>
+#include <QQueue>
+#include <QThread>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "jmbdemodels/datacontext.h"
+#include "jmbdemodels/schema.h"
+
+namespace {
+/*!
+    \brief The lookup tables and their default row counts
+ */
+struct LookupCount {
+  const char *table;
+  int count;
+};
+
+constexpr LookupCount lookups[] = {
+    {"chip_card_door", 300}, {"chip_card_profile", 50},
+    {"chip_card_profile_door", 500}, {"city_name", 2000},
+    {"company", 100}, {"department", 50},
+    {"device_name", 500}, {"device_type", 20},
+    {"function", 30}, {"manufacturer", 100},
+    {"os", 20}, {"place", 200},
+    {"processor", 50}, {"software", 2000},
+    {"system_data", 50}, {"title", 10},
+    {"zip_city", 4000}, {"zip_code", 3000},
+};
+
+const char *const firstNames[] = {
+    "Anna", "Ben",   "Clara", "David", "Emma", "Felix", "Hanna",  "Jonas",
+    "Lea",  "Lukas", "Marie", "Max",   "Mia",  "Paul",  "Sophie", "Tim"};
+
+const char *const lastNames[] = {
+    "Bauer",   "Becker",  "Fischer",   "Hoffmann", "Koch",   "Meyer",
+    "Müller",  "Richter", "Schäfer",   "Schmidt",  "Schulz", "Schneider",
+    "Wagner",  "Weber",   "Zimmermann", "Wolf"};
+
+// FNV-1a, qHash() is seeded per process
+auto stableHash(const char *text) -> quint32 {
+  quint32 hash = 2166136261U;
+  for (; *text != '\0'; ++text) {
+    hash = (hash ^ static_cast<unsigned char>(*text)) * 16777619U;
+  }
+  return hash;
+}
+
+// The 53 high bits of the generator as a double in [0, 1); the
+// distributions of <random> differ between the standard libraries
+auto toUniform(quint64 random) -> double {
+  return static_cast<double>(random >> 11) * (1.0 / 9007199254740992.0);
+}
+
+auto percentOf(int total, int percent) -> int {
+  return static_cast<int>(static_cast<qint64>(total) * percent / 100);
+}
+} // namespace
+
+Model::DataGenerator::DataGenerator(const Options &options)
+    : m_options(options) {
+  this->m_options.batchSize = qMax(1, this->m_options.batchSize);
+
+  for (const auto *table : Schema::Tables) {
+    const auto name = QLatin1String(table->name);
+    const auto it = this->m_options.counts.constFind(name);
+    this->m_counts.insert(name, it != this->m_options.counts.cend()
+                                    ? qMax(0, it.value())
+                                    : this->defaultCount(name));
+  }
+
+  // P(id = k) is proportional to 1 / k^skew
+  for (const auto &lookup : lookups) {
+    const auto name = QLatin1String(lookup.table);
+    const auto n = this->m_counts.value(name);
+    if (n <= 0 || this->m_options.skew <= 0.0) {
+      continue;
+    }
+
+    std::vector<double> cdf(static_cast<std::size_t>(n));
+    double sum = 0.0;
+    for (int k = 0; k < n; ++k) {
+      sum += 1.0 / std::pow(k + 1.0, this->m_options.skew);
+      cdf[static_cast<std::size_t>(k)] = sum;
+    }
+    for (auto &value : cdf) {
+      value /= sum;
+    }
+    this->m_zipf.insert(name, std::move(cdf));
+  }
+}
+
+auto Model::DataGenerator::defaultCount(const QString &table) const -> int {
+  for (const auto &lookup : lookups) {
+    if (table == QLatin1String(lookup.table)) {
+      return lookup.count;
+    }
+  }
+
+  const auto employees = qMax(0, this->m_options.employees);
+  const auto devices = qMax(0, this->m_options.devices);
+  if (table == QLatin1String("employee") ||
+      table == QLatin1String("employee_account") ||
+      table == QLatin1String("account") ||
+      table == QLatin1String("chip_card")) {
+    return employees;
+  }
+  if (table == QLatin1String("document") ||
+      table == QLatin1String("employee_document")) {
+    return employees > 0 ? qMax(1, employees / 10) : 0;
+  }
+  if (table == QLatin1String("inventory")) {
+    return devices;
+  }
+  if (table == QLatin1String("computer")) {
+    return percentOf(devices, 40);
+  }
+  if (table == QLatin1String("phone")) {
+    return percentOf(devices, 25);
+  }
+  if (table == QLatin1String("mobile")) {
+    return percentOf(devices, 15);
+  }
+  if (table == QLatin1String("printer")) {
+    return percentOf(devices, 10);
+  }
+  if (table == QLatin1String("fax")) {
+    return devices - percentOf(devices, 40) - percentOf(devices, 25) -
+           percentOf(devices, 15) - percentOf(devices, 10);
+  }
+  if (table == QLatin1String("computer_software")) {
+    const auto computers = this->m_options.counts.value(
+        QLatin1String("computer"), percentOf(devices, 40));
+    return computers * qMax(0, this->m_options.softwarePerComputer);
+  }
+
+  // database_version keeps its own row
+  return 0;
+}
+
+auto Model::DataGenerator::count(const TableDescriptor &table) const -> int {
+  return this->m_counts.value(QLatin1String(table.name));
+}
+
+auto Model::DataGenerator::reference(const char *table, quint64 random,
+                                     double uniform) const -> QVariant {
+  const auto name = QLatin1String(table);
+  const auto n = this->m_counts.value(name);
+  if (n <= 0) {
+    return QVariant();
+  }
+
+  const auto zipf = this->m_zipf.constFind(name);
+  if (zipf == this->m_zipf.cend()) {
+    return static_cast<qint64>(1 + random % static_cast<quint64>(n));
+  }
+
+  const auto &cdf = zipf.value();
+  const auto it = std::lower_bound(cdf.cbegin(), cdf.cend(), uniform);
+  return static_cast<qint64>(
+      qMin<std::ptrdiff_t>(it - cdf.cbegin(), n - 1) + 1);
+}
+
+auto Model::DataGenerator::rows(const TableDescriptor &table, int batch) const
+    -> QVector<QVariantMap> {
+  const auto total = this->count(table);
+  const auto first = static_cast<qint64>(batch) * this->m_options.batchSize;
+  const auto last = qMin<qint64>(total, first + this->m_options.batchSize);
+
+  QVector<QVariantMap> result;
+  if (first >= last) {
+    return result;
+  }
+  result.reserve(static_cast<int>(last - first));
+
+  const auto seed = this->m_options.seed;
+  std::seed_seq sequence{static_cast<quint32>(seed),
+                         static_cast<quint32>(seed >> 32),
+                         stableHash(table.name), static_cast<quint32>(batch)};
+  std::mt19937_64 random(sequence);
+
+  static const QDate firstBirthDay(1960, 1, 1);
+  static const QDateTime lastUpdate(QDate(2021, 12, 25), QTime(0, 0),
+                                    Qt::UTC);
+
+  for (auto id = first + 1; id <= last; ++id) {
+    QVariantMap row;
+    row.insert(QLatin1String(table.primaryKey().name), id);
+
+    for (std::size_t i = 1; i < table.columnCount; ++i) {
+      const auto &column = table.columns[i];
+      const auto name = QLatin1String(column.name);
+      const auto value = random();
+
+      if (column.references != nullptr) {
+        row.insert(name, this->reference(column.references, value,
+                                         toUniform(value)));
+        continue;
+      }
+
+      switch (column.type) {
+      case ColumnType::Integer:
+        row.insert(name, static_cast<qint64>(value % 1000));
+        break;
+      case ColumnType::Real:
+        row.insert(name, toUniform(value) * 1000.0);
+        break;
+      case ColumnType::Boolean:
+        row.insert(name, value % 10 != 0);
+        break;
+      case ColumnType::Date:
+        row.insert(name, firstBirthDay.addDays(
+                             static_cast<qint64>(value % 20000)));
+        break;
+      case ColumnType::DateTime:
+        // A set last_update skips the trigger of the change tracking
+        row.insert(name, lastUpdate.addSecs(
+                             -static_cast<qint64>(value % 31536000)));
+        break;
+      case ColumnType::Text: {
+        const auto columnName = QString(name);
+        if (columnName.endsWith(QLatin1String("first_name"))) {
+          row.insert(name, QString::fromUtf8(firstNames[value % 16]));
+        } else if (columnName.endsWith(QLatin1String("last_name"))) {
+          row.insert(name, QString::fromUtf8(lastNames[value % 16]));
+        } else if (columnName.contains(QLatin1String("mail"))) {
+          row.insert(name, QStringLiteral("user%1@example.com").arg(id));
+        } else if (columnName.contains(QLatin1String("phone")) ||
+                   columnName.contains(QLatin1String("mobile")) ||
+                   columnName.contains(QLatin1String("fax")) ||
+                   columnName.contains(QLatin1String("number"))) {
+          row.insert(name, QString::number(100000000 + value % 900000000));
+        } else {
+          row.insert(name, QStringLiteral("%1 %2").arg(name).arg(id));
+        }
+        break;
+      }
+      case ColumnType::Blob:
+        // Documents and photos stay empty
+        break;
+      }
+    }
+    result.append(row);
+  }
+  return result;
+}
+
+auto Model::DataGenerator::run(DataContext &context) -> bool {
+  this->m_error.clear();
+  this->m_rowsWritten = 0;
+
+  const bool sqlite =
+      context.getDatabase().driverName() == QLatin1String("QSQLITE");
+  const auto profile = context.getPragmaProfile();
+  if (sqlite) {
+    context.setPragmaProfile(PragmaProfile::bulkLoad());
+  }
+
+  QThreadPool pool;
+  pool.setMaxThreadCount(this->m_options.threads > 0
+                             ? this->m_options.threads
+                             : QThread::idealThreadCount());
+  const auto ahead = pool.maxThreadCount() * 2;
+
+  bool ok = true;
+  for (const auto *table : Schema::Tables) {
+    const auto name = QLatin1String(table->name);
+    const qint64 total = this->count(*table);
+    if (total <= 0) {
+      continue;
+    }
+    const auto batches = static_cast<int>(
+        (total + this->m_options.batchSize - 1) / this->m_options.batchSize);
+
+    // The threads stay a few batches ahead of the writer
+    QQueue<QFuture<QVector<QVariantMap>>> queue;
+    int next = 0;
+    const auto enqueue = [&]() {
+      const auto batch = next++;
+      queue.enqueue(QtConcurrent::run(
+          &pool, [this, table, batch]() { return this->rows(*table, batch); }));
+    };
+    while (next < batches && queue.size() < ahead) {
+      enqueue();
+    }
+
+    qint64 written = 0;
+    while (ok && !queue.isEmpty()) {
+      const auto rows = queue.dequeue().result();
+      if (next < batches) {
+        enqueue();
+      }
+
+      const auto result =
+          context.insertBatch(name, rows, this->m_options.batchSize);
+      written += result.succeeded;
+      this->m_rowsWritten += result.succeeded;
+      if (!result.isValid()) {
+        this->m_error = tr("Fehler beim Füllen der Tabelle %1: %2")
+                            .arg(name, result.failed.first().error);
+        ok = false;
+      }
+      if (this->m_progress) {
+        this->m_progress(name, written, total);
+      }
+    }
+
+    if (!ok) {
+      pool.waitForDone();
+      break;
+    }
+  }
+
+  if (sqlite) {
+    context.setPragmaProfile(profile);
+  }
+  return ok;
+}
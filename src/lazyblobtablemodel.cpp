@@ -0,0 +1,55 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "jmbdemodels/lazyblobtablemodel.h"
+
+#include <QSqlDriver>
+#include <QStringList>
+
+Model::LazyBlobTableModel::LazyBlobTableModel(const TableDescriptor &table,
+                                              QObject *parent,
+                                              const QSqlDatabase &db)
+    : QSqlRelationalTableModel(parent, db), m_table(&table) {}
+
+auto Model::LazyBlobTableModel::selectStatement() const -> QString {
+  const auto statement = QSqlRelationalTableModel::selectStatement();
+  if (this->m_loadBlobs ||
+      this->tableName() != QLatin1String(this->m_table->name)) {
+    return statement;
+  }
+
+  // SELECT <fields> FROM ..., the fields are plain or qualified names
+  const auto select = QLatin1String("SELECT ");
+  const auto from = statement.indexOf(QLatin1String(" FROM "));
+  if (!statement.startsWith(select) || from < 0) {
+    return statement;
+  }
+  auto fields = statement.mid(select.size(), from - select.size())
+                    .split(QLatin1Char(','));
+
+  const auto *driver = this->database().driver();
+  bool changed = false;
+  for (std::size_t i = 0; i < this->m_table->columnCount; ++i) {
+    const auto &column = this->m_table->columns[i];
+    if (column.type != ColumnType::Blob) {
+      continue;
+    }
+
+    const auto name = driver->escapeIdentifier(QLatin1String(column.name),
+                                               QSqlDriver::FieldName);
+    for (auto &field : fields) {
+      const auto trimmed = field.trimmed();
+      if (trimmed == name || trimmed.endsWith(QLatin1Char('.') + name)) {
+        field = QLatin1String("NULL AS ") + name;
+        changed = true;
+      }
+    }
+  }
+
+  return changed ? select + fields.join(QLatin1Char(',')) + statement.mid(from)
+                 : statement;
+}
@@ -0,0 +1,263 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "jmbdemodels/migrator.h"
+
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QMap>
+#include <QRegularExpression>
+#include <QSqlError>
+#include <QSqlQuery>
+
+#include <memory>
+
+#include "jmbdemodels/commondata.h"
+#include "jmbdemodels/datacontext.h"
+#include "jmbdemodels/transaction.h"
+
+namespace {
+/*!
+    \brief The only statement of an online migration, it can run again
+ */
+auto onlineStatement() -> const QRegularExpression & {
+  static const QRegularExpression createIndex(
+      QStringLiteral("^(CREATE\\s+(?:UNIQUE\\s+)?INDEX)\\s+"
+                     "IF\\s+NOT\\s+EXISTS\\s+(\\w+)"),
+      QRegularExpression::CaseInsensitiveOption);
+  return createIndex;
+}
+} // namespace
+
+Model::Migrator::Migrator(const QSqlDatabase &db, QObject *parent)
+    : QObject(parent), m_db(db),
+      m_directory(QLatin1String(":/data/migrations")) {}
+
+auto Model::Migrator::migrations() const -> QVector<Migration> {
+  // <version>_<name>[.sqlite|.pgsql].sql
+  static const QRegularExpression pattern(
+      QStringLiteral("^(\\d+)_([^.]+)(?:\\.(sqlite|pgsql))?\\.sql$"));
+
+  const auto driver = this->m_db.driverName();
+  QString own;
+  if (driver == QLatin1String("QPSQL")) {
+    own = QLatin1String("pgsql");
+  } else if (driver == QLatin1String("QSQLITE")) {
+    own = QLatin1String("sqlite");
+  }
+
+  QMap<int, Migration> byVersion;
+  QMap<int, bool> specific;
+  const QDir directory(this->m_directory);
+  const auto files =
+      directory.entryList({QStringLiteral("*.sql")}, QDir::Files, QDir::Name);
+  for (const auto &file : files) {
+    const auto match = pattern.match(file);
+    if (!match.hasMatch()) {
+      continue;
+    }
+
+    const auto suffix = match.captured(3);
+    if (!suffix.isEmpty() && suffix != own) {
+      continue;
+    }
+
+    const auto version = match.captured(1).toInt();
+    if (specific.value(version, false)) {
+      continue;
+    }
+    byVersion.insert(version, {version, match.captured(2),
+                               directory.filePath(file)});
+    specific.insert(version, !suffix.isEmpty());
+  }
+
+  return byVersion.values().toVector();
+}
+
+auto Model::Migrator::pending() const -> QVector<Migration> {
+  const auto done = this->applied();
+
+  QVector<Migration> result;
+  for (const auto &migration : this->migrations()) {
+    if (!done.contains(migration.version)) {
+      result.append(migration);
+    }
+  }
+  return result;
+}
+
+auto Model::Migrator::currentVersion() const -> int {
+  int version = 0;
+  for (const auto done : this->applied()) {
+    version = qMax(version, done);
+  }
+  return version;
+}
+
+auto Model::Migrator::migrate() -> bool {
+  this->m_error.clear();
+  if (!this->ensureTable()) {
+    return false;
+  }
+
+  const auto migrations = this->pending();
+  for (int i = 0; i < migrations.size(); ++i) {
+    if (!this->apply(migrations.at(i), i + 1, migrations.size())) {
+      qCritical() << tr("Migration %1 (%2) ist fehlgeschlagen: %3")
+                         .arg(migrations.at(i).version)
+                         .arg(migrations.at(i).name, this->m_error);
+      if (i > 0) {
+        CommonData::clearIndexCache();
+      }
+      return false;
+    }
+    qInfo() << tr("Migration %1 (%2) angewendet")
+                   .arg(migrations.at(i).version)
+                   .arg(migrations.at(i).name);
+  }
+
+  // The models read the field indexes of the new schema
+  if (!migrations.isEmpty()) {
+    CommonData::clearIndexCache();
+  }
+  return true;
+}
+
+auto Model::Migrator::ensureTable() -> bool {
+  QSqlQuery query(this->m_db);
+  if (!query.exec(QStringLiteral(
+          "CREATE TABLE IF NOT EXISTS schema_migrations ("
+          "version INTEGER PRIMARY KEY, name VARCHAR(255) NOT NULL, "
+          "applied_at TIMESTAMP)"))) {
+    this->m_error = query.lastError().text();
+    return false;
+  }
+  return true;
+}
+
+auto Model::Migrator::applied() const -> QSet<int> {
+  QSet<int> versions;
+  QSqlQuery query(this->m_db);
+  query.setForwardOnly(true);
+  if (query.exec(QStringLiteral("SELECT version FROM schema_migrations"))) {
+    while (query.next()) {
+      versions.insert(query.value(0).toInt());
+    }
+  }
+  return versions;
+}
+
+auto Model::Migrator::apply(const Migration &migration, int position,
+                            int count) -> bool {
+  QFile file(migration.fileName);
+  if (!file.open(QIODevice::ReadOnly)) {
+    this->m_error = file.errorString();
+    return false;
+  }
+  const auto script = QString::fromUtf8(file.readAll());
+  file.close();
+
+  static const QRegularExpression onlineDirective(
+      QStringLiteral("^--\\s*migrate:\\s*online\\s*$"),
+      QRegularExpression::CaseInsensitiveOption |
+          QRegularExpression::MultilineOption);
+  static const QRegularExpression transactionControl(
+      QStringLiteral("^(BEGIN|COMMIT|END)(\\s+TRANSACTION)?$"),
+      QRegularExpression::CaseInsensitiveOption);
+
+  const bool online = onlineDirective.match(script).hasMatch();
+  QStringList statements;
+  for (const auto &statement : DataContext::splitStatements(script)) {
+    if (!transactionControl.match(statement).hasMatch()) {
+      statements.append(statement);
+    }
+  }
+
+  // An online script isn't recorded until its last statement is done, a
+  // retry runs the statements before a failed one again
+  if (online) {
+    for (const auto &statement : statements) {
+      if (!onlineStatement().match(statement).hasMatch()) {
+        this->m_error =
+            tr("Eine online Migration erlaubt nur CREATE INDEX IF NOT "
+               "EXISTS: %1")
+                .arg(statement);
+        return false;
+      }
+    }
+  }
+
+  // Online statements run outside a transaction, CONCURRENTLY refuses one
+  std::unique_ptr<Transaction> transaction;
+  if (!online) {
+    transaction = std::make_unique<Transaction>(this->m_db);
+  }
+  const auto fail = [&](const QString &error) {
+    this->m_error = error;
+    if (transaction) {
+      transaction->rollback();
+    }
+    return false;
+  };
+
+  QSqlQuery query(this->m_db);
+  for (int i = 0; i < statements.size(); ++i) {
+    if (online) {
+      if (!this->execOnline(statements.at(i))) {
+        return false;
+      }
+    } else if (!query.exec(statements.at(i))) {
+      return fail(query.lastError().text());
+    }
+    emit progress(position, count, i + 1, statements.size(), migration.name);
+  }
+
+  query.prepare(QStringLiteral("INSERT INTO schema_migrations "
+                               "(version, name, applied_at) VALUES (?, ?, ?)"));
+  query.addBindValue(migration.version);
+  query.addBindValue(migration.name);
+  query.addBindValue(QDateTime::currentDateTimeUtc());
+  if (!query.exec()) {
+    return fail(query.lastError().text());
+  }
+
+  if (transaction && transaction->isActive() && !transaction->commit()) {
+    this->m_error = transaction->lastError();
+    return false;
+  }
+  return true;
+}
+
+auto Model::Migrator::execOnline(const QString &statement) -> bool {
+  QSqlQuery query(this->m_db);
+  auto sql = statement;
+  const auto match = onlineStatement().match(statement);
+  if (match.hasMatch() && this->m_db.driverName() == QLatin1String("QPSQL")) {
+    // An interrupted concurrent build leaves an invalid index behind, IF NOT
+    // EXISTS would keep it
+    query.prepare(QStringLiteral(
+        "SELECT 1 FROM pg_class c JOIN pg_index i ON i.indexrelid = c.oid "
+        "WHERE c.relname = ? AND NOT i.indisvalid"));
+    query.addBindValue(match.captured(2).toLower());
+    if (query.exec() && query.next() &&
+        !query.exec(QStringLiteral("DROP INDEX CONCURRENTLY IF EXISTS %1")
+                        .arg(match.captured(2)))) {
+      this->m_error = query.lastError().text();
+      return false;
+    }
+
+    sql.insert(match.capturedEnd(1), QLatin1String(" CONCURRENTLY"));
+  }
+
+  if (!query.exec(sql)) {
+    this->m_error = query.lastError().text();
+    return false;
+  }
+  return true;
+}
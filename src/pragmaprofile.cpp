@@ -0,0 +1,63 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "jmbdemodels/pragmaprofile.h"
+
+auto Model::PragmaProfile::interactive() -> PragmaProfile {
+  return {};
+}
+
+auto Model::PragmaProfile::bulkLoad() -> PragmaProfile {
+  PragmaProfile profile;
+  profile.synchronous = QStringLiteral("OFF");
+  profile.cacheSize = -262144;
+  profile.busyTimeout = 30000;
+  return profile;
+}
+
+auto Model::PragmaProfile::readOnlyReporting() -> PragmaProfile {
+  PragmaProfile profile;
+  profile.cacheSize = -65536;
+  profile.mmapSize = Q_INT64_C(268435456);
+  profile.queryOnly = true;
+  return profile;
+}
+
+auto Model::PragmaProfile::statements() const -> QStringList {
+  QStringList pragmas;
+
+  // page_size must come first, it only applies before the first table
+  if (this->pageSize > 0) {
+    pragmas.append(QStringLiteral("PRAGMA page_size=%1").arg(this->pageSize));
+  }
+  if (!this->journalMode.isEmpty()) {
+    pragmas.append(
+        QStringLiteral("PRAGMA journal_mode=%1").arg(this->journalMode));
+  }
+  if (!this->synchronous.isEmpty()) {
+    pragmas.append(
+        QStringLiteral("PRAGMA synchronous=%1").arg(this->synchronous));
+  }
+  if (this->cacheSize != -1) {
+    pragmas.append(QStringLiteral("PRAGMA cache_size=%1").arg(this->cacheSize));
+  }
+  if (this->mmapSize >= 0) {
+    pragmas.append(QStringLiteral("PRAGMA mmap_size=%1").arg(this->mmapSize));
+  }
+  if (!this->tempStore.isEmpty()) {
+    pragmas.append(QStringLiteral("PRAGMA temp_store=%1").arg(this->tempStore));
+  }
+  if (this->busyTimeout >= 0) {
+    pragmas.append(
+        QStringLiteral("PRAGMA busy_timeout=%1").arg(this->busyTimeout));
+  }
+  pragmas.append(QStringLiteral("PRAGMA query_only=%1")
+                     .arg(this->queryOnly ? QLatin1String("ON")
+                                          : QLatin1String("OFF")));
+
+  return pragmas;
+}
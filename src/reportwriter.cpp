@@ -0,0 +1,235 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "jmbdemodels/reportwriter.h"
+
+#include <QDate>
+#include <QDateTime>
+#include <QDebug>
+#include <QSqlRecord>
+
+#include <cmath>
+
+Model::ReportWriter::ReportWriter(QIODevice *device, Format format)
+    : m_stream(device), m_format(format) {
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+  m_stream.setEncoding(QStringConverter::Utf8);
+#else
+  m_stream.setCodec("UTF-8");
+#endif
+}
+
+Model::ReportWriter::~ReportWriter() {
+  if (this->m_begun && !this->m_finished) {
+    this->finish();
+  }
+}
+
+void Model::ReportWriter::begin(const QString &title,
+                                const QStringList &columns) {
+  this->m_columns = columns;
+  this->m_rows = 0;
+  this->m_begun = true;
+  this->m_finished = false;
+
+  switch (this->m_format) {
+  case Format::Html:
+    this->m_stream << "<h1>" << title.toHtmlEscaped() << "</h1>"
+                   << "<hr />"
+                   << R"(<table width="100%" cellspacing="0" class="tbl">)"
+                   << "<thead><tr>";
+    for (const auto &column : columns) {
+      this->m_stream << "<th>" << column.toHtmlEscaped() << "</th>";
+    }
+    this->m_stream << "</tr></thead>\n<tbody>\n";
+    break;
+  case Format::Csv:
+    for (int i = 0; i < columns.size(); ++i) {
+      if (i > 0) {
+        this->m_stream << ',';
+      }
+      this->m_stream << escapeCsv(columns.at(i));
+    }
+    this->m_stream << "\r\n";
+    break;
+  case Format::Json:
+    this->m_stream << "[";
+    break;
+  }
+}
+
+void Model::ReportWriter::writeRow(const QVariantList &values) {
+  switch (this->m_format) {
+  case Format::Html:
+    this->m_stream << "<tr>";
+    for (const auto &value : values) {
+      this->m_stream << "<td>" << cellText(value).toHtmlEscaped() << "</td>";
+    }
+    this->m_stream << "</tr>\n";
+    break;
+  case Format::Csv:
+    for (int i = 0; i < values.size(); ++i) {
+      if (i > 0) {
+        this->m_stream << ',';
+      }
+      this->m_stream << escapeCsv(cellText(values.at(i)));
+    }
+    this->m_stream << "\r\n";
+    break;
+  case Format::Json:
+    this->m_stream << (this->m_rows > 0 ? ",\n{" : "\n{");
+    for (int i = 0; i < values.size(); ++i) {
+      if (i > 0) {
+        this->m_stream << ',';
+      }
+      this->m_stream << '"' << escapeJson(this->m_columns.value(i)) << "\":"
+                     << jsonValue(values.at(i));
+    }
+    this->m_stream << '}';
+    break;
+  }
+
+  if (++this->m_rows % this->m_chunkRows == 0) {
+    this->m_stream.flush();
+  }
+}
+
+auto Model::ReportWriter::writeQuery(QSqlQuery &query) -> qint64 {
+  const auto start = this->m_rows;
+  const auto columns = query.record().count();
+
+  QVariantList values;
+  values.reserve(columns);
+  while (query.next()) {
+    values.clear();
+    for (int i = 0; i < columns; ++i) {
+      values.append(query.value(i));
+    }
+    this->writeRow(values);
+  }
+
+  return this->m_rows - start;
+}
+
+auto Model::ReportWriter::finish() -> bool {
+  switch (this->m_format) {
+  case Format::Html:
+    this->m_stream << "</tbody></table>\n";
+    break;
+  case Format::Csv:
+    break;
+  case Format::Json:
+    this->m_stream << "\n]\n";
+    break;
+  }
+  this->m_finished = true;
+  this->m_stream.flush();
+
+  if (this->m_stream.status() != QTextStream::Ok) {
+    qWarning() << tr("Fehler beim Schreiben des Berichts");
+    return false;
+  }
+  return true;
+}
+
+auto Model::ReportWriter::escapeCsv(const QString &value) -> QString {
+  const bool quote = value.contains(QLatin1Char(',')) ||
+                     value.contains(QLatin1Char('"')) ||
+                     value.contains(QLatin1Char('\n')) ||
+                     value.contains(QLatin1Char('\r')) ||
+                     value.startsWith(QLatin1Char(' ')) ||
+                     value.endsWith(QLatin1Char(' '));
+  if (!quote) {
+    return value;
+  }
+
+  auto escaped = value;
+  escaped.replace(QLatin1Char('"'), QLatin1String("\"\""));
+  return QLatin1Char('"') + escaped + QLatin1Char('"');
+}
+
+auto Model::ReportWriter::escapeJson(const QString &value) -> QString {
+  QString escaped;
+  escaped.reserve(value.size());
+
+  for (const auto c : value) {
+    switch (c.unicode()) {
+    case '"':
+      escaped += QLatin1String("\\\"");
+      break;
+    case '\\':
+      escaped += QLatin1String("\\\\");
+      break;
+    case '\b':
+      escaped += QLatin1String("\\b");
+      break;
+    case '\f':
+      escaped += QLatin1String("\\f");
+      break;
+    case '\n':
+      escaped += QLatin1String("\\n");
+      break;
+    case '\r':
+      escaped += QLatin1String("\\r");
+      break;
+    case '\t':
+      escaped += QLatin1String("\\t");
+      break;
+    default:
+      if (c.unicode() < 0x20) {
+        escaped += QStringLiteral("\\u%1").arg(c.unicode(), 4, 16,
+                                              QLatin1Char('0'));
+      } else {
+        escaped += c;
+      }
+      break;
+    }
+  }
+  return escaped;
+}
+
+auto Model::ReportWriter::cellText(const QVariant &value) -> QString {
+  if (value.isNull()) {
+    return {};
+  }
+
+  switch (value.userType()) {
+  case QMetaType::QDate:
+    return value.toDate().toString(Qt::ISODate);
+  case QMetaType::QDateTime:
+    return value.toDateTime().toString(Qt::ISODate);
+  case QMetaType::QByteArray:
+    return {};
+  default:
+    return value.toString();
+  }
+}
+
+auto Model::ReportWriter::jsonValue(const QVariant &value) -> QString {
+  if (value.isNull()) {
+    return QStringLiteral("null");
+  }
+
+  switch (value.userType()) {
+  case QMetaType::Bool:
+    return value.toBool() ? QStringLiteral("true") : QStringLiteral("false");
+  case QMetaType::Int:
+  case QMetaType::UInt:
+  case QMetaType::LongLong:
+  case QMetaType::ULongLong:
+    return value.toString();
+  case QMetaType::Double: {
+    const auto number = value.toDouble();
+    return std::isfinite(number) ? QString::number(number, 'g', 17)
+                                 : QStringLiteral("null");
+  }
+  case QMetaType::QByteArray:
+    return QStringLiteral("null");
+  default:
+    return QLatin1Char('"') + escapeJson(cellText(value)) + QLatin1Char('"');
+  }
+}
@@ -0,0 +1,216 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "jmbdemodels/searchindex.h"
+
+#include <QDebug>
+#include <QFile>
+#include <QRegularExpression>
+#include <QSqlError>
+#include <QSqlQuery>
+
+#include "jmbdemodels/datacontext.h"
+#include "jmbdemodels/transaction.h"
+
+namespace {
+/*!
+    \brief The columns of a source table that go into the index
+ */
+struct Source {
+  Model::SearchIndex::Kind kind;
+  const char *table;
+  const char *key;
+  const char *title;
+  const char *body;
+};
+
+constexpr Source sources[] = {
+    {Model::SearchIndex::Kind::Employee, "employee", "employee_id",
+     "coalesce(first_name, '') || ' ' || coalesce(last_name, '')",
+     "coalesce(business_mail_address, '') || ' ' || "
+     "coalesce(home_mail_address, '')"},
+    {Model::SearchIndex::Kind::Computer, "computer", "computer_id",
+     "coalesce(network_name, '')",
+     "coalesce(serial_number, '') || ' ' || coalesce(service_tag, '')"},
+    {Model::SearchIndex::Kind::Printer, "printer", "printer_id",
+     "coalesce(network_name, '')", "coalesce(serial_number, '')"},
+    {Model::SearchIndex::Kind::Software, "software", "software_id",
+     "coalesce(name, '')", "coalesce(version, '')"},
+    {Model::SearchIndex::Kind::Document, "document", "document_id",
+     "coalesce(name, '')", "''"},
+};
+} // namespace
+
+Model::SearchIndex::SearchIndex(const QSqlDatabase &db)
+    : m_db(db), m_statements(4) {}
+
+auto Model::SearchIndex::ensure() -> bool {
+  QSqlQuery query(this->m_db);
+  const auto exists =
+      this->isPostgres()
+          ? query.exec(QStringLiteral(
+                "SELECT to_regclass('search_index') IS NOT NULL")) &&
+                query.next() && query.value(0).toBool()
+          : query.exec(QStringLiteral("SELECT 1 FROM sqlite_master WHERE "
+                                      "name = 'search_index'")) &&
+                query.next();
+  query.finish();
+
+  // The script only adds what is missing
+  if (!this->runScript(this->isPostgres()
+                           ? QStringLiteral(":/data/search_pgsql.sql")
+                           : QStringLiteral(":/data/search_sqlite.sql"))) {
+    return false;
+  }
+  return exists || this->rebuild();
+}
+
+auto Model::SearchIndex::rebuild() -> bool {
+  Transaction transaction(this->m_db);
+  const auto key = QLatin1String(this->isPostgres() ? "id" : "rowid");
+
+  QSqlQuery query(this->m_db);
+  auto ok = query.exec(QStringLiteral("DELETE FROM search_index"));
+  for (const auto &source : sources) {
+    if (!ok) {
+      break;
+    }
+    ok = query.exec(QStringLiteral("INSERT INTO search_index (%1, title, body) "
+                                   "SELECT %2 * 8 + %3, %4, %5 FROM %6")
+                        .arg(key, QLatin1String(source.key))
+                        .arg(static_cast<int>(source.kind))
+                        .arg(QLatin1String(source.title),
+                             QLatin1String(source.body),
+                             QLatin1String(source.table)));
+  }
+
+  if (!ok) {
+    this->m_error = query.lastError().text();
+    qWarning() << tr("Fehler beim Aufbau des Suchindex: ") << this->m_error;
+    transaction.rollback();
+    return false;
+  }
+  if (transaction.isActive() && !transaction.commit()) {
+    this->m_error = transaction.lastError();
+    return false;
+  }
+  this->m_error.clear();
+  return true;
+}
+
+auto Model::SearchIndex::search(const QString &text, Kind kind, int limit)
+    -> QVector<Hit> {
+  QVector<Hit> hits;
+  this->m_error.clear();
+
+  const auto postgres = this->isPostgres();
+  const auto expression = matchExpression(text, postgres);
+  if (expression.isEmpty()) {
+    return hits;
+  }
+
+  const auto filterKind = kind != Kind::All;
+  const auto key =
+      filterKind ? QStringLiteral("SEARCH|KIND") : QStringLiteral("SEARCH");
+  QSqlQuery *query = nullptr;
+  if (postgres) {
+    query = this->m_statements.prepare(
+        this->m_db, key,
+        QStringLiteral("SELECT id, title, ts_rank(document, query) AS rank "
+                       "FROM search_index, to_tsquery('simple', ?) query "
+                       "WHERE document @@ query %1"
+                       "ORDER BY rank DESC LIMIT ?")
+            .arg(filterKind ? QStringLiteral("AND id % 8 = ? ") : QString()));
+  } else {
+    // The title counts ten times as much as the body
+    query = this->m_statements.prepare(
+        this->m_db, key,
+        QStringLiteral("SELECT rowid, title, -bm25(search_index, 10.0, 1.0) "
+                       "FROM search_index WHERE search_index MATCH ? %1"
+                       "ORDER BY bm25(search_index, 10.0, 1.0) LIMIT ?")
+            .arg(filterKind ? QStringLiteral("AND rowid % 8 = ? ")
+                            : QString()));
+  }
+  if (query == nullptr) {
+    this->m_error = tr("Der Suchindex ist nicht vorhanden");
+    return hits;
+  }
+
+  int position = 0;
+  query->bindValue(position++, expression);
+  if (filterKind) {
+    query->bindValue(position++, static_cast<int>(kind));
+  }
+  query->bindValue(position, qMax(1, limit));
+
+  if (!query->exec()) {
+    this->m_error = query->lastError().text();
+    return hits;
+  }
+  while (query->next()) {
+    const auto id = query->value(0).toLongLong();
+    hits.append({static_cast<Kind>(id % 8), id / 8, query->value(1).toString(),
+                 query->value(2).toDouble()});
+  }
+  query->finish();
+  return hits;
+}
+
+auto Model::SearchIndex::matchExpression(const QString &text, bool postgres)
+    -> QString {
+  static const QRegularExpression separators(
+      QStringLiteral("[^\\w]+|_"),
+      QRegularExpression::UseUnicodePropertiesOption);
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+  const auto words = text.split(separators, Qt::SkipEmptyParts);
+#else
+  const auto words = text.split(separators, QString::SkipEmptyParts);
+#endif
+
+  QStringList terms;
+  for (const auto &word : words) {
+    // FTS5: "word"* , tsquery: word:*
+    terms.append(postgres ? word + QLatin1String(":*")
+                          : QLatin1Char('"') + word + QLatin1String("\"*"));
+  }
+  return terms.join(postgres ? QLatin1String(" & ") : QLatin1String(" "));
+}
+
+auto Model::SearchIndex::runScript(const QString &fileName) -> bool {
+  QFile file(fileName);
+  if (!file.open(QIODevice::ReadOnly)) {
+    this->m_error = tr("Die Datei %1 kann nicht geöffnet werden").arg(fileName);
+    qWarning() << this->m_error;
+    return false;
+  }
+
+  const auto statements =
+      DataContext::splitStatements(QString::fromUtf8(file.readAll()));
+  Transaction transaction(this->m_db);
+
+  QSqlQuery query(this->m_db);
+  for (const auto &statement : statements) {
+    if (!query.exec(statement)) {
+      this->m_error = query.lastError().text();
+      qWarning() << tr("Fehler beim Anlegen des Suchindex: ") << statement
+                 << " : " << this->m_error;
+      transaction.rollback();
+      return false;
+    }
+  }
+
+  if (transaction.isActive() && !transaction.commit()) {
+    this->m_error = transaction.lastError();
+    return false;
+  }
+  return true;
+}
+
+auto Model::SearchIndex::isPostgres() const -> bool {
+  return this->m_db.driverName() == QLatin1String("QPSQL");
+}
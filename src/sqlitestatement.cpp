@@ -0,0 +1,378 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "jmbdemodels/sqlitestatement.h"
+
+#include <QSqlDriver>
+
+#include <utility>
+
+#ifdef WITH_SQLITE3
+#include <sqlite3.h>
+
+namespace {
+auto handleOf(const QSqlDatabase &db) -> sqlite3 * {
+  if (db.driverName() != QLatin1String("QSQLITE") || !db.isOpen()) {
+    return nullptr;
+  }
+
+  const auto handle = db.driver()->handle();
+  if (!handle.isValid() || qstrcmp(handle.typeName(), "sqlite3*") != 0) {
+    return nullptr;
+  }
+  return *static_cast<sqlite3 *const *>(handle.data());
+}
+} // namespace
+
+auto Model::SqliteStatement::isSupported(const QSqlDatabase &db) -> bool {
+  return handleOf(db) != nullptr;
+}
+
+Model::SqliteStatement::SqliteStatement(const QSqlDatabase &db,
+                                        const QString &sql) {
+  auto *handle = handleOf(db);
+  if (handle == nullptr) {
+    this->m_error = QLatin1String("Keine SQLite Verbindung");
+    return;
+  }
+  this->m_handle = handle;
+
+  const auto utf8 = sql.toUtf8();
+  sqlite3_stmt *statement = nullptr;
+  if (sqlite3_prepare_v2(handle, utf8.constData(), utf8.size(), &statement,
+                         nullptr) != SQLITE_OK) {
+    this->setError();
+    return;
+  }
+  this->m_statement = statement;
+}
+
+Model::SqliteStatement::~SqliteStatement() {
+  sqlite3_finalize(static_cast<sqlite3_stmt *>(this->m_statement));
+}
+
+auto Model::SqliteStatement::bind(int index, const QVariant &value) -> bool {
+  auto *statement = static_cast<sqlite3_stmt *>(this->m_statement);
+  int result = SQLITE_MISUSE;
+
+  // sqlite3 counts the placeholders from 1
+  ++index;
+
+  if (value.isNull()) {
+    result = sqlite3_bind_null(statement, index);
+  } else {
+    switch (value.userType()) {
+    case QMetaType::Bool:
+    case QMetaType::Int:
+    case QMetaType::UInt:
+    case QMetaType::LongLong:
+    case QMetaType::ULongLong:
+      result = sqlite3_bind_int64(statement, index, value.toLongLong());
+      break;
+    case QMetaType::Double:
+    case QMetaType::Float:
+      result = sqlite3_bind_double(statement, index, value.toDouble());
+      break;
+    case QMetaType::QByteArray: {
+      const auto data = value.toByteArray();
+      result = sqlite3_bind_blob(statement, index, data.constData(),
+                                 data.size(), SQLITE_TRANSIENT);
+      break;
+    }
+    default: {
+      const auto text = value.toString().toUtf8();
+      result = sqlite3_bind_text(statement, index, text.constData(),
+                                 text.size(), SQLITE_TRANSIENT);
+      break;
+    }
+    }
+  }
+
+  if (result != SQLITE_OK) {
+    this->setError();
+    return false;
+  }
+  return true;
+}
+
+auto Model::SqliteStatement::next() -> bool {
+  const auto result =
+      sqlite3_step(static_cast<sqlite3_stmt *>(this->m_statement));
+  if (result == SQLITE_ROW) {
+    return true;
+  }
+  if (result != SQLITE_DONE) {
+    this->setError();
+  }
+  return false;
+}
+
+auto Model::SqliteStatement::isNull(int column) const -> bool {
+  return sqlite3_column_type(static_cast<sqlite3_stmt *>(this->m_statement),
+                             column) == SQLITE_NULL;
+}
+
+auto Model::SqliteStatement::toInt64(int column) const -> qint64 {
+  return sqlite3_column_int64(static_cast<sqlite3_stmt *>(this->m_statement),
+                              column);
+}
+
+auto Model::SqliteStatement::toDouble(int column) const -> double {
+  return sqlite3_column_double(static_cast<sqlite3_stmt *>(this->m_statement),
+                               column);
+}
+
+auto Model::SqliteStatement::toString(int column) const -> QString {
+  auto *statement = static_cast<sqlite3_stmt *>(this->m_statement);
+  const auto *text =
+      reinterpret_cast<const char *>(sqlite3_column_text(statement, column));
+  if (text == nullptr) {
+    return {};
+  }
+  return QString::fromUtf8(text, sqlite3_column_bytes(statement, column));
+}
+
+auto Model::SqliteStatement::toByteArray(int column) const -> QByteArray {
+  auto *statement = static_cast<sqlite3_stmt *>(this->m_statement);
+  const auto *data =
+      static_cast<const char *>(sqlite3_column_blob(statement, column));
+  if (data == nullptr) {
+    return {};
+  }
+  return QByteArray(data, sqlite3_column_bytes(statement, column));
+}
+
+void Model::SqliteStatement::setError() {
+  this->m_error = QString::fromUtf8(
+      sqlite3_errmsg(static_cast<sqlite3 *>(this->m_handle)));
+}
+
+Model::SqliteBlob::SqliteBlob(const QSqlDatabase &db, const QString &table,
+                              const QString &column, qint64 rowId,
+                              bool writable) {
+  auto *handle = handleOf(db);
+  if (handle == nullptr) {
+    this->m_error = QLatin1String("Keine SQLite Verbindung");
+    return;
+  }
+  this->m_handle = handle;
+
+  sqlite3_blob *blob = nullptr;
+  if (sqlite3_blob_open(handle, "main", table.toUtf8().constData(),
+                        column.toUtf8().constData(), rowId, writable ? 1 : 0,
+                        &blob) != SQLITE_OK) {
+    this->setError();
+    sqlite3_blob_close(blob);
+    return;
+  }
+  this->m_blob = blob;
+}
+
+Model::SqliteBlob::~SqliteBlob() {
+  sqlite3_blob_close(static_cast<sqlite3_blob *>(this->m_blob));
+}
+
+auto Model::SqliteBlob::size() const -> int {
+  return sqlite3_blob_bytes(static_cast<sqlite3_blob *>(this->m_blob));
+}
+
+auto Model::SqliteBlob::read(int offset, char *data, int length) -> bool {
+  if (sqlite3_blob_read(static_cast<sqlite3_blob *>(this->m_blob), data,
+                        length, offset) != SQLITE_OK) {
+    this->setError();
+    return false;
+  }
+  return true;
+}
+
+auto Model::SqliteBlob::write(int offset, const char *data, int length)
+    -> bool {
+  if (sqlite3_blob_write(static_cast<sqlite3_blob *>(this->m_blob), data,
+                         length, offset) != SQLITE_OK) {
+    this->setError();
+    return false;
+  }
+  return true;
+}
+
+void Model::SqliteBlob::setError() {
+  this->m_error = QString::fromUtf8(
+      sqlite3_errmsg(static_cast<sqlite3 *>(this->m_handle)));
+}
+
+Model::SqliteUpdateHook::SqliteUpdateHook(const QSqlDatabase &db,
+                                          std::function<void()> committed)
+    : m_committed(std::move(committed)) {
+  auto *handle = handleOf(db);
+  if (handle == nullptr) {
+    return;
+  }
+  this->m_handle = handle;
+
+  sqlite3_update_hook(handle, &SqliteUpdateHook::onUpdate, this);
+  sqlite3_commit_hook(handle, &SqliteUpdateHook::onCommit, this);
+  sqlite3_rollback_hook(handle, &SqliteUpdateHook::onRollback, this);
+}
+
+Model::SqliteUpdateHook::~SqliteUpdateHook() {
+  auto *handle = static_cast<sqlite3 *>(this->m_handle);
+  if (handle != nullptr) {
+    sqlite3_update_hook(handle, nullptr, nullptr);
+    sqlite3_commit_hook(handle, nullptr, nullptr);
+    sqlite3_rollback_hook(handle, nullptr, nullptr);
+  }
+}
+
+auto Model::SqliteUpdateHook::takeCommitted() -> Committed {
+  Committed committed;
+  for (const auto &changes : this->m_done) {
+    if (changes.overflow) {
+      committed.tables.append(changes.table);
+    } else {
+      committed.rows += changes.rows;
+    }
+  }
+  this->m_done.clear();
+  return committed;
+}
+
+void Model::SqliteUpdateHook::onUpdate(void *self, int operation,
+                                       const char *, const char *table,
+                                       long long rowId) {
+  auto *hook = static_cast<SqliteUpdateHook *>(self);
+  auto &changes = find(hook->m_pending, table);
+  if (changes.overflow) {
+    return;
+  }
+  if (changes.rows.size() >= hook->m_rowLimit) {
+    changes.overflow = true;
+    changes.rows = {};
+    return;
+  }
+
+  const auto kind = operation == SQLITE_INSERT   ? RowOperation::Insert
+                    : operation == SQLITE_DELETE ? RowOperation::Delete
+                                                 : RowOperation::Update;
+  changes.rows.append({changes.table, rowId, kind});
+}
+
+auto Model::SqliteUpdateHook::onCommit(void *self) -> int {
+  auto *hook = static_cast<SqliteUpdateHook *>(self);
+  if (!hook->m_pending.isEmpty()) {
+    for (const auto &changes : hook->m_pending) {
+      hook->merge(find(hook->m_done, changes.name.constData()), changes);
+    }
+    hook->m_pending.clear();
+    if (hook->m_committed) {
+      hook->m_committed();
+    }
+  }
+  // 0 lets the commit go on
+  return 0;
+}
+
+void Model::SqliteUpdateHook::onRollback(void *self) {
+  static_cast<SqliteUpdateHook *>(self)->m_pending.clear();
+}
+
+#else
+
+// Without WITH_SQLITE3 every caller takes the QSqlQuery path
+
+auto Model::SqliteStatement::isSupported(const QSqlDatabase &) -> bool {
+  return false;
+}
+
+Model::SqliteStatement::SqliteStatement(const QSqlDatabase &,
+                                        const QString &)
+    : m_error(QLatin1String("Ohne WITH_SQLITE3 gebaut")) {}
+
+Model::SqliteStatement::~SqliteStatement() = default;
+
+auto Model::SqliteStatement::bind(int, const QVariant &) -> bool {
+  return false;
+}
+
+auto Model::SqliteStatement::next() -> bool { return false; }
+
+auto Model::SqliteStatement::isNull(int) const -> bool { return true; }
+
+auto Model::SqliteStatement::toInt64(int) const -> qint64 { return 0; }
+
+auto Model::SqliteStatement::toDouble(int) const -> double { return 0.0; }
+
+auto Model::SqliteStatement::toString(int) const -> QString { return {}; }
+
+auto Model::SqliteStatement::toByteArray(int) const -> QByteArray {
+  return {};
+}
+
+void Model::SqliteStatement::setError() {}
+
+Model::SqliteBlob::SqliteBlob(const QSqlDatabase &, const QString &,
+                              const QString &, qint64, bool)
+    : m_error(QLatin1String("Ohne WITH_SQLITE3 gebaut")) {}
+
+Model::SqliteBlob::~SqliteBlob() = default;
+
+auto Model::SqliteBlob::size() const -> int { return 0; }
+
+auto Model::SqliteBlob::read(int, char *, int) -> bool { return false; }
+
+auto Model::SqliteBlob::write(int, const char *, int) -> bool {
+  return false;
+}
+
+void Model::SqliteBlob::setError() {}
+
+Model::SqliteUpdateHook::SqliteUpdateHook(const QSqlDatabase &,
+                                          std::function<void()> committed)
+    : m_committed(std::move(committed)) {}
+
+Model::SqliteUpdateHook::~SqliteUpdateHook() = default;
+
+auto Model::SqliteUpdateHook::takeCommitted() -> Committed { return {}; }
+
+void Model::SqliteUpdateHook::onUpdate(void *, int, const char *,
+                                       const char *, long long) {}
+
+auto Model::SqliteUpdateHook::onCommit(void *) -> int { return 0; }
+
+void Model::SqliteUpdateHook::onRollback(void *) {}
+
+#endif
+
+auto Model::SqliteUpdateHook::find(QVector<TableChanges> &tables,
+                                   const char *name) -> TableChanges & {
+  // A transaction writes a few tables, the name is converted once per table
+  for (auto &changes : tables) {
+    if (changes.name == name) {
+      return changes;
+    }
+  }
+
+  TableChanges changes;
+  changes.name = name;
+  changes.table = QString::fromUtf8(name);
+  tables.append(changes);
+  return tables.last();
+}
+
+void Model::SqliteUpdateHook::merge(TableChanges &into,
+                                    const TableChanges &from) const {
+  if (into.overflow) {
+    return;
+  }
+  if (from.overflow ||
+      into.rows.size() + from.rows.size() > this->m_rowLimit) {
+    into.overflow = true;
+    into.rows = {};
+    return;
+  }
+  into.rows += from.rows;
+}
+
@@ -0,0 +1,43 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "jmbdemodels/statementcache.h"
+
+#include <QDebug>
+#include <QSqlError>
+
+Model::StatementCache::StatementCache(int capacity)
+    : m_statements(qMax(1, capacity)) {}
+
+auto Model::StatementCache::prepare(const QSqlDatabase &db, const QString &key,
+                                    const QString &sql) -> QSqlQuery * {
+  auto *query = this->m_statements.object(key);
+  if (query != nullptr) {
+    ++this->m_hits;
+    return query;
+  }
+
+  ++this->m_misses;
+
+  query = new QSqlQuery(db);
+  if (!query->prepare(sql)) {
+    qWarning() << "Fehler beim Vorbereiten der Abfrage ( " << sql
+               << " ) : " << query->lastError().text();
+    delete query;
+    return nullptr;
+  }
+
+  this->m_statements.insert(key, query);
+
+  return query;
+}
+
+void Model::StatementCache::clear() { this->m_statements.clear(); }
+
+void Model::StatementCache::setCapacity(int capacity) {
+  this->m_statements.setMaxCost(qMax(1, capacity));
+}
@@ -0,0 +1,124 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "jmbdemodels/transaction.h"
+
+#include <QDebug>
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSqlDriver>
+#include <QSqlError>
+#include <QSqlQuery>
+
+namespace {
+// The active Transactions per connection name; every thread has its own
+// connections, the map is shared
+auto depths() -> QHash<QString, int> & {
+  static QHash<QString, int> map;
+  return map;
+}
+
+auto depthsMutex() -> QMutex & {
+  static QMutex mutex;
+  return mutex;
+}
+} // namespace
+
+Model::Transaction::Transaction(const QSqlDatabase &db) : m_db(db) {
+  if (!this->m_db.isOpen() ||
+      !this->m_db.driver()->hasFeature(QSqlDriver::Transactions)) {
+    return;
+  }
+
+  const auto level = depth(this->m_db);
+  if (level > 0 || !this->m_db.transaction()) {
+    // Inside a transaction of ours or of the caller
+    this->m_savepoint = QStringLiteral("jmbde_savepoint_%1").arg(level + 1);
+    QSqlQuery query(this->m_db);
+    if (!query.exec(QLatin1String("SAVEPOINT ") + this->m_savepoint)) {
+      this->m_error = query.lastError().text();
+      this->m_savepoint.clear();
+      qWarning() << tr("Die Transaktion kann nicht begonnen werden: ")
+                 << this->m_error;
+      return;
+    }
+  }
+
+  this->m_active = true;
+  QMutexLocker locker(&depthsMutex());
+  ++depths()[this->m_db.connectionName()];
+}
+
+Model::Transaction::~Transaction() {
+  if (this->m_active) {
+    this->rollback();
+  }
+}
+
+auto Model::Transaction::commit() -> bool {
+  if (!this->m_active) {
+    return false;
+  }
+
+  bool ok = false;
+  if (this->isNested()) {
+    QSqlQuery query(this->m_db);
+    ok = query.exec(QLatin1String("RELEASE SAVEPOINT ") + this->m_savepoint);
+    if (!ok) {
+      this->m_error = query.lastError().text();
+    }
+  } else {
+    ok = this->m_db.commit();
+    if (!ok) {
+      this->m_error = this->m_db.lastError().text();
+    }
+  }
+
+  if (!ok) {
+    qWarning() << tr("Fehler beim Abschluss der Transaktion: ")
+               << this->m_error;
+    this->rollback();
+    return false;
+  }
+
+  this->finish();
+  return true;
+}
+
+void Model::Transaction::rollback() {
+  if (!this->m_active) {
+    return;
+  }
+
+  if (this->isNested()) {
+    // The savepoint stays after ROLLBACK TO, it is released as well
+    QSqlQuery query(this->m_db);
+    query.exec(QLatin1String("ROLLBACK TO SAVEPOINT ") + this->m_savepoint);
+    query.exec(QLatin1String("RELEASE SAVEPOINT ") + this->m_savepoint);
+  } else {
+    this->m_db.rollback();
+  }
+
+  this->finish();
+}
+
+void Model::Transaction::finish() {
+  this->m_active = false;
+
+  QMutexLocker locker(&depthsMutex());
+  auto &map = depths();
+  const auto name = this->m_db.connectionName();
+  if (--map[name] <= 0) {
+    map.remove(name);
+  }
+}
+
+auto Model::Transaction::depth(const QSqlDatabase &db) -> int {
+  QMutexLocker locker(&depthsMutex());
+  return depths().value(db.connectionName());
+}
@@ -0,0 +1,157 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert
+ * <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "jmbdemodels/zipcitylookup.h"
+
+#include <QDebug>
+#include <QHash>
+
+#include <algorithm>
+#include <atomic>
+
+#include "jmbdemodels/rowmapper.h"
+
+namespace {
+auto sharedLookup() -> std::shared_ptr<const Model::ZipCityLookup> & {
+  static std::shared_ptr<const Model::ZipCityLookup> lookup =
+      std::make_shared<Model::ZipCityLookup>();
+  return lookup;
+}
+
+/*!
+    \brief The positions from the first key that starts with prefix
+ */
+template <typename Key>
+auto prefixRange(const std::vector<int> &positions, const QString &prefix,
+                 int limit, Key key) -> std::vector<int> {
+  auto it = std::lower_bound(
+      positions.cbegin(), positions.cend(), prefix,
+      [&key](int position, const QString &value) {
+        return key(position) < value;
+      });
+
+  std::vector<int> result;
+  for (; it != positions.cend() && int(result.size()) < limit &&
+         key(*it).startsWith(prefix);
+       ++it) {
+    result.push_back(*it);
+  }
+  return result;
+}
+} // namespace
+
+auto Model::ZipCityLookup::build(const QSqlDatabase &db, QString *error)
+    -> std::shared_ptr<const ZipCityLookup> {
+  RowReader<ZipCodeRow> codeReader(db);
+  RowReader<CityNameRow> cityReader(db);
+  RowReader<ZipCityRow> zipCityReader(db);
+
+  QHash<qint64, QString> codes;
+  QHash<qint64, QString> cities;
+  auto lookup = std::make_shared<ZipCityLookup>();
+
+  const auto ok =
+      codeReader.forEach([&codes](const ZipCodeRow &row) {
+        codes.insert(row.zipCodeId, row.code);
+      }) &&
+      cityReader.forEach([&cities](const CityNameRow &row) {
+        cities.insert(row.cityNameId, row.name);
+      }) &&
+      zipCityReader.forEach([&](const ZipCityRow &row) {
+        Entry entry;
+        entry.zipCityId = row.zipCityId;
+        entry.zipCodeId = row.zipCodeId.value_or(0);
+        entry.cityId = row.cityId.value_or(0);
+        entry.code = codes.value(entry.zipCodeId);
+        entry.city = cities.value(entry.cityId);
+        lookup->m_entries.push_back(std::move(entry));
+      });
+  if (!ok) {
+    const auto text = !codeReader.lastError().isEmpty()
+                          ? codeReader.lastError()
+                          : !cityReader.lastError().isEmpty()
+                                ? cityReader.lastError()
+                                : zipCityReader.lastError();
+    qWarning() << tr("Fehler beim Lesen der Postleitzahlen: ") << text;
+    if (error != nullptr) {
+      *error = text;
+    }
+    return nullptr;
+  }
+
+  auto &entries = lookup->m_entries;
+  std::sort(entries.begin(), entries.end(),
+            [](const Entry &left, const Entry &right) {
+              return left.zipCityId < right.zipCityId;
+            });
+
+  const auto count = static_cast<int>(entries.size());
+  lookup->m_cityKeys.reserve(entries.size());
+  lookup->m_byCode.reserve(entries.size());
+  for (int i = 0; i < count; ++i) {
+    lookup->m_cityKeys.push_back(entries[i].city.toCaseFolded());
+    lookup->m_byCode.push_back(i);
+  }
+  lookup->m_byCity = lookup->m_byCode;
+
+  std::sort(lookup->m_byCode.begin(), lookup->m_byCode.end(),
+            [&entries](int left, int right) {
+              return entries[left].code < entries[right].code;
+            });
+  const auto &keys = lookup->m_cityKeys;
+  std::sort(lookup->m_byCity.begin(), lookup->m_byCity.end(),
+            [&keys](int left, int right) { return keys[left] < keys[right]; });
+
+  return lookup;
+}
+
+auto Model::ZipCityLookup::shared() -> std::shared_ptr<const ZipCityLookup> {
+  return std::atomic_load(&sharedLookup());
+}
+
+auto Model::ZipCityLookup::reload(const QSqlDatabase &db) -> bool {
+  auto lookup = build(db);
+  if (lookup == nullptr) {
+    return false;
+  }
+  std::atomic_store(&sharedLookup(), std::move(lookup));
+  return true;
+}
+
+auto Model::ZipCityLookup::find(qint64 zipCityId) const -> const Entry * {
+  const auto it = std::lower_bound(
+      m_entries.cbegin(), m_entries.cend(), zipCityId,
+      [](const Entry &entry, qint64 id) { return entry.zipCityId < id; });
+  return it != m_entries.cend() && it->zipCityId == zipCityId ? &*it
+                                                                : nullptr;
+}
+
+auto Model::ZipCityLookup::byCode(const QString &prefix, int limit) const
+    -> QVector<Entry> {
+  QVector<Entry> result;
+  for (const auto position :
+       prefixRange(m_byCode, prefix, limit,
+                   [this](int i) -> const QString & {
+                     return m_entries[std::size_t(i)].code;
+                   })) {
+    result.append(m_entries[std::size_t(position)]);
+  }
+  return result;
+}
+
+auto Model::ZipCityLookup::byCity(const QString &prefix, int limit) const
+    -> QVector<Entry> {
+  QVector<Entry> result;
+  for (const auto position :
+       prefixRange(m_byCity, prefix.toCaseFolded(), limit,
+                   [this](int i) -> const QString & {
+                     return m_cityKeys[std::size_t(i)];
+                   })) {
+    result.append(m_entries[std::size_t(position)]);
+  }
+  return result;
+}
@@ -0,0 +1,327 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+// Benchmarks of the model library
+//
+//   jmbdemodels_bench [--rows N] [--blob-kib N] [--json FILE]
+//                     [--driver SQLITE|PGSQL --host H --port P
+//                      --user U --password PW --database NAME]
+//                     [QTest options]
+//
+// The database is filled with synthetic rows first. Every benchmark is a
+// QBENCHMARK; the results are written as JSON to FILE, or to stdout. For
+// PGSQL the schema of script.sql must exist in the database.
+
+#include <QBuffer>
+#include <QCoreApplication>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSqlRelation>
+#include <QSqlRelationalTableModel>
+#include <QTemporaryDir>
+#include <QXmlStreamReader>
+#include <QtTest>
+
+#include "jmbdemodels/blobstream.h"
+#include "jmbdemodels/datacontext.h"
+#include "jmbdemodels/employee.h"
+#include "jmbdemodels/schema.h"
+
+using namespace Model;
+
+namespace {
+struct BenchOptions {
+    int rows { 10000 };
+    int blobKiB { 1024 };
+    QString json;
+    QString driver { QStringLiteral("SQLITE") };
+    QString host;
+    QString user;
+    QString password;
+    QString database;
+    int port { 0 };
+};
+
+auto options() -> BenchOptions&
+{
+    static BenchOptions benchOptions;
+    return benchOptions;
+}
+
+const int departments = 50;
+const int titles = 10;
+}
+
+class bench_models : public QObject {
+    Q_OBJECT
+
+private:
+    QSharedPointer<DataContext> context;
+    QString databaseName;
+    int nextId { 0 };
+
+    auto fetchAll(QSqlTableModel* model) -> int
+    {
+        while (model->canFetchMore()) {
+            model->fetchMore();
+        }
+        return model->rowCount();
+    }
+
+private slots:
+    void initTestCase()
+    {
+        const auto& opts = options();
+        this->databaseName = opts.database.isEmpty()
+            ? QStringLiteral("jmbde_bench_%1").arg(QCoreApplication::applicationPid())
+            : opts.database;
+        this->context = QSharedPointer<DataContext>::create(
+            nullptr, this->databaseName, opts.driver, opts.user, opts.password, opts.host, opts.port);
+        QVERIFY(this->context->getDatabase().isOpen());
+
+        QVector<QVariantMap> rows;
+        for (int i = 1; i <= titles; ++i) {
+            rows.append({ { QStringLiteral("title_id"), i }, { QStringLiteral("name"), QStringLiteral("Title %1").arg(i) } });
+        }
+        QVERIFY(this->context->insertBatch(QStringLiteral("title"), rows).isValid());
+
+        rows.clear();
+        for (int i = 1; i <= departments; ++i) {
+            rows.append({ { QStringLiteral("department_id"), i },
+                { QStringLiteral("name"), QStringLiteral("Department %1").arg(i) }, { QStringLiteral("priority"), i % 5 } });
+        }
+        QVERIFY(this->context->insertBatch(QStringLiteral("department"), rows).isValid());
+
+        rows.clear();
+        rows.reserve(opts.rows);
+        for (int i = 1; i <= opts.rows; ++i) {
+            rows.append({ { QStringLiteral("employee_id"), i }, { QStringLiteral("employee_nr"), i },
+                { QStringLiteral("title_id"), 1 + i % titles }, { QStringLiteral("first_name"), QStringLiteral("First %1").arg(i) },
+                { QStringLiteral("last_name"), QStringLiteral("Last %1").arg(i) },
+                { QStringLiteral("department_id"), 1 + i % departments }, { QStringLiteral("active"), 1 } });
+        }
+        QVERIFY(this->context->insertBatch(QStringLiteral("employee"), rows).isValid());
+
+        QByteArray data(opts.blobKiB * 1024, '\0');
+        for (int i = 0; i < data.size(); ++i) {
+            data[i] = char(i % 251);
+        }
+        QVERIFY(this->context->insert(QStringLiteral("document"),
+            { { QStringLiteral("document_id"), 1 }, { QStringLiteral("name"), QStringLiteral("Bench") },
+                { QStringLiteral("document_data"), data } }));
+
+        this->nextId = opts.rows + 1;
+    }
+
+    void cleanupTestCase()
+    {
+        if (options().driver == QLatin1String("SQLITE")) {
+            this->context->deleteDB(this->databaseName);
+        }
+    }
+
+    void modelConstruction()
+    {
+        QBENCHMARK {
+            Employee employee(this->context);
+        }
+    }
+
+    void select()
+    {
+        Employee employee(this->context);
+        int rows = 0;
+        QBENCHMARK {
+            rows = this->fetchAll(employee.initializeViewModel());
+        }
+        QCOMPARE(rows, options().rows);
+    }
+
+    void relationalJoin()
+    {
+        QSqlRelationalTableModel model(nullptr, this->context->getDatabase());
+        model.setTable(QStringLiteral("employee"));
+        model.setRelation(Schema::Employee::TitleId, QSqlRelation(QStringLiteral("title"), QStringLiteral("title_id"), QStringLiteral("name")));
+        model.setRelation(Schema::Employee::DepartmentId,
+            QSqlRelation(QStringLiteral("department"), QStringLiteral("department_id"), QStringLiteral("name")));
+        int rows = 0;
+        QBENCHMARK {
+            QVERIFY(model.select());
+            rows = this->fetchAll(&model);
+        }
+        QCOMPARE(rows, options().rows);
+    }
+
+    void insert()
+    {
+        QBENCHMARK {
+            QVERIFY(this->context->insert(QStringLiteral("title"),
+                { { QStringLiteral("title_id"), this->nextId }, { QStringLiteral("name"), QStringLiteral("Insert") } }));
+            ++this->nextId;
+        }
+    }
+
+    void insertBatch()
+    {
+        QBENCHMARK {
+            QVector<QVariantMap> rows;
+            rows.reserve(1000);
+            for (int i = 0; i < 1000; ++i, ++this->nextId) {
+                rows.append({ { QStringLiteral("title_id"), this->nextId }, { QStringLiteral("name"), QStringLiteral("Batch") } });
+            }
+            QVERIFY(this->context->insertBatch(QStringLiteral("title"), rows).isValid());
+        }
+    }
+
+    void checkExistence()
+    {
+        const auto search = QString::number(options().rows / 2);
+        QBENCHMARK {
+            QVERIFY(this->context->checkExistence(QStringLiteral("employee"), QStringLiteral("employee_nr"), search));
+        }
+    }
+
+    void reportGeneration()
+    {
+        Employee employee(this->context);
+        QBENCHMARK {
+            QBuffer buffer;
+            buffer.open(QIODevice::WriteOnly);
+            QVERIFY(employee.writeReport(&buffer, ReportWriter::Format::Html, QStringLiteral("Employees")));
+        }
+    }
+
+    void blobRead()
+    {
+        BlobStream blob(this->context->getDatabase(), Schema::Document::Table, Schema::Document::DocumentData);
+        QBENCHMARK {
+            QBuffer buffer;
+            buffer.open(QIODevice::WriteOnly);
+            QCOMPARE(blob.read(1, &buffer), qint64(options().blobKiB) * 1024);
+        }
+    }
+
+    void blobWrite()
+    {
+        BlobStream blob(this->context->getDatabase(), Schema::Document::Table, Schema::Document::DocumentData);
+        QByteArray data(options().blobKiB * 1024, 'x');
+        QBENCHMARK {
+            QBuffer buffer(&data);
+            buffer.open(QIODevice::ReadOnly);
+            QVERIFY(blob.write(1, &buffer));
+        }
+    }
+};
+
+namespace {
+// The BenchmarkResult elements of the QTest XML log as JSON
+auto toJson(const QString& xmlFile) -> QJsonArray
+{
+    QJsonArray results;
+    QFile file(xmlFile);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return results;
+    }
+
+    QXmlStreamReader xml(&file);
+    QString function;
+    while (!xml.atEnd()) {
+        if (xml.readNext() != QXmlStreamReader::StartElement) {
+            continue;
+        }
+        const auto attributes = xml.attributes();
+        if (xml.name() == QLatin1String("TestFunction")) {
+            function = attributes.value(QLatin1String("name")).toString();
+        } else if (xml.name() == QLatin1String("BenchmarkResult")) {
+            const auto value = attributes.value(QLatin1String("value")).toDouble();
+            const auto iterations = attributes.value(QLatin1String("iterations")).toInt();
+            results.append(QJsonObject {
+                { QStringLiteral("name"), function },
+                { QStringLiteral("tag"), attributes.value(QLatin1String("tag")).toString() },
+                { QStringLiteral("metric"), attributes.value(QLatin1String("metric")).toString() },
+                { QStringLiteral("value"), value },
+                { QStringLiteral("iterations"), iterations },
+                { QStringLiteral("perIteration"), iterations > 0 ? value / iterations : value } });
+        }
+    }
+    return results;
+}
+}
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationName(QStringLiteral("jmbdemodels_bench"));
+
+    // Our options are taken out, the rest goes to QTest
+    auto& opts = options();
+    QStringList testArguments { app.arguments().first() };
+    const auto arguments = app.arguments();
+    for (int i = 1; i < arguments.size(); ++i) {
+        const auto& argument = arguments.at(i);
+        const auto value = i + 1 < arguments.size() ? arguments.at(i + 1) : QString();
+        if (argument == QLatin1String("--rows")) {
+            opts.rows = qMax(1, value.toInt());
+        } else if (argument == QLatin1String("--blob-kib")) {
+            opts.blobKiB = qMax(1, value.toInt());
+        } else if (argument == QLatin1String("--json")) {
+            opts.json = value;
+        } else if (argument == QLatin1String("--driver")) {
+            opts.driver = value.toUpper();
+        } else if (argument == QLatin1String("--host")) {
+            opts.host = value;
+        } else if (argument == QLatin1String("--port")) {
+            opts.port = value.toInt();
+        } else if (argument == QLatin1String("--user")) {
+            opts.user = value;
+        } else if (argument == QLatin1String("--password")) {
+            opts.password = value;
+        } else if (argument == QLatin1String("--database")) {
+            opts.database = value;
+        } else {
+            testArguments.append(argument);
+            continue;
+        }
+        ++i;
+    }
+
+    QTemporaryDir directory;
+    const auto xmlFile = directory.filePath(QStringLiteral("bench.xml"));
+    testArguments << QStringLiteral("-o") << xmlFile + QLatin1String(",xml");
+    // Without --json stdout gets the JSON only
+    if (!opts.json.isEmpty()) {
+        testArguments << QStringLiteral("-o") << QStringLiteral("-,txt");
+    }
+
+    bench_models bench;
+    const auto failures = QTest::qExec(&bench, testArguments);
+
+    const QJsonObject report {
+        { QStringLiteral("driver"), opts.driver },
+        { QStringLiteral("rows"), opts.rows },
+        { QStringLiteral("blobKiB"), opts.blobKiB },
+        { QStringLiteral("qt"), QLatin1String(qVersion()) },
+        { QStringLiteral("failures"), failures },
+        { QStringLiteral("results"), toJson(xmlFile) }
+    };
+    const auto json = QJsonDocument(report).toJson();
+
+    if (opts.json.isEmpty()) {
+        QTextStream(stdout) << json;
+    } else {
+        QFile file(opts.json);
+        if (!file.open(QIODevice::WriteOnly) || file.write(json) != json.size()) {
+            qCritical() << "Can't write" << opts.json;
+            return 1;
+        }
+    }
+
+    return failures;
+}
+
+#include "bench_models.moc"
@@ -0,0 +1,108 @@
+/*
+ *  SPDX-FileCopyrightText: 2013-2021 Jürgen Mülbert <juergen.muelbert@gmail.com>
+ *
+ *  SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+// Fills a database with synthetic data for benchmarks and load tests
+//
+//   jmbdemodels_generate --database loadtest --employees 100000
+//                        --devices 500000 --software-per-computer 10
+//                        --skew 1.2 --seed 42
+//
+// The SQLite database is created in the data directory of the application
+// like every DataContext database. The same seed gives the same rows.
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QTextStream>
+
+#include "jmbdemodels/datacontext.h"
+#include "jmbdemodels/datagenerator.h"
+
+using namespace Model;
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+    app.setApplicationName(QStringLiteral("jmbdemodels_generate"));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("Fills a jmbde database with synthetic data"));
+    parser.addHelpOption();
+
+    const QCommandLineOption database(QStringLiteral("database"), QStringLiteral("Name of the database"),
+        QStringLiteral("name"), QStringLiteral("jmbde_generated"));
+    const QCommandLineOption driver(
+        QStringLiteral("driver"), QStringLiteral("SQLITE or PGSQL"), QStringLiteral("driver"), QStringLiteral("SQLITE"));
+    const QCommandLineOption host(QStringLiteral("host"), QStringLiteral("Database server"), QStringLiteral("host"));
+    const QCommandLineOption port(QStringLiteral("port"), QStringLiteral("Database port"), QStringLiteral("port"), QStringLiteral("0"));
+    const QCommandLineOption user(QStringLiteral("user"), QStringLiteral("Database user"), QStringLiteral("user"));
+    const QCommandLineOption password(QStringLiteral("password"), QStringLiteral("Database password"), QStringLiteral("password"));
+    const QCommandLineOption seed(QStringLiteral("seed"), QStringLiteral("Seed of the generator"), QStringLiteral("n"), QStringLiteral("1"));
+    const QCommandLineOption employees(QStringLiteral("employees"), QStringLiteral("Number of employees"), QStringLiteral("n"),
+        QStringLiteral("1000"));
+    const QCommandLineOption devices(QStringLiteral("devices"), QStringLiteral("Number of computers, phones, mobiles, printers and faxes"),
+        QStringLiteral("n"), QStringLiteral("5000"));
+    const QCommandLineOption softwarePerComputer(QStringLiteral("software-per-computer"),
+        QStringLiteral("computer_software rows per computer"), QStringLiteral("n"), QStringLiteral("10"));
+    const QCommandLineOption skew(QStringLiteral("skew"), QStringLiteral("Zipf exponent of the references to lookup tables, 0 for uniform"),
+        QStringLiteral("s"), QStringLiteral("1.0"));
+    const QCommandLineOption batchSize(
+        QStringLiteral("batch-size"), QStringLiteral("Rows per transaction"), QStringLiteral("n"), QStringLiteral("1000"));
+    const QCommandLineOption threads(
+        QStringLiteral("threads"), QStringLiteral("Threads that build rows, 0 for one per core"), QStringLiteral("n"), QStringLiteral("0"));
+    const QCommandLineOption count(QStringLiteral("count"), QStringLiteral("Rows of one table, e.g. department=500; repeatable"),
+        QStringLiteral("table=n"));
+    parser.addOptions({ database, driver, host, port, user, password, seed, employees, devices, softwarePerComputer, skew,
+        batchSize, threads, count });
+    parser.process(app);
+
+    DataGenerator::Options options;
+    options.seed = parser.value(seed).toULongLong();
+    options.employees = parser.value(employees).toInt();
+    options.devices = parser.value(devices).toInt();
+    options.softwarePerComputer = parser.value(softwarePerComputer).toInt();
+    options.skew = parser.value(skew).toDouble();
+    options.batchSize = parser.value(batchSize).toInt();
+    options.threads = parser.value(threads).toInt();
+    for (const auto& value : parser.values(count)) {
+        const auto parts = value.split(QLatin1Char('='));
+        bool ok = false;
+        const auto rows = parts.size() == 2 ? parts.at(1).toInt(&ok) : 0;
+        if (!ok) {
+            qCritical() << "Invalid --count" << value;
+            return 2;
+        }
+        options.counts.insert(parts.at(0), rows);
+    }
+
+    DataContext context(nullptr, parser.value(database), parser.value(driver).toUpper(), parser.value(user),
+        parser.value(password), parser.value(host), parser.value(port).toInt());
+    if (!context.getDatabase().isOpen()) {
+        qCritical() << "Can't open the database" << parser.value(database);
+        return 1;
+    }
+
+    QTextStream out(stdout);
+    DataGenerator generator(options);
+    generator.setProgress([&out](const QString& table, qint64 written, qint64 total) {
+        if (written == total) {
+            out << table << ": " << total << " rows\n";
+            out.flush();
+        }
+    });
+
+    QElapsedTimer timer;
+    timer.start();
+    if (!generator.run(context)) {
+        qCritical() << generator.lastError();
+        return 1;
+    }
+
+    const auto seconds = qMax<qint64>(1, timer.elapsed()) / 1000.0;
+    out << generator.rowsWritten() << " rows in " << seconds << " s, "
+        << qRound64(generator.rowsWritten() / seconds) << " rows/s\n";
+    return 0;
+}
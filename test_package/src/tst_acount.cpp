@@ -4,7 +4,7 @@
  *  SPDX-License-Identifier: GPL-3.0-or-later
  */
 
-#include <models/datacontext.h>
+#include "jmbdemodels/datacontext.h"
 
 #include <QCoreApplication>
 #include <QLibrary>
@@ -12,11 +12,12 @@
 #include <QSqlDatabase>
 #include <QSqlError>
 #include <QSqlQuery>
+#include <QSqlRecord>
 #include <QString>
 #include <QTemporaryDir>
 #include <QtTest>
 
-#include "models/account.h"
+#include "jmbdemodels/account.h"
 
 using namespace Model;
 
@@ -59,6 +60,9 @@ private slots:
     void GetPasswordIndex();
     void GetSystemDataIndex();
     void GetLastUpdateIndex();
+    void ItemModel();
+    void Release();
+    void TableDescriptor();
 };
 
 void Account_Test::SetIndexes()
@@ -107,6 +111,61 @@ void Account_Test::GetLastUpdateIndex()
 {
 }
 
+void Account_Test::ItemModel()
+{
+    auto accountModel = m_Account->initializeRelationalModel();
+
+    QCOMPARE(m_Account->columnCount(), accountModel->columnCount());
+    QCOMPARE(m_Account->rowCount(), accountModel->rowCount());
+
+    const auto roles = m_Account->roleNames();
+    QCOMPARE(roles.value(Qt::UserRole + 1 + accountModel->fieldIndex(QLatin1String("user_name"))), QByteArray("user_name"));
+    QVERIFY(!roles.contains(Qt::UserRole + 1 + accountModel->columnCount()));
+}
+
+void Account_Test::Release()
+{
+    auto first = m_Account->initializeRelationalModel();
+    auto second = m_Account->initializeRelationalModel();
+    QCOMPARE(first, second);
+    QCOMPARE(m_Account->initializeListModel(), m_Account->initializeListModel());
+
+    QVERIFY(m_Account->release());
+    QCOMPARE(first->rowCount(), 0);
+    QCOMPARE(first->tableName(), QLatin1String("account"));
+
+    // Pending changes keep the model as it is
+    QVERIFY(first->select());
+    const auto rows = first->rowCount();
+    QVERIFY(first->insertRow(rows));
+    QVERIFY(!m_Account->release());
+    QVERIFY(first->isDirty());
+    QCOMPARE(first->rowCount(), rows + 1);
+    first->revertAll();
+    QVERIFY(m_Account->release());
+}
+
+void Account_Test::TableDescriptor()
+{
+    static_assert(Schema::Account::Table.indexOf("user_name") == Schema::Account::UserName);
+
+    auto accountModel = m_Account->initializeRelationalModel();
+    QCOMPARE(m_Account->getTableName(), QLatin1String("account"));
+    QCOMPARE(m_Account->getUserNameIndex(), accountModel->fieldIndex(QLatin1String("user_name")));
+    QCOMPARE(m_Account->getSystemDataIndex(), m_Account->getDB().record(QLatin1String("account")).indexOf(QLatin1String("system_data_id")));
+
+    // The foreign key of the descriptor is a relation of the model
+    const auto relation = accountModel->relation(m_Account->getSystemDataIndex());
+    QVERIFY(relation.isValid());
+    QCOMPARE(relation.tableName(), QLatin1String("system_data"));
+    QCOMPARE(relation.indexColumn(), QLatin1String("system_data_id"));
+    QCOMPARE(relation.displayColumn(), QLatin1String("name"));
+
+    // A second instance shares the indexes of the first
+    Account other;
+    QCOMPARE(other.getLastUpdateIndex(), m_Account->getLastUpdateIndex());
+}
+
 QTEST_GUILESS_MAIN(Account_Test)
 
 #include "tst_acount.moc"
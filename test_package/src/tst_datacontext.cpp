@@ -4,17 +4,36 @@
  *  SPDX-License-Identifier: GPL-3.0-or-later
  */
 
+#include <QBuffer>
 #include <QCoreApplication>
+#include <QFile>
 #include <QLibrary>
 #include <QObject>
+#include <QSemaphore>
 #include <QSqlDatabase>
 #include <QSqlError>
 #include <QSqlQuery>
+#include <QSqlRecord>
 #include <QString>
 #include <QTemporaryDir>
 #include <QtTest>
 
-#include "models/datacontext.h"
+#include <iterator>
+
+#include "jmbdemodels/accessresolver.h"
+#include "jmbdemodels/blobstream.h"
+#include "jmbdemodels/changenotifier.h"
+#include "jmbdemodels/columnarsnapshot.h"
+#include "jmbdemodels/datacontext.h"
+#include "jmbdemodels/datagenerator.h"
+#include "jmbdemodels/document.h"
+#include "jmbdemodels/lazyblobtablemodel.h"
+#include "jmbdemodels/migrator.h"
+#include "jmbdemodels/reportwriter.h"
+#include "jmbdemodels/rowmapper.h"
+#include "jmbdemodels/searchindex.h"
+#include "jmbdemodels/transaction.h"
+#include "jmbdemodels/zipcitylookup.h"
 
 using namespace Model;
 
@@ -26,20 +45,33 @@ public:
     ~DataContext_Test() override = default;
 
 private:
-    DataContext* dataContext;
+    DataContext* dataContext = nullptr;
     QString m_databaseName = QLatin1String("test");
 
 private slots:
     void initTestCase() // will run once before the first test
     {
         qDebug() << "Init Testcase";
-        this->dataContext = new class DataContext(nullptr, m_databaseName);
     }
 
     void cleanupTestCase()
     {
         qDebug() << "cleanup Testcase";
-        dataContext->deleteDB(this->m_databaseName);
+    }
+
+    // Every test gets a new database
+    void init()
+    {
+        this->dataContext = new class DataContext(nullptr, m_databaseName);
+    }
+
+    void cleanup()
+    {
+        if (this->dataContext->getDatabase().isOpen()) {
+            this->dataContext->deleteDB(this->m_databaseName);
+        }
+        delete this->dataContext;
+        this->dataContext = nullptr;
     }
 
     // Test for the Model Library
@@ -50,6 +82,26 @@ private slots:
     void renameDB_Test();
     void deleteDB_Test();
     void constructor_Test();
+    void shared_Test();
+    void connectionPool_Test();
+    void insertBatch_Test();
+    void update_Test();
+    void pragmaProfile_Test();
+    void splitStatements_Test();
+    void typedRows_Test();
+    void columnarSnapshot_Test();
+    void reportWriter_Test();
+    void cursor_Test();
+    void searchIndex_Test();
+    void accessResolver_Test();
+    void zipCityLookup_Test();
+    void blobStream_Test();
+    void changeFeed_Test();
+    void changeNotifier_Test();
+    void migrator_Test();
+    void dataGenerator_Test();
+    void transaction_Test();
+    void transactionPostgres_Test();
 };
 
 void DataContext_Test::getQuery_Test()
@@ -80,12 +132,25 @@ void DataContext_Test::renameDB_Test()
 {
     this->dataContext->open(this->m_databaseName);
     this->dataContext->renameDB(QStringLiteral("NewDB"));
+
+    const auto fileName = this->dataContext->getDatabase().databaseName();
+    QVERIFY(fileName.endsWith(QLatin1String("NewDB.sqlite3")));
+    QVERIFY(this->dataContext->getDatabase().isOpen());
+    QVERIFY(QFile::exists(fileName));
+
+    this->dataContext->deleteDB(QStringLiteral("NewDB"));
+    QVERIFY(!QFile::exists(fileName));
 }
 
 void DataContext_Test::deleteDB_Test()
 {
     this->dataContext->open(this->m_databaseName);
-    this->dataContext->deleteDB(QStringLiteral("NewDB"));
+    const auto fileName = this->dataContext->getDatabase().databaseName();
+    QVERIFY(QFile::exists(fileName));
+
+    this->dataContext->deleteDB(this->m_databaseName);
+    QVERIFY(!this->dataContext->getDatabase().isOpen());
+    QVERIFY(!QFile::exists(fileName));
 }
 
 void DataContext_Test::constructor_Test()
@@ -135,6 +200,796 @@ void DataContext_Test::constructor_Test()
     QVERIFY(local_dataContext != nullptr);
 }
 
+void DataContext_Test::shared_Test()
+{
+    auto first = DataContext::shared(this->m_databaseName);
+    auto second = DataContext::shared(this->m_databaseName);
+    QVERIFY(!first.isNull());
+    QCOMPARE(first.data(), second.data());
+
+    auto other = DataContext::shared(QStringLiteral("testDB_shared"));
+    QVERIFY(other.data() != first.data());
+
+    QWeakPointer<DataContext> released = other.toWeakRef();
+    other.reset();
+    QVERIFY(released.isNull());
+}
+
+void DataContext_Test::connectionPool_Test()
+{
+    auto* pool = this->dataContext->getConnectionPool();
+    QVERIFY(pool != nullptr);
+    pool->setMaxConnections(2);
+
+    QList<QThread*> workers;
+    QAtomicInt succeeded = 0;
+    for (int i = 0; i < 4; ++i) {
+        workers.append(QThread::create([pool, &succeeded]() {
+            PooledConnection connection(pool, 5000);
+            if (!connection.isValid()) {
+                return;
+            }
+            QSqlQuery query(connection.database());
+            if (query.exec(QStringLiteral("SELECT count(*) FROM employee")) && query.next()) {
+                succeeded.fetchAndAddOrdered(1);
+            }
+        }));
+    }
+    for (auto* worker : workers) {
+        worker->start();
+    }
+    for (auto* worker : workers) {
+        QVERIFY(worker->wait(10000));
+        delete worker;
+    }
+
+    QCOMPARE(succeeded.loadAcquire(), 4);
+    QVERIFY(pool->getOpenConnections() <= 2);
+
+    // The pool only marks the idle clone of another thread, that thread
+    // removes it
+    QString name;
+    QSemaphore released;
+    QSemaphore finish;
+    auto* worker = QThread::create([pool, &name, &released, &finish]() {
+        {
+            PooledConnection connection(pool, 5000);
+            name = connection.database().connectionName();
+        }
+        released.release();
+        finish.acquire();
+    });
+    worker->start();
+    released.acquire();
+    pool->closeIdleConnections();
+    QCOMPARE(pool->getOpenConnections(), 0);
+    QVERIFY(QSqlDatabase::contains(name));
+    finish.release();
+    QVERIFY(worker->wait(10000));
+    QVERIFY(!QSqlDatabase::contains(name));
+    delete worker;
+}
+
+void DataContext_Test::insertBatch_Test()
+{
+    QVector<QVariantMap> rows;
+    for (int i = 0; i < 250; ++i) {
+        rows.append({ { QStringLiteral("name"), QStringLiteral("Title %1").arg(i) } });
+    }
+    // The same primary key twice, only the second row must fail
+    rows.append({ { QStringLiteral("title_id"), 100000 }, { QStringLiteral("name"), QStringLiteral("A") } });
+    rows.append({ { QStringLiteral("title_id"), 100000 }, { QStringLiteral("name"), QStringLiteral("B") } });
+
+    auto result = this->dataContext->insertBatch(QStringLiteral("title"), rows, 100);
+    QCOMPARE(result.succeeded, 251);
+    QCOMPARE(result.failed.size(), 1);
+    QCOMPARE(result.failed.first().row, 251);
+
+    // A missing key keeps the DEFAULT of the column, also in a batch with
+    // rows that have it
+    QSqlQuery query(this->dataContext->getDatabase());
+    QVERIFY(query.exec(QStringLiteral(
+        "CREATE TABLE batch_default (id INTEGER PRIMARY KEY, name TEXT, priority INTEGER NOT NULL DEFAULT 3)")));
+    rows = { { { QStringLiteral("id"), 1 }, { QStringLiteral("name"), QStringLiteral("A") } },
+        { { QStringLiteral("id"), 2 }, { QStringLiteral("name"), QStringLiteral("B") }, { QStringLiteral("priority"), 7 } },
+        { { QStringLiteral("id"), 3 }, { QStringLiteral("name"), QStringLiteral("C") } },
+        { { QStringLiteral("id"), 2 }, { QStringLiteral("name"), QStringLiteral("D") } } };
+    result = this->dataContext->insertBatch(QStringLiteral("batch_default"), rows);
+    QCOMPARE(result.succeeded, 3);
+    QCOMPARE(result.failed.size(), 1);
+    QCOMPARE(result.failed.first().row, 3);
+
+    QVERIFY(query.exec(QStringLiteral("SELECT priority FROM batch_default ORDER BY id")));
+    QVERIFY(query.next());
+    QCOMPARE(query.value(0).toInt(), 3);
+    QVERIFY(query.next());
+    QCOMPARE(query.value(0).toInt(), 7);
+    QVERIFY(query.next());
+    QCOMPARE(query.value(0).toInt(), 3);
+    query.finish();
+}
+
+void DataContext_Test::update_Test()
+{
+    QVERIFY(this->dataContext->insert(QStringLiteral("title"), { { QStringLiteral("title_id"), 200000 }, { QStringLiteral("name"), QStringLiteral("Dr.") } }));
+
+    // Quotes are bound as values, not part of the statement
+    QVERIFY(this->dataContext->update(QStringLiteral("title"), { { QStringLiteral("name"), QStringLiteral("Dr. \"O'Neil\"") } }, { { QStringLiteral("title_id"), 200000 } }));
+    QVERIFY(this->dataContext->checkExistence(QStringLiteral("title"), QStringLiteral("name"), QStringLiteral("Dr. \"O'Neil\"")));
+
+    QVERIFY(!this->dataContext->update(QStringLiteral("title; DROP TABLE title"), { { QStringLiteral("name"), QStringLiteral("x") } }, { { QStringLiteral("title_id"), 1 } }));
+
+    auto result = this->dataContext->updateBatch(QStringLiteral("title"),
+        { qMakePair(QVariantMap { { QStringLiteral("name"), QStringLiteral("Prof.") } }, QVariantMap { { QStringLiteral("title_id"), 200000 } }),
+            qMakePair(QVariantMap { { QStringLiteral("no_column"), 1 } }, QVariantMap { { QStringLiteral("title_id"), 200000 } }) });
+    QCOMPARE(result.succeeded, 1);
+    QCOMPARE(result.failed.size(), 1);
+    QVERIFY(this->dataContext->checkExistence(QStringLiteral("title"), QStringLiteral("name"), QStringLiteral("Prof.")));
+}
+
+void DataContext_Test::pragmaProfile_Test()
+{
+    auto db = this->dataContext->getDatabase();
+    QSqlQuery query(db);
+    QVERIFY(query.exec(QStringLiteral("PRAGMA journal_mode")) && query.next());
+    QCOMPARE(query.value(0).toString().toLower(), QStringLiteral("wal"));
+
+    this->dataContext->setPragmaProfile(PragmaProfile::readOnlyReporting());
+    QVERIFY(!this->dataContext->insert(QStringLiteral("title"), { { QStringLiteral("name"), QStringLiteral("read only") } }));
+
+    this->dataContext->setPragmaProfile(PragmaProfile::interactive());
+    QVERIFY(this->dataContext->insert(QStringLiteral("title"), { { QStringLiteral("name"), QStringLiteral("writable") } }));
+}
+
+void DataContext_Test::splitStatements_Test()
+{
+    const auto statements = DataContext::splitStatements(QStringLiteral(
+        "-- comment; with a semicolon\n"
+        "CREATE TABLE a (id INTEGER PRIMARY KEY, name VARCHAR(10)); /* ; */\n"
+        "INSERT INTO a VALUES(1, 'it''s; -- no comment');\n"
+        "CREATE TRIGGER a_touch AFTER UPDATE ON a BEGIN\n"
+        "  UPDATE a SET name = CASE WHEN NEW.name IS NULL THEN 'x' ELSE NEW.name END WHERE id = NEW.id;\n"
+        "END;\n"
+        "CREATE FUNCTION f() RETURNS trigger AS $$ BEGIN RETURN NEW; END; $$ LANGUAGE plpgsql;\n"
+        "\n"));
+
+    QCOMPARE(statements.size(), 4);
+    QCOMPARE(statements.at(0), QStringLiteral("CREATE TABLE a (id INTEGER PRIMARY KEY, name VARCHAR(10))"));
+    QCOMPARE(statements.at(1), QStringLiteral("INSERT INTO a VALUES(1, 'it''s; -- no comment')"));
+    QVERIFY(statements.at(2).startsWith(QLatin1String("CREATE TRIGGER")));
+    QVERIFY(statements.at(2).endsWith(QLatin1String("END")));
+    QVERIFY(statements.at(3).contains(QLatin1String("RETURN NEW; END; $$")));
+}
+
+void DataContext_Test::typedRows_Test()
+{
+    RowWriter<TitleRow> writer(this->dataContext->getDatabase());
+    TitleRow title;
+    title.name = QStringLiteral("Typed");
+    title.fromDate = QDate(2021, 12, 25);
+    QVERIFY(writer.insert(title));
+    QVERIFY(title.titleId != 0);
+
+    RowReader<TitleRow> reader(this->dataContext->getDatabase());
+    auto rows = reader.select(QStringLiteral("title_id = ?"), { title.titleId });
+    QCOMPARE(rows.size(), 1);
+    const auto inserted = rows.first().lastUpdate;
+    QVERIFY(inserted.isValid());
+
+    // The struct has no last_update, the trigger sets a later one
+    QTest::qSleep(5);
+    title.name = QStringLiteral("Typed again");
+    QVERIFY(writer.update(title));
+
+    rows = reader.select(QStringLiteral("title_id = ?"), { title.titleId });
+    QCOMPARE(rows.size(), 1);
+    QCOMPARE(rows.first().name, QStringLiteral("Typed again"));
+    QCOMPARE(rows.first().fromDate, QDate(2021, 12, 25));
+    QVERIFY(rows.first().lastUpdate.isValid());
+    QVERIFY(rows.first().lastUpdate > inserted);
+
+    // A duplicate key in the middle of the batch fails alone
+    QVector<TitleRow> batch(4);
+    const qint64 ids[] = { 200001, 200002, 200001, 200003 };
+    for (int i = 0; i < batch.size(); ++i) {
+        batch[i].titleId = ids[i];
+        batch[i].name = QStringLiteral("Batch %1").arg(i);
+    }
+    const auto result = writer.insert(batch);
+    QCOMPARE(result.succeeded, 3);
+    QCOMPARE(result.failed.size(), 1);
+    QCOMPARE(result.failed.first().row, 2);
+    QCOMPARE(reader.select(QStringLiteral("title_id IN (200001, 200002, 200003)")).size(), 3);
+}
+
+void DataContext_Test::columnarSnapshot_Test()
+{
+    QVector<QVariantMap> rows;
+    for (int i = 0; i < 100; ++i) {
+        rows.append({ { QStringLiteral("computer_id"), 500000 + i },
+            { QStringLiteral("department_id"), i % 3 == 0 ? QVariant() : QVariant(i % 3) },
+            { QStringLiteral("network_name"), QStringLiteral("net%1").arg(i % 2) },
+            { QStringLiteral("memory"), 8 },
+            { QStringLiteral("active"), i % 2 == 0 } });
+    }
+    QCOMPARE(this->dataContext->insertBatch(QStringLiteral("computer"), rows).succeeded, 100);
+
+    const auto snapshot = ColumnarSnapshot::fromTable(this->dataContext->getDatabase(), Schema::Computer::Table,
+        QStringLiteral("computer_id >= ?"), { 500000 });
+    QVERIFY(snapshot.isValid());
+    QCOMPARE(snapshot.rowCount(), std::size_t(100));
+
+    const auto active = snapshot.isTrue(Schema::Computer::Active);
+    QCOMPARE(active.count(), std::size_t(50));
+    QCOMPARE((active & snapshot.equals(Schema::Computer::NetworkName, QStringLiteral("net0"))).count(), std::size_t(50));
+    QCOMPARE(snapshot.equals(Schema::Computer::DepartmentId, qint64(1)).count(), std::size_t(33));
+    QCOMPARE(snapshot.sum(Schema::Computer::Memory, active), 400.0);
+
+    qint64 total = 0;
+    for (const auto& group : snapshot.countBy(Schema::Computer::DepartmentId, active)) {
+        total += group.second;
+    }
+    QCOMPARE(total, qint64(50));
+}
+
+void DataContext_Test::reportWriter_Test()
+{
+    QCOMPARE(ReportWriter::escapeCsv(QStringLiteral("plain")), QStringLiteral("plain"));
+    QCOMPARE(ReportWriter::escapeCsv(QStringLiteral("a,\"b\"")), QStringLiteral("\"a,\"\"b\"\"\""));
+    QCOMPARE(ReportWriter::escapeJson(QStringLiteral("a\"b\n")), QStringLiteral("a\\\"b\\n"));
+
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    {
+        ReportWriter writer(&buffer, ReportWriter::Format::Json);
+        writer.setChunkRows(1);
+        writer.begin(QStringLiteral("Test"), { QStringLiteral("id"), QStringLiteral("name") });
+        writer.writeRow({ 1, QStringLiteral("<one>") });
+        writer.writeRow({ 2, QVariant() });
+        QCOMPARE(writer.getRowCount(), qint64(2));
+    }
+    QCOMPARE(buffer.data(), QByteArray("[\n{\"id\":1,\"name\":\"<one>\"},\n{\"id\":2,\"name\":null}\n]\n"));
+
+    QSqlQuery query(this->dataContext->getDatabase());
+    query.setForwardOnly(true);
+    QVERIFY(query.exec(QStringLiteral("SELECT title_id, name FROM title")));
+    QBuffer html;
+    html.open(QIODevice::WriteOnly);
+    ReportWriter writer(&html, ReportWriter::Format::Html);
+    writer.begin(QStringLiteral("Titles"), { QStringLiteral("Id"), QStringLiteral("Name") });
+    const auto rows = writer.writeQuery(query);
+    QVERIFY(writer.finish());
+    QCOMPARE(qint64(html.data().count("<tr>")), rows + 1);
+    QVERIFY(html.data().endsWith("</tbody></table>\n"));
+}
+
+void DataContext_Test::cursor_Test()
+{
+    QVector<QVariantMap> titles;
+    for (int i = 0; i < 20; ++i) {
+        titles.append({ { QStringLiteral("name"), QStringLiteral("Cursor %1").arg(i) } });
+    }
+    QCOMPARE(this->dataContext->insertBatch(QStringLiteral("title"), titles).succeeded, 20);
+
+    QSqlQuery count(this->dataContext->getDatabase());
+    QVERIFY(count.exec(QStringLiteral("SELECT COUNT(*) FROM title")));
+    QVERIFY(count.next());
+    const auto total = count.value(0).toLongLong();
+
+    this->dataContext->setFetchSize(7);
+    QCOMPARE(this->dataContext->getFetchSize(), 7);
+
+    qint64 rows = 0;
+    auto cursor = this->dataContext->cursor(QStringLiteral("SELECT title_id, name FROM title"));
+    QVERIFY(cursor.isValid());
+    for (const auto& row : cursor) {
+        QVERIFY(row.value(0).toLongLong() > 0);
+        ++rows;
+    }
+    QCOMPARE(rows, total);
+    QCOMPARE(cursor.getRowCount(), total);
+    QVERIFY(!cursor.next());
+
+    // false from the callback stops the scan
+    auto first = this->dataContext->cursor(QStringLiteral("SELECT name FROM title WHERE title_id > ?"), { 0 });
+    QCOMPARE(first.forEach([](const Cursor&) { return false; }), qint64(1));
+
+    auto wrong = this->dataContext->cursor(QStringLiteral("SELECT nothing FROM nowhere"));
+    QVERIFY(!wrong.isValid());
+    QVERIFY(!wrong.next());
+}
+
+void DataContext_Test::searchIndex_Test()
+{
+    QCOMPARE(SearchIndex::matchExpression(QStringLiteral("jo\" OR smi*"), false), QStringLiteral("\"jo\"* \"OR\"* \"smi\"*"));
+    QCOMPARE(SearchIndex::matchExpression(QStringLiteral("jo & !smi"), true), QStringLiteral("jo:* & smi:*"));
+
+    QVERIFY(this->dataContext->insert(QStringLiteral("employee"),
+        { { QStringLiteral("employee_id"), 900001 }, { QStringLiteral("first_name"), QStringLiteral("Searchable") },
+            { QStringLiteral("last_name"), QStringLiteral("Tester") },
+            { QStringLiteral("business_mail_address"), QStringLiteral("s.person@example.com") } }));
+
+    SearchIndex index(this->dataContext->getDatabase());
+    auto hits = index.search(QStringLiteral("searcha test"));
+    QVERIFY2(index.lastError().isEmpty(), qPrintable(index.lastError()));
+    QCOMPARE(hits.size(), 1);
+    QCOMPARE(hits.first().kind, SearchIndex::Kind::Employee);
+    QCOMPARE(hits.first().id, qint64(900001));
+    QCOMPARE(index.search(QStringLiteral("example"), SearchIndex::Kind::Employee).size(), 1);
+    QVERIFY(index.search(QStringLiteral("searchable"), SearchIndex::Kind::Computer).isEmpty());
+
+    // The triggers follow the changes of the row
+    QVERIFY(this->dataContext->update(QStringLiteral("employee"), { { QStringLiteral("last_name"), QStringLiteral("Renamed") } },
+        { { QStringLiteral("employee_id"), 900001 } }));
+    QVERIFY(index.search(QStringLiteral("searchable tester")).isEmpty());
+    QCOMPARE(index.search(QStringLiteral("renamed")).size(), 1);
+
+    QSqlQuery query(this->dataContext->getDatabase());
+    QVERIFY(query.exec(QStringLiteral("DELETE FROM employee WHERE employee_id = 900001")));
+    QVERIFY(index.search(QStringLiteral("renamed")).isEmpty());
+}
+
+void DataContext_Test::accessResolver_Test()
+{
+    QVector<QVariantMap> doors;
+    for (int i = 1; i <= 3; ++i) {
+        doors.append({ { QStringLiteral("chip_card_door_id"), 700000 + i }, { QStringLiteral("number"), QString::number(i) } });
+    }
+    QCOMPARE(this->dataContext->insertBatch(QStringLiteral("chip_card_door"), doors).succeeded, 3);
+    QVERIFY(this->dataContext->insert(QStringLiteral("chip_card_profile"),
+        { { QStringLiteral("chip_card_profile_id"), 710000 }, { QStringLiteral("chip_card_door_id"), 700001 } }));
+    QVERIFY(this->dataContext->insert(QStringLiteral("chip_card_profile_door"),
+        { { QStringLiteral("chip_card_profile_door_id"), 720000 }, { QStringLiteral("chip_card_profile_id"), 710000 },
+            { QStringLiteral("chip_card_door_id"), 700002 } }));
+    QVERIFY(this->dataContext->insert(QStringLiteral("chip_card"),
+        { { QStringLiteral("chip_card_id"), 730000 }, { QStringLiteral("chip_card_profile_id"), 710000 } }));
+    QVERIFY(this->dataContext->insert(QStringLiteral("chip_card"),
+        { { QStringLiteral("chip_card_id"), 730001 }, { QStringLiteral("chip_card_door_id"), 700003 } }));
+
+    AccessResolver access;
+    QVERIFY2(access.load(this->dataContext->getDatabase()), qPrintable(access.lastError()));
+    QVERIFY(access.canOpen(730000, 700001));
+    QVERIFY(access.canOpen(730000, 700002));
+    QVERIFY(!access.canOpen(730000, 700003));
+    QCOMPARE(access.doorsOf(730001), QVector<qint64>({ 700003 }));
+    QCOMPARE(access.cardsFor(700002), QVector<qint64>({ 730000 }));
+    QCOMPARE(access.profilesFor(700001), QVector<qint64>({ 710000 }));
+
+    // Changes of single rows
+    access.removeProfileDoor(720000);
+    QVERIFY(!access.canOpen(730000, 700002));
+    ChipCardRow card;
+    card.chipCardId = 730001;
+    card.chipCardProfileId = 710000;
+    card.chipCardDoorId = 700003;
+    access.setCard(card);
+    QCOMPARE(access.cardsFor(700001), QVector<qint64>({ 730000, 730001 }));
+    QCOMPARE(access.doorsOf(730001), QVector<qint64>({ 700001, 700003 }));
+    access.removeDoor(700001);
+    QVERIFY(!access.canOpen(730000, 700001));
+    QVERIFY(access.doorsOf(730000).isEmpty());
+}
+
+void DataContext_Test::zipCityLookup_Test()
+{
+    const QStringList codes = { QStringLiteral("88212"), QStringLiteral("88214"), QStringLiteral("10115") };
+    const QStringList cities = { QStringLiteral("Ravensburg"), QStringLiteral("ravensburg-Nord"), QStringLiteral("Berlin") };
+    for (int i = 0; i < codes.size(); ++i) {
+        QVERIFY(this->dataContext->insert(QStringLiteral("zip_code"),
+            { { QStringLiteral("zip_code_id"), 740000 + i }, { QStringLiteral("code"), codes.at(i) } }));
+        QVERIFY(this->dataContext->insert(QStringLiteral("city_name"),
+            { { QStringLiteral("city_name_id"), 750000 + i }, { QStringLiteral("name"), cities.at(i) } }));
+        QVERIFY(this->dataContext->insert(QStringLiteral("zip_city"),
+            { { QStringLiteral("zip_city_id"), 760000 + i }, { QStringLiteral("zip_code_id"), 740000 + i },
+                { QStringLiteral("city_id"), 750000 + i } }));
+    }
+
+    const auto before = ZipCityLookup::shared();
+    QVERIFY(before != nullptr);
+    QVERIFY(ZipCityLookup::reload(this->dataContext->getDatabase()));
+    const auto lookup = ZipCityLookup::shared();
+    QVERIFY(lookup != before);
+
+    const auto* entry = lookup->find(760002);
+    QVERIFY(entry != nullptr);
+    QCOMPARE(entry->city, QStringLiteral("Berlin"));
+    QVERIFY(lookup->find(1) == nullptr);
+
+    const auto byCode = lookup->byCode(QStringLiteral("8821"));
+    QCOMPARE(byCode.size(), 2);
+    QCOMPARE(byCode.first().code, QStringLiteral("88212"));
+    QCOMPARE(lookup->byCode(QStringLiteral("8821"), 1).size(), 1);
+
+    const auto byCity = lookup->byCity(QStringLiteral("RAVENS"));
+    QCOMPARE(byCity.size(), 2);
+    QCOMPARE(byCity.last().code, QStringLiteral("88214"));
+    QVERIFY(lookup->byCity(QStringLiteral("Zz")).isEmpty());
+}
+
+void DataContext_Test::blobStream_Test()
+{
+    QByteArray data(200 * 1024 + 17, '\0');
+    for (int i = 0; i < data.size(); ++i) {
+        data[i] = char(i % 251);
+    }
+    QVERIFY(this->dataContext->insert(QStringLiteral("document"),
+        { { QStringLiteral("document_id"), 770000 }, { QStringLiteral("name"), QStringLiteral("Blob") },
+            { QStringLiteral("document_data"), data } }));
+
+    BlobStream blob(this->dataContext->getDatabase(), Schema::Document::Table, Schema::Document::DocumentData);
+    blob.setChunkSize(4096);
+    QCOMPARE(blob.size(770000), qint64(data.size()));
+    QCOMPARE(blob.size(1), qint64(-1));
+
+    QBuffer out;
+    out.open(QIODevice::WriteOnly);
+    QCOMPARE(blob.read(770000, &out), qint64(data.size()));
+    QCOMPARE(out.data(), data);
+
+    auto changed = data;
+    changed.replace(0, 4, "JMBD");
+    QBuffer in(&changed);
+    in.open(QIODevice::ReadOnly);
+    QVERIFY2(blob.write(770000, &in), qPrintable(blob.lastError()));
+    out.close();
+    out.setData(QByteArray());
+    out.open(QIODevice::WriteOnly);
+    QCOMPARE(blob.read(770000, &out), qint64(changed.size()));
+    QCOMPARE(out.data(), changed);
+
+    // The models leave the blob out unless they are told otherwise
+    LazyBlobTableModel model(Schema::Document::Table, nullptr, this->dataContext->getDatabase());
+    model.setTable(QStringLiteral("document"));
+    model.setFilter(QStringLiteral("document_id = 770000"));
+    QVERIFY(model.select());
+    QCOMPARE(model.rowCount(), 1);
+    const auto column = model.record().indexOf(QStringLiteral("document_data"));
+    QVERIFY(model.data(model.index(0, column)).isNull());
+    QCOMPARE(model.data(model.index(0, model.record().indexOf(QStringLiteral("name")))).toString(), QStringLiteral("Blob"));
+
+    model.setLoadBlobs(true);
+    QVERIFY(model.select());
+    QCOMPARE(model.data(model.index(0, column)).toByteArray(), changed);
+
+    // selectAsync() keeps the column, but reads it as NULL
+    Document document(QSharedPointer<DataContext>(this->dataContext, [](DataContext*) {}));
+    QSignalSpy selected(&document, &CommonData::selectFinished);
+    document.selectAsync();
+    QTRY_COMPARE(selected.size(), 1);
+    const auto& resultSet = document.getResultSet();
+    QVERIFY2(resultSet.isValid(), qPrintable(resultSet.error));
+    QCOMPARE(static_cast<int>(resultSet.columns.indexOf(QStringLiteral("document_data"))),
+        static_cast<int>(Schema::Document::DocumentData));
+    QCOMPARE(resultSet.rows.size(), 1);
+    QVERIFY(resultSet.rows.first().at(Schema::Document::DocumentData).isNull());
+    QCOMPARE(resultSet.rows.first().at(Schema::Document::Name).toString(), QStringLiteral("Blob"));
+}
+
+void DataContext_Test::changeFeed_Test()
+{
+    const auto all = this->dataContext->changesSince(Schema::Document::Table);
+    QVERIFY2(all.rows.isValid(), qPrintable(all.rows.error));
+    QVERIFY(!all.rows.columns.contains(QStringLiteral("document_data")));
+
+    // The triggers set last_update, a later write gets a later timestamp
+    QTest::qSleep(5);
+    QVERIFY(this->dataContext->insert(QStringLiteral("document"),
+        { { QStringLiteral("document_id"), 771000 }, { QStringLiteral("name"), QStringLiteral("Feed") } }));
+    auto changes = this->dataContext->changesSince(Schema::Document::Table, all.watermark);
+    QCOMPARE(changes.table, QStringLiteral("document"));
+    QCOMPARE(changes.rows.rows.size(), 1);
+    QCOMPARE(changes.rows.rows.first().first().toInt(), 771000);
+    QVERIFY(changes.watermark.isValid());
+    QVERIFY(!all.watermark.isValid() || changes.watermark > all.watermark);
+
+    QVERIFY(this->dataContext->changesSince(Schema::Document::Table, changes.watermark).rows.rows.isEmpty());
+
+    QTest::qSleep(5);
+    QVERIFY(this->dataContext->update(QStringLiteral("document"), { { QStringLiteral("name"), QStringLiteral("Feed 2") } },
+        { { QStringLiteral("document_id"), 771000 } }));
+    changes = this->dataContext->changesSince(Schema::Document::Table, changes.watermark);
+    QCOMPARE(changes.rows.rows.size(), 1);
+    QCOMPARE(changes.rows.rows.first().at(1).toString(), QStringLiteral("Feed 2"));
+
+    // A deleted row leaves its key behind
+    QTest::qSleep(5);
+    QSqlQuery query(this->dataContext->getDatabase());
+    QVERIFY(query.exec(QStringLiteral("DELETE FROM document WHERE document_id = 771000")));
+    const auto deleted = this->dataContext->changesSince(Schema::Document::Table, changes.watermark);
+    QVERIFY(deleted.rows.rows.isEmpty());
+    QCOMPARE(deleted.deleted, QVector<qint64> { 771000 });
+    QVERIFY(deleted.watermark > changes.watermark);
+
+    // init() created everything, a second run has nothing to do
+    QVERIFY(this->dataContext->createChangeTracking());
+
+    // Only the old keys are purged
+    QVERIFY(query.exec(QStringLiteral(
+        "INSERT INTO deleted_row (table_name, row_id, deleted_at) VALUES ('document', 1, '2000-01-01T00:00:00.000Z')")));
+    QVERIFY(this->dataContext->purgeDeletedRows());
+    QVERIFY(query.exec(QStringLiteral("SELECT row_id FROM deleted_row WHERE table_name = 'document'")));
+    QVERIFY(query.next());
+    QCOMPARE(query.value(0).toLongLong(), 771000LL);
+    QVERIFY(!query.next());
+}
+
+void DataContext_Test::changeNotifier_Test()
+{
+    auto* notifier = this->dataContext->notifier();
+    QCOMPARE(this->dataContext->notifier(), notifier);
+    QVERIFY(notifier->start());
+    QSignalSpy rows(notifier, &ChangeNotifier::rowChanged);
+
+    // A second connection stands in for another process
+    QTest::qSleep(5);
+    {
+        auto other = QSqlDatabase::addDatabase(QStringLiteral("QSQLITE"), QStringLiteral("otherProcess"));
+        other.setDatabaseName(this->dataContext->getDatabase().databaseName());
+        QVERIFY(other.open());
+        QSqlQuery query(other);
+        QVERIFY2(query.exec(QStringLiteral("INSERT INTO document (document_id, name) VALUES (772000, 'Other')")),
+            qPrintable(query.lastError().text()));
+    }
+    QSqlDatabase::removeDatabase(QStringLiteral("otherProcess"));
+
+    notifier->refresh();
+    bool found = false;
+    for (const auto& arguments : rows) {
+        found = found
+            || (arguments.at(0).toString() == QLatin1String("document") && arguments.at(1).toLongLong() == 772000);
+    }
+    QVERIFY(found);
+
+    // Without a new commit of another connection nothing is read again
+    rows.clear();
+    notifier->refresh();
+    QVERIFY(rows.isEmpty());
+
+    const auto otherProcess = [this](const QString& sql) {
+        QTest::qSleep(5);
+        {
+            auto other = QSqlDatabase::addDatabase(QStringLiteral("QSQLITE"), QStringLiteral("otherProcess"));
+            other.setDatabaseName(this->dataContext->getDatabase().databaseName());
+            QVERIFY(other.open());
+            QSqlQuery query(other);
+            QVERIFY2(query.exec(sql), qPrintable(query.lastError().text()));
+        }
+        QSqlDatabase::removeDatabase(QStringLiteral("otherProcess"));
+    };
+
+    // A delete of another process is reported for its row only
+    QSignalSpy allTables(notifier, &ChangeNotifier::tableChanged);
+    otherProcess(QStringLiteral("DELETE FROM document WHERE document_id = 772000"));
+    notifier->refresh();
+    QCOMPARE(rows.size(), 1);
+    QCOMPARE(rows.first().at(1).toLongLong(), 772000LL);
+    QVERIFY(rows.first().at(2).value<RowOperation>() == RowOperation::Delete);
+    QVERIFY(allTables.isEmpty());
+
+    // A row with an old last_update of its own can't be found, every table
+    // is refreshed, but not again within the interval
+    otherProcess(QStringLiteral(
+        "INSERT INTO document (document_id, name, last_update) VALUES (772001, 'Old', '2000-01-01T00:00:00.000Z')"));
+    notifier->refresh();
+    QCOMPARE(allTables.size(), static_cast<int>(std::size(Schema::Tables)));
+    otherProcess(QStringLiteral(
+        "INSERT INTO document (document_id, name, last_update) VALUES (772002, 'Old', '2000-01-01T00:00:00.000Z')"));
+    notifier->refresh();
+    QCOMPARE(allTables.size(), static_cast<int>(std::size(Schema::Tables)));
+    rows.clear();
+
+    // Above the row limit a commit is reported as the table, not row by row
+    if (SqliteStatement::isSupported(this->dataContext->getDatabase())) {
+        notifier->setRowLimit(10);
+        QSignalSpy tables(notifier, &ChangeNotifier::tableChanged);
+        QVector<QVariantMap> batch;
+        for (int i = 0; i < 50; ++i) {
+            batch.append({ { QStringLiteral("name"), QStringLiteral("Bulk %1").arg(i) } });
+        }
+        QCOMPARE(this->dataContext->insertBatch(QStringLiteral("title"), batch, 20).succeeded, 50);
+        QTRY_COMPARE(tables.size(), 1);
+        QCOMPARE(tables.first().at(0).toString(), QStringLiteral("title"));
+        for (const auto& arguments : rows) {
+            QVERIFY(arguments.at(0).toString() != QLatin1String("title"));
+        }
+        notifier->setRowLimit(256);
+    }
+
+    notifier->stop();
+    QVERIFY(!notifier->isActive());
+}
+
+void DataContext_Test::migrator_Test()
+{
+    // init() applied the migrations of the library
+    Migrator builtIn(this->dataContext->getDatabase());
+    QVERIFY(builtIn.currentVersion() >= 1);
+    QVERIFY(builtIn.pending().isEmpty());
+
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+    const auto writeScript = [&directory](const QString& name, const QByteArray& script) {
+        QFile file(directory.filePath(name));
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write(script);
+    };
+    writeScript(QStringLiteral("9001_create.sql"), "CREATE TABLE migration_test (id INTEGER PRIMARY KEY, name TEXT);");
+    writeScript(QStringLiteral("9002_fill.sql"), "INSERT INTO migration_test VALUES (1, 'a');\nINSERT INTO migration_test VALUES (2, 'b');");
+    writeScript(QStringLiteral("9002_fill.pgsql.sql"), "SELECT broken;");
+    writeScript(QStringLiteral("9003_index.sql"), "-- migrate: online\nCREATE INDEX IF NOT EXISTS idx_migration_test_name ON migration_test (name);");
+
+    Migrator migrator(this->dataContext->getDatabase());
+    migrator.setDirectory(directory.path());
+    QCOMPARE(migrator.pending().size(), 3);
+    QCOMPARE(migrator.pending().at(1).name, QStringLiteral("fill"));
+
+    QSignalSpy progress(&migrator, &Migrator::progress);
+    QVERIFY2(migrator.migrate(), qPrintable(migrator.lastError()));
+    QCOMPARE(migrator.currentVersion(), 9003);
+    QCOMPARE(progress.size(), 4);
+    QCOMPARE(progress.last().at(0).toInt(), 3);
+    QVERIFY(migrator.pending().isEmpty());
+
+    // A failing migration leaves nothing behind and runs again next time
+    writeScript(QStringLiteral("9004_broken.sql"), "INSERT INTO migration_test VALUES (3, 'c');\nINSERT INTO missing_table VALUES (1);");
+    QVERIFY(!migrator.migrate());
+    QVERIFY(!migrator.lastError().isEmpty());
+    QCOMPARE(migrator.currentVersion(), 9003);
+    QCOMPARE(migrator.pending().size(), 1);
+
+    QSqlQuery query(this->dataContext->getDatabase());
+    QVERIFY(query.exec(QStringLiteral("SELECT count(*) FROM migration_test")));
+    QVERIFY(query.next());
+    QCOMPARE(query.value(0).toInt(), 2);
+
+    // An online script that couldn't run again is refused before it starts
+    QFile::remove(directory.filePath(QStringLiteral("9004_broken.sql")));
+    writeScript(QStringLiteral("9005_online.sql"),
+        "-- migrate: online\nCREATE INDEX IF NOT EXISTS idx_migration_test_id ON migration_test (id);\n"
+        "ALTER TABLE migration_test ADD COLUMN extra TEXT;");
+    QVERIFY(!migrator.migrate());
+    QVERIFY(migrator.lastError().contains(QLatin1String("ALTER TABLE")));
+    QCOMPARE(migrator.currentVersion(), 9003);
+    QVERIFY(query.exec(QStringLiteral("SELECT 1 FROM sqlite_master WHERE name = 'idx_migration_test_id'")));
+    QVERIFY(!query.next());
+}
+
+void DataContext_Test::dataGenerator_Test()
+{
+    DataGenerator::Options options;
+    options.seed = 42;
+    options.employees = 200;
+    options.devices = 100;
+    options.softwarePerComputer = 3;
+    options.skew = 1.5;
+    options.batchSize = 50;
+    options.counts.insert(QStringLiteral("department"), 20);
+
+    DataGenerator generator(options);
+    QCOMPARE(generator.count(Schema::Employee::Table), 200);
+    QCOMPARE(generator.count(Schema::Department::Table), 20);
+    QCOMPARE(generator.count(Schema::Computer::Table), 40);
+    QCOMPARE(generator.count(Schema::ComputerSoftware::Table), 120);
+    QCOMPARE(generator.count(Schema::Fax::Table), 10);
+
+    // The same seed gives the same rows, a batch doesn't depend on the others
+    const auto batch = generator.rows(Schema::Employee::Table, 1);
+    QCOMPARE(batch.size(), 50);
+    QCOMPARE(batch.first().value(QStringLiteral("employee_id")).toLongLong(), 51LL);
+    QCOMPARE(DataGenerator(options).rows(Schema::Employee::Table, 1), batch);
+    QVERIFY(generator.rows(Schema::Employee::Table, 4).isEmpty());
+
+    options.seed = 43;
+    QVERIFY(DataGenerator(options).rows(Schema::Employee::Table, 1) != batch);
+
+    // The references stay within the referenced table, the first departments
+    // get the most employees
+    QVector<int> perDepartment(20);
+    for (int i = 0; i < 4; ++i) {
+        for (const auto& row : generator.rows(Schema::Employee::Table, i)) {
+            const auto department = row.value(QStringLiteral("department_id")).toInt();
+            QVERIFY(department >= 1 && department <= 20);
+            ++perDepartment[department - 1];
+
+            const auto computer = row.value(QStringLiteral("computer_id")).toInt();
+            QVERIFY(computer >= 1 && computer <= 40);
+        }
+    }
+    QVERIFY(perDepartment.at(0) > perDepartment.at(9));
+    QVERIFY(perDepartment.at(0) + perDepartment.at(1) > 200 / 2);
+}
+
+void DataContext_Test::transaction_Test()
+{
+    auto db = this->dataContext->getDatabase();
+    const auto count = [&db]() {
+        QSqlQuery query(db);
+        return query.exec(QStringLiteral("SELECT count(*) FROM title WHERE name = 'Outer'")) && query.next()
+            ? query.value(0).toInt()
+            : -1;
+    };
+    const QVector<QVariantMap> rows { { { QStringLiteral("name"), QStringLiteral("Outer") } },
+        { { QStringLiteral("name"), QStringLiteral("Outer") } } };
+
+    // insertBatch() joins the transaction of the caller with a savepoint
+    Transaction outer(db);
+    QVERIFY(outer.isActive());
+    QVERIFY(!outer.isNested());
+    QCOMPARE(Transaction::depth(db), 1);
+    QCOMPARE(this->dataContext->insertBatch(QStringLiteral("title"), rows).succeeded, 2);
+    QCOMPARE(Transaction::depth(db), 1);
+    outer.rollback();
+    QCOMPARE(Transaction::depth(db), 0);
+    QCOMPARE(count(), 0);
+
+    // An inner rollback keeps the work of the outer transaction
+    Transaction kept(db);
+    QVERIFY(this->dataContext->insert(QStringLiteral("title"), rows.first()));
+    {
+        Transaction inner(db);
+        QVERIFY(inner.isNested());
+        QVERIFY(this->dataContext->insert(QStringLiteral("title"), rows.first()));
+    }
+    QVERIFY(kept.commit());
+    QCOMPARE(count(), 1);
+
+    // A transaction opened on the connection itself is joined as well
+    QVERIFY(db.transaction());
+    QCOMPARE(this->dataContext->insertBatch(QStringLiteral("title"), rows).succeeded, 2);
+    QVERIFY(db.rollback());
+    QCOMPARE(count(), 1);
+}
+
+void DataContext_Test::transactionPostgres_Test()
+{
+    // JMBDE_TEST_PGSQL_HOST, _PORT, _DATABASE, _USER and _PASSWORD
+    const auto host = qEnvironmentVariable("JMBDE_TEST_PGSQL_HOST");
+    if (host.isEmpty()) {
+        QSKIP("JMBDE_TEST_PGSQL_HOST is not set");
+    }
+
+    DataContext context(nullptr, qEnvironmentVariable("JMBDE_TEST_PGSQL_DATABASE", QStringLiteral("jmbde_test")),
+        QStringLiteral("PGSQL"), qEnvironmentVariable("JMBDE_TEST_PGSQL_USER"),
+        qEnvironmentVariable("JMBDE_TEST_PGSQL_PASSWORD"), host, qEnvironmentVariableIntValue("JMBDE_TEST_PGSQL_PORT"));
+    auto db = context.getDatabase();
+    QVERIFY2(db.isOpen(), qPrintable(db.lastError().text()));
+
+    QSqlQuery query(db);
+    QVERIFY(query.exec(QStringLiteral("CREATE TEMPORARY TABLE transaction_test (id INTEGER PRIMARY KEY, name TEXT)")));
+
+    QVector<QVariantMap> rows;
+    for (int i = 1; i <= 10; ++i) {
+        rows.append({ { QStringLiteral("id"), i }, { QStringLiteral("name"), QStringLiteral("Row %1").arg(i) } });
+    }
+    // A duplicate key makes the batch fall back to single rows
+    rows.append({ { QStringLiteral("id"), 5 }, { QStringLiteral("name"), QStringLiteral("Twice") } });
+
+    // A nested BEGIN is only a warning on PostgreSQL, the batches must not
+    // commit the outer transaction
+    Transaction outer(db);
+    QVERIFY(outer.isActive());
+    const auto result = context.insertBatch(QStringLiteral("transaction_test"), rows, 4);
+    QCOMPARE(result.succeeded, 10);
+    QCOMPARE(result.failed.size(), 1);
+
+    // The server side cursor joins the outer transaction, close() doesn't
+    // commit it
+    {
+        Cursor cursor(db, QStringLiteral("SELECT id FROM transaction_test ORDER BY id"), {}, 3);
+        int read = 0;
+        while (cursor.next()) {
+            ++read;
+        }
+        QCOMPARE(read, 10);
+        QVERIFY2(cursor.lastError().isEmpty(), qPrintable(cursor.lastError()));
+    }
+    outer.rollback();
+
+    QVERIFY(query.exec(QStringLiteral("SELECT count(*) FROM transaction_test")));
+    QVERIFY(query.next());
+    QCOMPARE(query.value(0).toInt(), 0);
+}
+
 QTEST_GUILESS_MAIN(DataContext_Test)
 
 #include "tst_datacontext.moc"